@@ -0,0 +1,70 @@
+// Heap allocation counter for finding allocations after boot - see alloc_counter.h
+
+#ifdef ALLOC_PROFILING
+
+#include "alloc_counter.h"
+#include "mem_pool.h"
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+static std::atomic<uint32_t> alloc_count(0);
+static uint32_t steady_state_count = 0;
+
+void *allocCountedMalloc(size_t size) {
+    alloc_count++;
+    return lvglPoolAlloc(size);
+}
+
+void allocCountedFree(void *ptr) {
+    lvglPoolFree(ptr);
+}
+
+void *allocCountedRealloc(void *ptr, size_t size) {
+    alloc_count++;
+    return lvglPoolRealloc(ptr, size);
+}
+
+uint32_t allocCount(void) {
+    return alloc_count.load();
+}
+
+void allocMarkSteadyState(void) {
+    steady_state_count = alloc_count.load();
+}
+
+uint32_t allocSinceSteadyState(void) {
+    return alloc_count.load() - steady_state_count;
+}
+
+// Count C++ allocations too (Arduino String, std containers), from the system heap
+void *operator new(size_t size) {
+    alloc_count++;
+    void *ptr = malloc(size);
+    if (ptr == NULL) {
+        abort();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+#endif // ALLOC_PROFILING
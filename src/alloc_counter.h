@@ -0,0 +1,40 @@
+// Heap allocation counter for finding allocations after boot
+//
+// Only active in the cyd_alloc_check environment (ALLOC_PROFILING). There,
+// lv_conf.h routes LVGL's allocator through allocCounted*() (which count,
+// then use LVGL's pool from mem_pool.h) and alloc_counter.cpp replaces the
+// C++ operator new, so every allocation by LVGL or by Arduino String is
+// counted. After boot the count should not move.
+// The native test environment defines ALLOC_PROFILING too, and
+// test/test_steady_state fails if a long replayed session allocates.
+// No Arduino dependencies so it can be built on the host.
+
+#ifndef BALECOUNTER_ALLOC_COUNTER_H
+#define BALECOUNTER_ALLOC_COUNTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL allocator hooks (LV_MEM_CUSTOM_ALLOC / _FREE / _REALLOC)
+void *allocCountedMalloc(size_t size);
+void allocCountedFree(void *ptr);
+void *allocCountedRealloc(void *ptr, size_t size);
+
+// Total allocations since boot
+uint32_t allocCount(void);
+
+// Remember the current count as the end of boot
+void allocMarkSteadyState(void);
+
+// Allocations since allocMarkSteadyState() - should stay 0
+uint32_t allocSinceSteadyState(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BALECOUNTER_ALLOC_COUNTER_H
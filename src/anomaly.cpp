@@ -0,0 +1,197 @@
+// Online anomaly detection for the bale and flake sensors - see anomaly.h
+
+#include "anomaly.h"
+#include <math.h>
+#include <string.h>
+
+static const char *const anomaly_names[ANOMALY_COUNT] = {
+    "Bale sensor stuck ON",
+    "Bale sensor stuck OFF",
+    "Flake sensor stuck ON",
+    "Flake sensor stuck OFF",
+    "Bale sensor chatter",
+    "Flake sensor chatter",
+    "Bale interval outlier",
+    "Flakes per bale outlier",
+    "Flakes without bale",
+};
+
+// Add a sample to an exponentially weighted mean/variance
+static void statAdd(RunningStat *st, float x) {
+    if (st->n == 0) {
+        st->mean = x;
+        st->var = 0.0f;
+    } else {
+        float diff = x - st->mean;
+        float incr = ANOMALY_SMOOTHING * diff;
+        st->mean += incr;
+        st->var = (1.0f - ANOMALY_SMOOTHING) * (st->var + diff * incr);
+    }
+    st->n++;
+}
+
+// True if x is far outside the learned distribution
+// min_spread keeps a very steady distribution from flagging tiny changes
+static bool statIsOutlier(const RunningStat *st, float x, float min_spread) {
+    if (st->n < ANOMALY_WARMUP) {
+        return false;
+    }
+    float spread = ANOMALY_SIGMA * sqrtf(st->var);
+    if (spread < min_spread) {
+        spread = min_spread;
+    }
+    return fabsf(x - st->mean) > spread;
+}
+
+// Raise or clear an alert, counting each new raise. An acknowledged alert
+// isn't raised again until its condition clears.
+static void setAlert(AnomalyDetector *ad, AnomalyType type, bool raised) {
+    uint32_t bit = 1UL << type;
+    if (raised) {
+        if (!((ad->active | ad->acknowledged) & bit)) {
+            ad->active |= bit;
+            ad->counts[type]++;
+            ad->total++;
+        }
+    } else {
+        ad->active &= ~bit;
+        ad->acknowledged &= ~bit;
+    }
+}
+
+void anomalyInit(AnomalyDetector *ad, uint32_t now_ms) {
+    memset(ad, 0, sizeof(*ad));
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        ad->sensors[i].last_change = now_ms;
+        ad->sensors[i].window_start = now_ms;
+    }
+}
+
+void anomalyOnEdge(AnomalyDetector *ad, SensorId sensor, bool active, uint32_t now_ms) {
+    SensorWatch *sw = &ad->sensors[sensor];
+    uint32_t duration = now_ms - sw->last_change;
+
+    // Learn how long the state that just ended normally lasts
+    if (sw->seen_edge) {
+        if (sw->active) {
+            statAdd(&sw->on_ms, (float)duration);
+        } else if (duration <= ANOMALY_BREAK_MS) {
+            statAdd(&sw->off_ms, (float)duration);
+        }
+    }
+    sw->active = active;
+    sw->last_change = now_ms;
+    sw->seen_edge = true;
+
+    // Any edge ends a stuck condition
+    AnomalyType stuck_on = (sensor == SENSOR_BALE) ? ANOMALY_BALE_STUCK_ON : ANOMALY_FLAKE_STUCK_ON;
+    AnomalyType stuck_off = (sensor == SENSOR_BALE) ? ANOMALY_BALE_STUCK_OFF : ANOMALY_FLAKE_STUCK_OFF;
+    setAlert(ad, stuck_on, false);
+    setAlert(ad, stuck_off, false);
+
+    // Chatter: too many edges within one fixed window
+    if (now_ms - sw->window_start >= ANOMALY_CHATTER_WINDOW_MS) {
+        sw->window_start = now_ms;
+        sw->window_edges = 0;
+    }
+    sw->window_edges++;
+    if (sensor == SENSOR_BALE) {
+        if (sw->window_edges > ANOMALY_BALE_CHATTER_EDGES) {
+            setAlert(ad, ANOMALY_BALE_CHATTER, true);
+        }
+    } else {
+        if (sw->window_edges > ANOMALY_FLAKE_CHATTER_EDGES) {
+            setAlert(ad, ANOMALY_FLAKE_CHATTER, true);
+        }
+    }
+}
+
+void anomalyOnBale(AnomalyDetector *ad, uint32_t flakes_in_bale, uint32_t now_ms) {
+    // Bale interval far outside the running distribution (missed or double counted bale)
+    if (ad->have_last_bale) {
+        uint32_t interval = now_ms - ad->last_bale_time;
+        if (interval <= ANOMALY_BREAK_MS) {
+            bool outlier = statIsOutlier(&ad->bale_interval, (float)interval, 0.5f * ad->bale_interval.mean);
+            setAlert(ad, ANOMALY_BALE_INTERVAL, outlier);
+            if (!outlier) {
+                statAdd(&ad->bale_interval, (float)interval);
+            }
+        }
+    }
+    ad->last_bale_time = now_ms;
+    ad->have_last_bale = true;
+
+    // Flakes per bale outlier (flake sensor missing flakes, or a missed bale edge)
+    bool outlier = statIsOutlier(&ad->flakes_per_bale, (float)flakes_in_bale, 2.0f);
+    setAlert(ad, ANOMALY_FLAKES_PER_BALE, outlier);
+    if (!outlier) {
+        statAdd(&ad->flakes_per_bale, (float)flakes_in_bale);
+    }
+
+    ad->flakes_since_bale = 0;
+    setAlert(ad, ANOMALY_FLAKES_NO_BALE, false);
+}
+
+void anomalyOnFlake(AnomalyDetector *ad, uint32_t now_ms) {
+    (void)now_ms;
+    ad->flakes_since_bale++;
+
+    // Flakes keep arriving with no bale edge
+    float limit = ANOMALY_FLAKES_NO_BALE_MIN;
+    if (ad->flakes_per_bale.n >= ANOMALY_WARMUP) {
+        float learned = ANOMALY_FLAKES_NO_BALE_FACTOR * ad->flakes_per_bale.mean;
+        if (learned > 0.0f && learned < limit) {
+            limit = learned;
+        }
+    }
+    if (ad->flakes_since_bale > limit) {
+        setAlert(ad, ANOMALY_FLAKES_NO_BALE, true);
+    }
+}
+
+void anomalyTick(AnomalyDetector *ad, uint32_t now_ms) {
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        SensorWatch *sw = &ad->sensors[i];
+        SensorWatch *other = &ad->sensors[(i + 1) % SENSOR_COUNT];
+        uint32_t duration = now_ms - sw->last_change;
+
+        if (sw->active) {
+            // Stuck ON: far longer than a normal detection
+            float limit = ANOMALY_STUCK_FACTOR * sw->on_ms.mean;
+            if (limit < ANOMALY_STUCK_ON_MIN_MS) {
+                limit = ANOMALY_STUCK_ON_MIN_MS;
+            }
+            if (duration > limit) {
+                setAlert(ad, (i == SENSOR_BALE) ? ANOMALY_BALE_STUCK_ON : ANOMALY_FLAKE_STUCK_ON, true);
+            }
+        } else {
+            // Stuck OFF: only while the other sensor shows the baler is running
+            float limit = ANOMALY_STUCK_FACTOR * sw->off_ms.mean;
+            if (limit < ANOMALY_STUCK_OFF_MIN_MS) {
+                limit = ANOMALY_STUCK_OFF_MIN_MS;
+            }
+            bool running = other->seen_edge && (now_ms - other->last_change) < ANOMALY_ACTIVITY_MS;
+            if (duration > limit && running) {
+                setAlert(ad, (i == SENSOR_BALE) ? ANOMALY_BALE_STUCK_OFF : ANOMALY_FLAKE_STUCK_OFF, true);
+            }
+        }
+
+        // Chatter clears once a full quiet window has passed
+        if (now_ms - sw->window_start >= 2 * ANOMALY_CHATTER_WINDOW_MS) {
+            sw->window_edges = 0;
+            setAlert(ad, (i == SENSOR_BALE) ? ANOMALY_BALE_CHATTER : ANOMALY_FLAKE_CHATTER, false);
+        }
+    }
+}
+
+void anomalyAcknowledge(AnomalyDetector *ad) {
+    ad->acknowledged |= ad->active;
+    ad->active = 0;
+}
+
+const char *anomalyName(AnomalyType type) {
+    if (type < 0 || type >= ANOMALY_COUNT) {
+        return "Unknown";
+    }
+    return anomaly_names[type];
+}
@@ -0,0 +1,103 @@
+// Online anomaly detection for the bale and flake sensors
+//
+// Every detector keeps a few running values (exponentially weighted mean and
+// variance, last edge times, a one-window edge counter), so each event and
+// each tick is O(1) with fixed memory.
+
+#ifndef BALECOUNTER_ANOMALY_H
+#define BALECOUNTER_ANOMALY_H
+
+#include <stdint.h>
+
+// Sensor stuck ON/OFF: duration must exceed both the minimum and factor x normal
+#define ANOMALY_STUCK_ON_MIN_MS 30000UL
+#define ANOMALY_STUCK_OFF_MIN_MS 60000UL
+#define ANOMALY_STUCK_FACTOR 10.0f
+// The other sensor must have changed this recently for "stuck OFF" to count,
+// so an idle baler is not reported
+#define ANOMALY_ACTIVITY_MS 30000UL
+// Chatter: more edges than this within one window
+#define ANOMALY_CHATTER_WINDOW_MS 1000UL
+#define ANOMALY_BALE_CHATTER_EDGES 10
+#define ANOMALY_FLAKE_CHATTER_EDGES 20
+// Running distributions are learned for this many samples before alerting
+#define ANOMALY_WARMUP 5
+#define ANOMALY_SMOOTHING 0.1f
+// Bale interval / flakes per bale outlier thresholds (standard deviations)
+#define ANOMALY_SIGMA 4.0f
+// Intervals longer than this are breaks, not missed bales
+#define ANOMALY_BREAK_MS (10UL * 60UL * 1000UL)
+// Flakes without a bale edge: more than this x the normal flakes per bale
+#define ANOMALY_FLAKES_NO_BALE_FACTOR 3.0f
+#define ANOMALY_FLAKES_NO_BALE_MIN 30
+
+enum AnomalyType {
+    ANOMALY_BALE_STUCK_ON = 0,
+    ANOMALY_BALE_STUCK_OFF,
+    ANOMALY_FLAKE_STUCK_ON,
+    ANOMALY_FLAKE_STUCK_OFF,
+    ANOMALY_BALE_CHATTER,
+    ANOMALY_FLAKE_CHATTER,
+    ANOMALY_BALE_INTERVAL,
+    ANOMALY_FLAKES_PER_BALE,
+    ANOMALY_FLAKES_NO_BALE,
+    ANOMALY_COUNT
+};
+
+enum SensorId {
+    SENSOR_BALE = 0,
+    SENSOR_FLAKE,
+    SENSOR_COUNT
+};
+
+// Exponentially weighted mean and variance
+struct RunningStat {
+    float mean;
+    float var;
+    uint32_t n;
+};
+
+struct SensorWatch {
+    bool active;              // Sensor currently ON (target present)
+    bool seen_edge;           // last_change is a real edge, not boot time
+    uint32_t last_change;     // Time of the last state change (ms)
+    RunningStat on_ms;        // Normal ON duration
+    RunningStat off_ms;       // Normal OFF duration while running
+    uint32_t window_start;    // Start of the current chatter window
+    uint16_t window_edges;    // Edges seen in the current chatter window
+};
+
+struct AnomalyDetector {
+    SensorWatch sensors[SENSOR_COUNT];
+    RunningStat bale_interval;     // Normal time between bales (ms)
+    RunningStat flakes_per_bale;   // Normal flakes in a bale
+    uint32_t last_bale_time;
+    bool have_last_bale;
+    uint32_t flakes_since_bale;
+    uint32_t active;                    // Bit mask of currently raised alerts
+    uint32_t acknowledged;              // Acknowledged alerts whose condition hasn't cleared yet
+    uint32_t counts[ANOMALY_COUNT];     // Times each alert was raised (diagnostics)
+    uint32_t total;                     // Total alerts raised
+};
+
+void anomalyInit(AnomalyDetector *ad, uint32_t now_ms);
+
+// Call on every sensor state change (active = sensor ON)
+void anomalyOnEdge(AnomalyDetector *ad, SensorId sensor, bool active, uint32_t now_ms);
+
+// Call on every counted bale with the flakes that went into it
+void anomalyOnBale(AnomalyDetector *ad, uint32_t flakes_in_bale, uint32_t now_ms);
+
+// Call on every counted flake
+void anomalyOnFlake(AnomalyDetector *ad, uint32_t now_ms);
+
+// Call from a periodic timer for the time-based detectors
+void anomalyTick(AnomalyDetector *ad, uint32_t now_ms);
+
+// Clear the active alerts (counts are kept). Each stays quiet, and isn't
+// counted again, until its condition has cleared.
+void anomalyAcknowledge(AnomalyDetector *ad);
+
+const char *anomalyName(AnomalyType type);
+
+#endif // BALECOUNTER_ANOMALY_H
@@ -0,0 +1,225 @@
+// Icons served to LVGL from the memory-mapped "assets" flash partition - see asset_fs.h
+
+#ifdef UI_ASSETS_PARTITION
+
+#include "asset_fs.h"
+#include "asset_pack.h"
+#include <esp_partition.h>
+#include <string.h>
+
+static AssetPack pack;
+static AssetFsStats stats;
+static lv_fs_drv_t fs_drv;
+
+// An open file on drive A: (a read position in a pack entry)
+struct AssetFile {
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t pos;
+};
+
+// Pack entry for an "A:<name>" image source, NULL for anything else
+static const AssetEntry *findImageSource(const void *src) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) {
+        return NULL;
+    }
+    const char *path = (const char *)src;
+    if (path[0] != 'A' || path[1] != ':') {
+        return NULL;
+    }
+    const AssetEntry *entry = assetPackFind(&pack, path + 2);
+    if (entry == NULL || entry->size < sizeof(lv_img_header_t)) {
+        return NULL;
+    }
+    return entry;
+}
+
+// Drive A: - read-only files over the pack entries. The bytes are copied
+// out of the mapped flash, as LVGL's file API expects.
+static void *fsOpen(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode) {
+    if (mode != LV_FS_MODE_RD) {
+        return NULL;
+    }
+    const AssetEntry *entry = assetPackFind(&pack, path);
+    if (entry == NULL) {
+        return NULL;
+    }
+    AssetFile *file = (AssetFile *)lv_mem_alloc(sizeof(AssetFile));
+    if (file == NULL) {
+        return NULL;
+    }
+    file->data = assetPackData(&pack, entry);
+    file->size = entry->size;
+    file->pos = 0;
+    stats.fs_opens++;
+    return file;
+}
+
+static lv_fs_res_t fsClose(lv_fs_drv_t *drv, void *file_p) {
+    lv_mem_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fsRead(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br) {
+    AssetFile *file = (AssetFile *)file_p;
+    uint32_t n = file->size - file->pos;
+    if (btr < n) n = btr;
+    memcpy(buf, file->data + file->pos, n);
+    file->pos += n;
+    *br = n;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fsSeek(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence) {
+    AssetFile *file = (AssetFile *)file_p;
+    if (whence == LV_FS_SEEK_CUR) pos += file->pos;
+    else if (whence == LV_FS_SEEK_END) pos += file->size;
+    if (pos > file->size) {
+        return LV_FS_RES_INV_PARAM;
+    }
+    file->pos = pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fsTell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p) {
+    *pos_p = ((AssetFile *)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+// Decoder - the header is read in place from the mapped flash
+static lv_res_t decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    const AssetEntry *entry = findImageSource(src);
+    if (entry == NULL) {
+        return LV_RES_INV;
+    }
+    memcpy(header, assetPackData(&pack, entry), sizeof(lv_img_header_t));
+    return LV_RES_OK;
+}
+
+// RAM for an icon copy, with its size in front so the close can give it back
+static uint8_t *allocIconCopy(uint32_t size) {
+    if (size > ASSET_RAM_MAX_ICON || stats.ram_used + size > ASSET_RAM_CACHE_BYTES) {
+        return NULL;
+    }
+    uint32_t *block = (uint32_t *)lv_mem_alloc(size + sizeof(uint32_t));
+    if (block == NULL) {
+        return NULL;
+    }
+    block[0] = size;
+    stats.ram_used += size;
+    return (uint8_t *)(block + 1);
+}
+
+// Expand an indexed image (palette + 1-8 bits per pixel) to colour + alpha
+static void decodeIndexed(const lv_img_header_t *header, const uint8_t *src, uint8_t *out) {
+    // INDEXED_1BIT, _2BIT, _4BIT and _8BIT are consecutive
+    uint32_t bits = 1U << (header->cf - LV_IMG_CF_INDEXED_1BIT);
+    const lv_color32_t *palette = (const lv_color32_t *)src;
+    const uint8_t *pixels = src + (1U << bits) * sizeof(lv_color32_t);
+    uint32_t stride = (header->w * bits + 7) / 8;
+    uint32_t mask = (1U << bits) - 1;
+    for (uint32_t y = 0; y < header->h; y++) {
+        const uint8_t *row = pixels + y * stride;
+        for (uint32_t x = 0; x < header->w; x++) {
+            uint32_t bit = x * bits;
+            uint32_t index = (row[bit / 8] >> (8 - bits - bit % 8)) & mask;
+            lv_color32_t c = palette[index];
+            lv_color_t color = lv_color_make(c.ch.red, c.ch.green, c.ch.blue);
+            memcpy(out, &color, sizeof(color));
+            out[sizeof(color)] = c.ch.alpha;
+            out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+}
+
+static lv_res_t decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    const AssetEntry *entry = findImageSource(dsc->src);
+    if (entry == NULL) {
+        return LV_RES_INV;
+    }
+    const uint8_t *pixels = assetPackData(&pack, entry) + sizeof(lv_img_header_t);
+    uint32_t size = entry->size - sizeof(lv_img_header_t);
+    lv_img_cf_t cf = (lv_img_cf_t)dsc->header.cf;
+
+    if (cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+        cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        uint8_t *copy = allocIconCopy(size);
+        if (copy != NULL) {
+            memcpy(copy, pixels, size);
+            dsc->img_data = copy;
+            dsc->user_data = copy;
+            stats.ram_opens++;
+        } else {
+            // Drawn straight from the mapped flash
+            dsc->img_data = pixels;
+            stats.flash_opens++;
+        }
+        return LV_RES_OK;
+    }
+
+    if (cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_INDEXED_8BIT) {
+        // LVGL draws a whole-image buffer as colour + alpha, so indexed icons are expanded
+        uint8_t *copy = allocIconCopy((uint32_t)dsc->header.w * dsc->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        if (copy == NULL) {
+            return LV_RES_INV;  // LVGL's own decoder reads it through drive A: line by line
+        }
+        decodeIndexed(&dsc->header, pixels, copy);
+        dsc->img_data = copy;
+        dsc->user_data = copy;
+        stats.ram_opens++;
+        return LV_RES_OK;
+    }
+    return LV_RES_INV;
+}
+
+static void decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    if (dsc->user_data != NULL) {
+        uint32_t *block = (uint32_t *)dsc->user_data - 1;
+        stats.ram_used -= block[0];
+        lv_mem_free(block);
+        dsc->user_data = NULL;
+    }
+}
+
+bool assetFsInit(void) {
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+    if (part == NULL) {
+        LV_LOG_WARN("no assets partition");
+        return false;
+    }
+    // Mapped through the flash cache like the app's own constants, so reads
+    // are safe on either core while NVS or LittleFS write to flash
+    const void *mapped;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        return false;
+    }
+    if (!assetPackOpen(&pack, (const uint8_t *)mapped, part->size) || pack.color_depth != LV_COLOR_DEPTH) {
+        spi_flash_munmap(handle);
+        pack.count = 0;
+        return false;
+    }
+
+    lv_fs_drv_init(&fs_drv);
+    fs_drv.letter = 'A';
+    fs_drv.open_cb = fsOpen;
+    fs_drv.close_cb = fsClose;
+    fs_drv.read_cb = fsRead;
+    fs_drv.seek_cb = fsSeek;
+    fs_drv.tell_cb = fsTell;
+    lv_fs_drv_register(&fs_drv);
+
+    // Created last, so it is tried before LVGL's built-in decoder
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoderInfo);
+    lv_img_decoder_set_open_cb(decoder, decoderOpen);
+    lv_img_decoder_set_close_cb(decoder, decoderClose);
+    return true;
+}
+
+const AssetFsStats *assetFsStats(void) {
+    return &stats;
+}
+
+#endif // UI_ASSETS_PARTITION
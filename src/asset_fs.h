@@ -0,0 +1,43 @@
+// Icons served to LVGL from the memory-mapped "assets" flash partition
+//
+// Only used in the cyd_assets environment (UI_ASSETS_PARTITION). The icons
+// are left out of the app and packed into their own partition by
+// tools/pack_assets.py, so new artwork is a ~40 KB partition write instead
+// of a full app upload. The UI tables refer to them as "A:<name>.bin".
+//
+// assetFsInit() maps the partition into the data address space and
+// registers two things with LVGL:
+// - drive A:, a read-only LVGL file system over the pack, so any LVGL file
+//   reader (and LVGL's own decoder as a fallback) can open the icons
+// - an image decoder that is tried first for A: images. True-colour icons
+//   are drawn straight from the mapped flash, no copy. Icons small enough
+//   for ASSET_RAM_CACHE_BYTES are copied to RAM once (indexed ones decoded
+//   to colour + alpha), so the hot small icons don't wait on flash cache
+//   misses. LVGL's image cache (LV_IMG_CACHE_DEF_SIZE in lv_conf.h) keeps
+//   the decoded icons open, so this happens once per icon, not per redraw.
+
+#ifndef BALECOUNTER_ASSET_FS_H
+#define BALECOUNTER_ASSET_FS_H
+
+#include <lvgl.h>
+
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40    // Custom data subtype (partitions.csv)
+#define ASSET_RAM_CACHE_BYTES 8192      // RAM for icon copies
+#define ASSET_RAM_MAX_ICON 4096         // Bigger icons are always drawn from flash
+
+struct AssetFsStats {
+    uint32_t ram_used;       // Bytes of icon copies in RAM
+    uint32_t ram_opens;      // Icons opened from a RAM copy
+    uint32_t flash_opens;    // Icons opened in place in the mapped flash
+    uint32_t fs_opens;       // Files opened through drive A:
+};
+
+// Map the assets partition and register drive A: and the decoder.
+// Returns false (and the icons don't show) if the pack is missing, damaged
+// or made for another colour depth.
+bool assetFsInit(void);
+
+const AssetFsStats *assetFsStats(void);
+
+#endif // BALECOUNTER_ASSET_FS_H
@@ -0,0 +1,38 @@
+// Layout of the assets partition image written by tools/pack_assets.py - see asset_pack.h
+
+#include "asset_pack.h"
+#include <string.h>
+
+bool assetPackOpen(AssetPack *pack, const uint8_t *data, uint32_t len) {
+    const AssetPackHeader *header = (const AssetPackHeader *)data;
+    pack->count = 0;
+    if (len < sizeof(AssetPackHeader) || header->magic != ASSET_PACK_MAGIC || header->size > len) {
+        return false;
+    }
+    uint32_t dir_end = sizeof(AssetPackHeader) + (uint32_t)header->count * sizeof(AssetEntry);
+    if (dir_end > header->size) {
+        return false;
+    }
+    const AssetEntry *entries = (const AssetEntry *)(data + sizeof(AssetPackHeader));
+    for (uint16_t i = 0; i < header->count; i++) {
+        const AssetEntry *e = &entries[i];
+        if (e->offset < dir_end || e->offset > header->size || e->size > header->size - e->offset ||
+            memchr(e->name, 0, ASSET_NAME_MAX) == NULL) {
+            return false;
+        }
+    }
+    pack->base = data;
+    pack->entries = entries;
+    pack->count = header->count;
+    pack->color_depth = header->color_depth;
+    return true;
+}
+
+const AssetEntry *assetPackFind(const AssetPack *pack, const char *name) {
+    for (uint16_t i = 0; i < pack->count; i++) {
+        if (strcmp(pack->entries[i].name, name) == 0) {
+            return &pack->entries[i];
+        }
+    }
+    return NULL;
+}
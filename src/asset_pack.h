@@ -0,0 +1,49 @@
+// Layout of the assets partition image written by tools/pack_assets.py
+//
+// A header, a directory of named entries, then each entry's bytes at a
+// 4-byte aligned offset. An image entry is an LVGL .bin image: the 4-byte
+// lv_img_header_t followed by the pixel data, in the same format as the
+// arrays tools/img_convert.py writes. The pack is read in place from the
+// memory-mapped partition, nothing is copied.
+
+#ifndef BALECOUNTER_ASSET_PACK_H
+#define BALECOUNTER_ASSET_PACK_H
+
+#include <stdint.h>
+
+#define ASSET_PACK_MAGIC 0x53414342UL  // "BCAS"
+#define ASSET_NAME_MAX 28              // Including the terminating zero
+
+struct AssetPackHeader {
+    uint32_t magic;
+    uint16_t count;        // Directory entries
+    uint8_t color_depth;   // LV_COLOR_DEPTH the images were converted for
+    uint8_t reserved;
+    uint32_t size;         // Bytes in the pack, header included
+};
+
+struct AssetEntry {
+    char name[ASSET_NAME_MAX];
+    uint32_t offset;       // From the start of the pack
+    uint32_t size;
+};
+
+struct AssetPack {
+    const uint8_t *base;
+    const AssetEntry *entries;
+    uint16_t count;
+    uint8_t color_depth;
+};
+
+// Check the pack at data (len bytes available): magic, and every entry
+// inside the pack. Returns false if it is missing or damaged.
+bool assetPackOpen(AssetPack *pack, const uint8_t *data, uint32_t len);
+
+// Find an entry by name, NULL if not in the pack
+const AssetEntry *assetPackFind(const AssetPack *pack, const char *name);
+
+static inline const uint8_t *assetPackData(const AssetPack *pack, const AssetEntry *entry) {
+    return pack->base + entry->offset;
+}
+
+#endif // BALECOUNTER_ASSET_PACK_H
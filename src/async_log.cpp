@@ -0,0 +1,145 @@
+// Asynchronous levelled logging through a lock-free ring of binary records - see async_log.h
+
+#include "async_log.h"
+#include <stdio.h>
+#include <string.h>
+
+LogRing log_ring;
+static uint32_t (*log_now_ms)(void) = NULL;
+static void (*log_wake)(void) = NULL;
+
+void logRingInit(LogRing *ring) {
+    for (uint32_t i = 0; i < LOG_RING_SIZE; i++) {
+        ring->slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    ring->write_pos.store(0, std::memory_order_relaxed);
+    ring->read_pos = 0;
+    ring->written.store(0, std::memory_order_relaxed);
+    ring->dropped.store(0, std::memory_order_release);
+}
+
+bool logRingPush(LogRing *ring, uint8_t level, const char *fmt, const LogValue *args, uint8_t count,
+                 uint32_t time_ms) {
+    uint32_t pos = ring->write_pos.load(std::memory_order_relaxed);
+    LogSlot *slot;
+    for (;;) {
+        slot = &ring->slots[pos & (LOG_RING_SIZE - 1)];
+        int32_t diff = (int32_t)(slot->seq.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            // The slot is free for pos: claim it, or retry if another writer did
+            if (ring->write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Still holds the record from one lap ago
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = ring->write_pos.load(std::memory_order_relaxed);
+        }
+    }
+    LogRecord *rec = &slot->rec;
+    rec->time_ms = time_ms;
+    rec->fmt = fmt;
+    rec->level = level;
+    rec->count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        rec->args[i] = args[i];
+    }
+    slot->seq.store(pos + 1, std::memory_order_release);
+    ring->written.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool logRingPop(LogRing *ring, LogRecord *out) {
+    LogSlot *slot = &ring->slots[ring->read_pos & (LOG_RING_SIZE - 1)];
+    if (slot->seq.load(std::memory_order_acquire) != ring->read_pos + 1) {
+        return false;
+    }
+    *out = slot->rec;
+    slot->seq.store(ring->read_pos + LOG_RING_SIZE, std::memory_order_release);
+    ring->read_pos++;
+    return true;
+}
+
+// Format one conversion (spec is "%" + flags/width/precision + conv) into out
+static int formatArg(char *out, size_t len, const char *spec, char conv, const LogValue *arg) {
+    switch (conv) {
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+        return snprintf(out, len, spec, (double)arg->f);
+    case 's':
+        return snprintf(out, len, spec, arg->s != NULL ? arg->s : "(null)");
+    case 'd': case 'i': case 'c':
+        return snprintf(out, len, spec, (int)arg->i);
+    default:  // u, x, X, o
+        return snprintf(out, len, spec, (unsigned)arg->u);
+    }
+}
+
+size_t logFormat(const LogRecord *rec, char *buf, size_t len) {
+    static const char level_chars[] = "-EWID";
+    if (len < 2) {
+        return 0;
+    }
+    size_t end = len - 2;  // Room for the newline and the terminating zero
+    int n = snprintf(buf, end + 1, "[%6lu.%03lu] %c ", (unsigned long)(rec->time_ms / 1000),
+                     (unsigned long)(rec->time_ms % 1000), rec->level <= LOG_LEVEL_DEBUG ? level_chars[rec->level] : '?');
+    size_t pos = (n < 0) ? 0 : ((size_t)n > end ? end : (size_t)n);
+
+    uint8_t next_arg = 0;
+    const char *p = rec->fmt;
+    while (*p != 0 && pos < end) {
+        if (*p != '%') {
+            buf[pos++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            buf[pos++] = '%';
+            p += 2;
+            continue;
+        }
+        // Copy "%", flags, width and precision; drop length modifiers
+        char spec[16];
+        size_t s = 0;
+        spec[s++] = *p++;
+        while (*p != 0 && strchr("-+ #0123456789.", *p) != NULL && s < sizeof(spec) - 2) {
+            spec[s++] = *p++;
+        }
+        while (*p == 'l' || *p == 'h' || *p == 'z') {
+            p++;
+        }
+        char conv = *p;
+        if (conv == 0 || strchr("diucxXofFeEgGs", conv) == NULL || next_arg >= rec->count) {
+            // Unknown conversion or a missing argument: show the text as written
+            spec[s] = 0;
+            n = snprintf(buf + pos, end - pos + 1, "%s", spec);
+        } else {
+            spec[s++] = conv;
+            spec[s] = 0;
+            n = formatArg(buf + pos, end - pos + 1, spec, conv, &rec->args[next_arg++]);
+            p++;
+        }
+        if (n > 0) {
+            pos += ((size_t)n > end - pos) ? end - pos : (size_t)n;
+        }
+    }
+    buf[pos++] = '\n';
+    buf[pos] = 0;
+    return pos;
+}
+
+void logInit(uint32_t (*now_ms)(void)) {
+    log_now_ms = now_ms;
+    logRingInit(&log_ring);
+}
+
+void logSetWake(void (*wake)(void)) {
+    log_wake = wake;
+}
+
+void logPush(uint8_t level, const char *fmt, const LogValue *args, uint8_t count) {
+    logRingPush(&log_ring, level, fmt, args, count, log_now_ms != NULL ? log_now_ms() : 0);
+    if (log_wake != NULL) {
+        log_wake();
+    }
+}
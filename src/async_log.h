@@ -0,0 +1,132 @@
+// Asynchronous levelled logging through a lock-free ring of binary records
+//
+// LOG_ERROR/WARN/INFO/DEBUG("Bale count %d", n) don't format anything on
+// the calling task. They store the format string's address, the level, a
+// timestamp and up to LOG_MAX_ARGS raw 32-bit arguments in a fixed-size
+// record, and return. A low-priority task (serialTask() in main.cpp), woken
+// through logSetWake(), pops the records, formats them with logFormat() and
+// writes them to Serial. When the ring is full the record is dropped and
+// counted, so a slow UART never stalls the counting.
+//
+// Levels above LOG_LEVEL compile to nothing, arguments included. Set it
+// with -DLOG_LEVEL=LOG_LEVEL_DEBUG in build_flags for the detailed output.
+//
+// The ring is a bounded multi-producer queue (a sequence number per slot),
+// so any task can log without a lock. Only one task may pop. Not from an
+// ISR: the LOG_* macros read the clock through log_now_ms and call the wake
+// hook, which wakes a task and may be flash code.
+// The format string and any %s argument are stored as pointers, so they
+// must be string literals or other strings that live for the whole run.
+
+#ifndef BALECOUNTER_ASYNC_LOG_H
+#define BALECOUNTER_ASYNC_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE 64      // Records, power of two
+#define LOG_MAX_ARGS 4
+#define LOG_LINE_MAX 128      // Longest formatted line, newline included
+
+union LogValue {
+    int32_t i;
+    uint32_t u;
+    float f;
+    const char *s;
+};
+
+struct LogRecord {
+    uint32_t time_ms;
+    const char *fmt;
+    uint8_t level;
+    uint8_t count;                 // Arguments used
+    LogValue args[LOG_MAX_ARGS];
+};
+
+struct LogSlot {
+    std::atomic<uint32_t> seq;     // Ready for the writer at pos, the reader at pos + 1
+    LogRecord rec;
+};
+
+struct LogRing {
+    LogSlot slots[LOG_RING_SIZE];
+    std::atomic<uint32_t> write_pos;
+    uint32_t read_pos;              // Only the draining task
+    std::atomic<uint32_t> written;
+    std::atomic<uint32_t> dropped;  // Records lost because the ring was full
+};
+
+void logRingInit(LogRing *ring);
+
+// Add a record (any task or ISR). Returns false and counts a drop if full.
+bool logRingPush(LogRing *ring, uint8_t level, const char *fmt, const LogValue *args, uint8_t count, uint32_t time_ms);
+
+// Take the oldest record (the draining task only). False if empty.
+bool logRingPop(LogRing *ring, LogRecord *out);
+
+// Format a record as "[   12.345] I message\n". Returns the length, cut
+// to fit len. %d %i %u %x %X %c %s %f %e %g with flags, width and precision
+// are supported; an 'l' length is accepted and ignored (arguments are 32-bit).
+size_t logFormat(const LogRecord *rec, char *buf, size_t len);
+
+// The ring the LOG_* macros write to, its clock and its wake hook
+extern LogRing log_ring;
+void logInit(uint32_t (*now_ms)(void));
+// Called after every logPush(), kept or dropped, to wake the draining task
+void logSetWake(void (*wake)(void));
+void logPush(uint8_t level, const char *fmt, const LogValue *args, uint8_t count);
+
+static inline LogValue logArg(int v) { LogValue a; a.i = (int32_t)v; return a; }
+static inline LogValue logArg(unsigned v) { LogValue a; a.u = (uint32_t)v; return a; }
+static inline LogValue logArg(long v) { LogValue a; a.i = (int32_t)v; return a; }
+static inline LogValue logArg(unsigned long v) { LogValue a; a.u = (uint32_t)v; return a; }
+static inline LogValue logArg(bool v) { LogValue a; a.i = v; return a; }
+static inline LogValue logArg(char v) { LogValue a; a.i = v; return a; }
+static inline LogValue logArg(float v) { LogValue a; a.f = v; return a; }
+static inline LogValue logArg(double v) { LogValue a; a.f = (float)v; return a; }
+static inline LogValue logArg(const char *v) { LogValue a; a.s = v; return a; }
+
+static inline void logWrite(uint8_t level, const char *fmt) {
+    logPush(level, fmt, NULL, 0);
+}
+
+template <typename... Args>
+static inline void logWrite(uint8_t level, const char *fmt, Args... args) {
+    static_assert(sizeof...(args) <= LOG_MAX_ARGS, "too many log arguments");
+    const LogValue values[] = {logArg(args)...};
+    logPush(level, fmt, values, sizeof...(args));
+}
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) logWrite(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#endif // BALECOUNTER_ASYNC_LOG_H
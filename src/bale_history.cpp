@@ -0,0 +1,99 @@
+// Season bale history: one fixed-size record per bale, read through a small cache - see bale_history.h
+
+#include "bale_history.h"
+#include <stdio.h>
+
+void baleRecordMake(BaleRecord *rec, uint32_t time_s, int64_t prev_time_s, int flakes) {
+    rec->time_s = time_s;
+    rec->flakes = flakes < 0 ? 0 : (flakes > 0xFFFF ? 0xFFFF : (uint16_t)flakes);
+    if (prev_time_s < 0) {
+        rec->interval_s = BALE_INTERVAL_UNKNOWN;
+    } else {
+        int64_t interval = (int64_t)time_s - prev_time_s;
+        // 0 means unknown, so a sub-second interval is stored as 1 s
+        if (interval < 1) interval = 1;
+        rec->interval_s = interval > BALE_INTERVAL_MAX ? BALE_INTERVAL_MAX : (uint16_t)interval;
+    }
+}
+
+void baleRecordFormatTime(const BaleRecord *rec, char *buf, size_t size) {
+    uint32_t minutes = rec->time_s / 60;
+    snprintf(buf, size, "%lu:%02lu", (unsigned long)(minutes / 60), (unsigned long)(minutes % 60));
+}
+
+void baleRecordFormatFlakes(const BaleRecord *rec, char *buf, size_t size) {
+    snprintf(buf, size, "%u", (unsigned)rec->flakes);
+}
+
+void baleRecordFormatInterval(const BaleRecord *rec, char *buf, size_t size) {
+    if (rec->interval_s == BALE_INTERVAL_UNKNOWN) {
+        snprintf(buf, size, "-");
+    } else if (rec->interval_s == BALE_INTERVAL_MAX) {
+        snprintf(buf, size, "long");
+    } else if (rec->interval_s >= 3600) {
+        snprintf(buf, size, "%u:%02u:%02u", rec->interval_s / 3600, rec->interval_s / 60 % 60, rec->interval_s % 60);
+    } else {
+        snprintf(buf, size, "%u:%02u", rec->interval_s / 60, rec->interval_s % 60);
+    }
+}
+
+void historyCacheInit(HistoryCache *hc, HistoryLoadFn load, void *ctx) {
+    hc->load = load;
+    hc->ctx = ctx;
+    hc->loads = 0;
+    historyCacheInvalidate(hc);
+}
+
+void historyCacheInvalidate(HistoryCache *hc) {
+    hc->first = 0;
+    hc->count = 0;
+}
+
+bool historyCacheGet(HistoryCache *hc, uint32_t index, BaleRecord *out) {
+    if (index - hc->first >= hc->count) {  // Also true for index < first
+        // Centre the window on the miss, so scrolling either way has rows ready
+        uint32_t first = index > HISTORY_CACHE_RECORDS / 2 ? index - HISTORY_CACHE_RECORDS / 2 : 0;
+        hc->first = first;
+        hc->count = hc->load(hc->ctx, first, hc->records, HISTORY_CACHE_RECORDS);
+        hc->loads++;
+        if (index - hc->first >= hc->count) {
+            return false;
+        }
+    }
+    *out = hc->records[index - hc->first];
+    return true;
+}
+
+void historyQueueInit(HistoryQueue *q) {
+    q->head.store(0);
+    q->tail.store(0);
+    q->dropped.store(0);
+    q->clears.store(0);
+}
+
+bool historyQueuePush(HistoryQueue *q, const BaleRecord *rec) {
+    uint32_t head = q->head.load(std::memory_order_relaxed);
+    if (head - q->tail.load(std::memory_order_acquire) >= HISTORY_QUEUE_SIZE) {
+        q->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    HistoryQueueEntry *entry = &q->entries[head & (HISTORY_QUEUE_SIZE - 1)];
+    entry->rec = *rec;
+    entry->epoch = q->clears.load(std::memory_order_relaxed);
+    q->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void historyQueueClear(HistoryQueue *q) {
+    q->clears.fetch_add(1, std::memory_order_release);
+}
+
+bool historyQueuePop(HistoryQueue *q, HistoryQueueEntry *out) {
+    uint32_t tail = q->tail.load(std::memory_order_relaxed);
+    if (tail == q->head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    *out = q->entries[tail & (HISTORY_QUEUE_SIZE - 1)];
+    q->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,88 @@
+// Season bale history: one fixed-size record per bale, read through a small cache
+//
+// Records are appended to a file in bale order, so record i is at byte
+// i * sizeof(BaleRecord) and any row can be read with one seek. The list
+// screen reads through a HistoryCache holding a window of records around
+// the rows on screen, so scrolling one row rarely touches the file.
+// The sensor task never writes the file itself: it queues each record on a
+// HistoryQueue and a lower priority task appends them, so a slow flash
+// write or a long read of the file can't hold up the counting.
+// Times are on the season clock: seconds the counter has been running since
+// the season started, carried on from the last bale after a restart (the
+// CYD has no real-time clock).
+
+#ifndef BALECOUNTER_BALE_HISTORY_H
+#define BALECOUNTER_BALE_HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#define BALE_INTERVAL_UNKNOWN 0      // First bale of the season or after a restart
+#define BALE_INTERVAL_MAX 0xFFFF     // Longer intervals are stored as this
+#define HISTORY_CACHE_RECORDS 32
+#define HISTORY_QUEUE_SIZE 16        // Records, power of two
+
+struct BaleRecord {
+    uint32_t time_s;       // Season clock when the bale was counted
+    uint16_t flakes;       // Flakes in the bale
+    uint16_t interval_s;   // Seconds since the previous bale
+};
+
+// Build the record for a bale counted at time_s (prev_time_s < 0: no previous bale)
+void baleRecordMake(BaleRecord *rec, uint32_t time_s, int64_t prev_time_s, int flakes);
+
+// Format the columns of a record: season clock "h:mm", flakes and interval "m:ss"
+void baleRecordFormatTime(const BaleRecord *rec, char *buf, size_t size);
+void baleRecordFormatFlakes(const BaleRecord *rec, char *buf, size_t size);
+void baleRecordFormatInterval(const BaleRecord *rec, char *buf, size_t size);
+
+// Reads up to n records starting at record first, returns how many were read
+typedef uint32_t (*HistoryLoadFn)(void *ctx, uint32_t first, BaleRecord *out, uint32_t n);
+
+struct HistoryCache {
+    BaleRecord records[HISTORY_CACHE_RECORDS];
+    uint32_t first;        // Record number of records[0]
+    uint32_t count;        // Records held
+    HistoryLoadFn load;
+    void *ctx;
+    uint32_t loads;        // Times the cache was refilled (for profiling)
+};
+
+void historyCacheInit(HistoryCache *hc, HistoryLoadFn load, void *ctx);
+
+// Drop the cached records (the file was cleared)
+void historyCacheInvalidate(HistoryCache *hc);
+
+// Get a record, refilling the cache with the window around it on a miss.
+// Returns false if the record can't be read.
+bool historyCacheGet(HistoryCache *hc, uint32_t index, BaleRecord *out);
+
+// A record waiting to be written, or a request to clear the history
+struct HistoryQueueEntry {
+    BaleRecord rec;
+    uint32_t epoch;        // Clears requested before it was queued
+};
+
+// Records from the sensor task to the task writing the file
+struct HistoryQueue {
+    HistoryQueueEntry entries[HISTORY_QUEUE_SIZE];
+    std::atomic<uint32_t> head;       // Next write (producer)
+    std::atomic<uint32_t> tail;       // Next read (consumer)
+    std::atomic<uint32_t> dropped;    // Records lost because the queue was full
+    std::atomic<uint32_t> clears;     // Clears requested (producer)
+};
+
+void historyQueueInit(HistoryQueue *q);
+
+// Queue a record (one producer task). False and a drop if full.
+bool historyQueuePush(HistoryQueue *q, const BaleRecord *rec);
+
+// Ask the consumer to clear the history. Records queued before this are
+// dropped instead of written. Never fails.
+void historyQueueClear(HistoryQueue *q);
+
+// Take the oldest record (one consumer task). False if empty.
+bool historyQueuePop(HistoryQueue *q, HistoryQueueEntry *out);
+
+#endif // BALECOUNTER_BALE_HISTORY_H
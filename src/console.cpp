@@ -0,0 +1,97 @@
+// Serial command console: line input, arguments and the history export format - see console.h
+
+#include "console.h"
+#include <stdio.h>
+#include <string.h>
+
+void consoleInputInit(ConsoleInput *in) {
+    in->len = 0;
+    in->cutting = false;
+    in->overflow = false;
+    in->line[0] = 0;
+}
+
+bool consoleInputFeed(ConsoleInput *in, char c) {
+    if (c == '\r' || c == '\n') {
+        if (in->len == 0 && !in->cutting) {
+            return false;  // Empty line, or the LF of a CR LF
+        }
+        in->line[in->len] = 0;
+        in->len = 0;
+        in->overflow = in->cutting;
+        in->cutting = false;
+        return true;
+    }
+    if (c == '\b' || c == 0x7F) {
+        if (in->len > 0) {
+            in->len--;
+        }
+    } else if (in->len < CONSOLE_LINE_MAX - 1) {
+        in->line[in->len++] = c;
+    } else {
+        in->cutting = true;
+    }
+    return false;
+}
+
+int consoleSplit(char *line, char **argv, int max) {
+    int argc = 0;
+    char *p = line;
+    while (argc < max) {
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (*p == 0) {
+            break;
+        }
+        argv[argc++] = p;
+        while (*p != 0 && *p != ' ' && *p != '\t') {
+            p++;
+        }
+        if (*p != 0) {
+            *p++ = 0;
+        }
+    }
+    return argc;
+}
+
+bool consoleParseU32(const char *text, uint32_t *out) {
+    uint64_t value = 0;
+    if (*text == 0) {
+        return false;
+    }
+    for (; *text != 0; text++) {
+        if (*text < '0' || *text > '9') {
+            return false;
+        }
+        value = value * 10 + (uint32_t)(*text - '0');
+        if (value > 0xFFFFFFFFULL) {
+            return false;
+        }
+    }
+    *out = (uint32_t)value;
+    return true;
+}
+
+// Reflected CRC-32 (polynomial 0xEDB88320), four bits at a time
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len) {
+    static const uint32_t nibble_table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len-- > 0) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ nibble_table[crc & 0x0F];
+        crc = (crc >> 4) ^ nibble_table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+size_t historyChunkEncode(char *buf, uint32_t first, const BaleRecord *records, uint32_t count) {
+    size_t bytes = count * sizeof(BaleRecord);
+    int n = snprintf(buf, HISTORY_CHUNK_HEADER_MAX, "@chunk %lu %lu %08lx\n", (unsigned long)first,
+                     (unsigned long)count, (unsigned long)crc32Update(0, records, bytes));
+    memcpy(buf + n, records, bytes);
+    return n + bytes;
+}
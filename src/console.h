@@ -0,0 +1,56 @@
+// Serial command console: line input, arguments and the history export format
+//
+// The console reads commands a line at a time from the Serial port, such as
+// "status", "target 120" or "history 500" (see runConsoleCommand() in
+// main.cpp). Replies are lines starting with '@' and end with "@ok" or
+// "@err <reason>", so a host can pick them out from the log lines.
+//
+// "history <cursor>" streams the season history from record <cursor> on, in
+// chunks of up to HISTORY_CHUNK_RECORDS records. Each chunk is a header line
+//     @chunk <first> <count> <crc32>\n
+// followed by exactly count * 8 bytes: the BaleRecords as stored, little
+// endian. The CRC is the zlib CRC-32 of those bytes, in hex. A host that
+// gets a bad chunk asks again from that chunk's first record, and a host
+// that has already synced asks only for the records after its last one.
+
+#ifndef BALECOUNTER_CONSOLE_H
+#define BALECOUNTER_CONSOLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bale_history.h"
+
+#define CONSOLE_LINE_MAX 64
+#define CONSOLE_MAX_ARGS 4
+#define HISTORY_CHUNK_RECORDS 64
+#define HISTORY_CHUNK_HEADER_MAX 40
+#define HISTORY_CHUNK_MAX (HISTORY_CHUNK_HEADER_MAX + HISTORY_CHUNK_RECORDS * sizeof(BaleRecord))
+
+struct ConsoleInput {
+    char line[CONSOLE_LINE_MAX];
+    uint8_t len;
+    bool cutting;     // The line being received is too long
+    bool overflow;    // The completed line was longer than CONSOLE_LINE_MAX - 1 and was cut
+};
+
+void consoleInputInit(ConsoleInput *in);
+
+// Add a received character. Returns true when a non-empty line is complete;
+// it is then in in->line, zero-terminated, until the next call. CR, LF or
+// both end a line, and backspace removes a character.
+bool consoleInputFeed(ConsoleInput *in, char c);
+
+// Split a line in place at spaces. Returns the number of words (at most max).
+int consoleSplit(char *line, char **argv, int max);
+
+// Parse a whole unsigned decimal number. False if text isn't one.
+bool consoleParseU32(const char *text, uint32_t *out);
+
+// zlib-compatible CRC-32: start with crc = 0, feed the data in any pieces
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len);
+
+// Write one history chunk (header line and records) into buf, which needs
+// HISTORY_CHUNK_MAX bytes. Returns the bytes written.
+size_t historyChunkEncode(char *buf, uint32_t first, const BaleRecord *records, uint32_t count);
+
+#endif // BALECOUNTER_CONSOLE_H
@@ -0,0 +1,73 @@
+// Fixed-extent numeric label made of right-aligned character cells - see digit_label.h
+
+#include "digit_label.h"
+#include <string.h>
+
+// Widest glyph a numeric label can show, so every cell has the same width
+static lv_coord_t widestNumericGlyph(const lv_font_t *font) {
+    const char *chars = "0123456789.-";
+    lv_coord_t widest = 0;
+    for (const char *c = chars; *c != '\0'; c++) {
+        lv_coord_t w = lv_font_get_glyph_width(font, (uint32_t)*c, 0);
+        if (w > widest) {
+            widest = w;
+        }
+    }
+    return widest;
+}
+
+void digitLabelReplace(DigitLabel *dl, lv_obj_t *label, uint8_t cell_count) {
+    if (cell_count > DIGIT_LABEL_MAX_CELLS) {
+        cell_count = DIGIT_LABEL_MAX_CELLS;
+    }
+    const lv_font_t *font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_coord_t cell_width = widestNumericGlyph(font);
+    lv_coord_t cell_height = lv_font_get_line_height(font);
+
+    dl->cell_count = cell_count;
+    dl->box = lv_obj_create(lv_obj_get_parent(label));
+    lv_obj_remove_style_all(dl->box);
+    lv_obj_set_size(dl->box, cell_width * cell_count, cell_height);
+    lv_obj_set_align(dl->box, lv_obj_get_style_align(label, LV_PART_MAIN));
+    lv_obj_set_pos(dl->box, lv_obj_get_style_x(label, LV_PART_MAIN), lv_obj_get_style_y(label, LV_PART_MAIN));
+    lv_obj_set_style_text_font(dl->box, font, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_clear_flag(dl->box, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    for (uint8_t i = 0; i < cell_count; i++) {
+        dl->cell_text[i][0] = '\0';
+        dl->cell_text[i][1] = '\0';
+        lv_obj_t *cell = lv_label_create(dl->box);
+        lv_obj_set_size(cell, cell_width, cell_height);
+        lv_obj_set_pos(cell, cell_width * i, 0);
+        lv_obj_set_style_text_align(cell, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_label_set_long_mode(cell, LV_LABEL_LONG_CLIP);
+        lv_label_set_text_static(cell, dl->cell_text[i]);
+        dl->cells[i] = cell;
+    }
+
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+}
+
+void digitLabelFixExtent(lv_obj_t *label, uint8_t cell_count) {
+    const lv_font_t *font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_obj_set_size(label, widestNumericGlyph(font) * cell_count, lv_font_get_line_height(font));
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+}
+
+void digitLabelSetText(DigitLabel *dl, const char *text) {
+    size_t len = strlen(text);
+    if (len > dl->cell_count) {
+        text += len - dl->cell_count;
+        len = dl->cell_count;
+    }
+    uint8_t blank = dl->cell_count - (uint8_t)len;
+
+    for (uint8_t i = 0; i < dl->cell_count; i++) {
+        char c = (i < blank) ? '\0' : text[i - blank];
+        if (dl->cell_text[i][0] != c) {
+            dl->cell_text[i][0] = c;
+            lv_label_set_text_static(dl->cells[i], dl->cell_text[i]);
+        }
+    }
+}
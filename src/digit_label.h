@@ -0,0 +1,35 @@
+// Fixed-extent numeric label made of right-aligned character cells
+//
+// A normal LV_SIZE_CONTENT label changes width when a count goes from 9 to
+// 10, so LVGL re-lays it out and redraws both the old and new extents. A
+// DigitLabel has a fixed size and one small label per character cell, each
+// as wide as the widest digit. Changing one digit only touches that cell.
+// Cell texts are stored in the struct, so updates never allocate.
+
+#ifndef BALECOUNTER_DIGIT_LABEL_H
+#define BALECOUNTER_DIGIT_LABEL_H
+
+#include <lvgl.h>
+
+#define DIGIT_LABEL_MAX_CELLS 8
+
+struct DigitLabel {
+    lv_obj_t *box;                              // Fixed-size, unstyled container
+    lv_obj_t *cells[DIGIT_LABEL_MAX_CELLS];     // One label per character, left to right
+    char cell_text[DIGIT_LABEL_MAX_CELLS][2];   // Text each cell shows ("" = blank)
+    uint8_t cell_count;
+};
+
+// Take over an existing label's parent, font, alignment and position with
+// cell_count cells. The original label is hidden.
+void digitLabelReplace(DigitLabel *dl, lv_obj_t *label, uint8_t cell_count);
+
+// Give a plain label a fixed size of cell_count digit cells with centered
+// text, so changing its text never changes its layout
+void digitLabelFixExtent(lv_obj_t *label, uint8_t cell_count);
+
+// Show text right-aligned in the cells. Only cells whose character changed
+// are updated. Text longer than the label shows its last cell_count characters.
+void digitLabelSetText(DigitLabel *dl, const char *text);
+
+#endif // BALECOUNTER_DIGIT_LABEL_H
@@ -0,0 +1,19 @@
+// Ring buffer of sensor edges captured by the GPIO interrupt - see edge_ring.h
+
+#include "edge_ring.h"
+
+void edgeRingInit(EdgeRing *ring) {
+    ring->head.store(0);
+    ring->tail.store(0);
+    ring->dropped.store(0);
+}
+
+bool edgeRingPop(EdgeRing *ring, SensorEdge *out) {
+    uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+    if (tail == ring->head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    *out = ring->edges[tail & (EDGE_RING_SIZE - 1)];
+    ring->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,47 @@
+// Ring buffer of sensor edges captured by the GPIO interrupt
+//
+// Single producer (the GPIO ISR) and single consumer (the sensor task).
+// edgeRingPush() is inline so it ends up inside the IRAM_ATTR ISR.
+
+#ifndef BALECOUNTER_EDGE_RING_H
+#define BALECOUNTER_EDGE_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+#define EDGE_RING_SIZE 32  // Power of two
+
+struct SensorEdge {
+    uint32_t time_ms;   // When the pin changed
+    uint8_t sensor;     // SensorId (anomaly.h)
+    uint8_t active;     // Level after the change: 1 = sensor ON (pin LOW)
+};
+
+struct EdgeRing {
+    SensorEdge edges[EDGE_RING_SIZE];
+    std::atomic<uint32_t> head;      // Next slot to write (producer)
+    std::atomic<uint32_t> tail;      // Next slot to read (consumer)
+    std::atomic<uint32_t> dropped;   // Edges lost because the ring was full
+};
+
+void edgeRingInit(EdgeRing *ring);
+
+// Add an edge (ISR). Returns false and counts a drop if the ring is full.
+static inline __attribute__((always_inline)) bool edgeRingPush(EdgeRing *ring, uint32_t time_ms, uint8_t sensor, uint8_t active) {
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= EDGE_RING_SIZE) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    SensorEdge *edge = &ring->edges[head & (EDGE_RING_SIZE - 1)];
+    edge->time_ms = time_ms;
+    edge->sensor = sensor;
+    edge->active = active;
+    ring->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// Take the oldest edge (sensor task). Returns false if the ring is empty.
+bool edgeRingPop(EdgeRing *ring, SensorEdge *out);
+
+#endif // BALECOUNTER_EDGE_RING_H
@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Size: 20 px
+ * Bpp: 4
+ * Generated by tools/make_digit_fonts.py from Montserrat-Regular.ttf (emboldened by 30 units)
+ * Characters:  -./0123456789
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*Only built for env:cyd_digit_fonts (see lv_conf.h)*/
+#ifdef DIGIT_FONTS
+
+#ifndef UI_FONT_DIGITS_20
+#define UI_FONT_DIGITS_20 1
+#endif
+
+#if UI_FONT_DIGITS_20
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+002D "-" */
+    0x05, 0x55, 0x55, 0x32, 0xff, 0xff, 0xfb, 0x18, 0x88, 0x88, 0x60,
+
+    /* U+002E "." */
+    0x03, 0x40, 0x2f, 0xf6, 0x2f, 0xf6, 0x03, 0x50,
+
+    /* U+002F "/" */
+    0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x00, 0xaf, 0x40, 0x00, 0x00,
+    0x1f, 0xd0, 0x00, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x00, 0xbf, 0x30, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x07, 0xf7, 0x00, 0x00, 0x00, 0xcf, 0x20, 0x00, 0x00, 0x2f, 0xc0, 0x00, 0x00, 0x07, 0xf7,
+    0x00, 0x00, 0x00, 0xdf, 0x20, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x08, 0xf6, 0x00, 0x00, 0x00,
+    0xdf, 0x10, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x09, 0xf5, 0x00, 0x00, 0x00, 0xee, 0x10, 0x00,
+    0x00, 0x4f, 0xa0, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+0030 "0" */
+    0x00, 0x00, 0x15, 0x65, 0x20, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0x91, 0x00, 0x00, 0x8f, 0xfa,
+    0x89, 0xef, 0xb0, 0x00, 0x3f, 0xf4, 0x00, 0x02, 0xdf, 0x70, 0x0a, 0xf8, 0x00, 0x00, 0x04, 0xfe,
+    0x00, 0xef, 0x20, 0x00, 0x00, 0x0d, 0xf4, 0x2f, 0xe0, 0x00, 0x00, 0x00, 0xaf, 0x64, 0xfc, 0x00,
+    0x00, 0x00, 0x09, 0xf8, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x9f, 0x82, 0xfe, 0x00, 0x00, 0x00, 0x0a,
+    0xf6, 0x0e, 0xf2, 0x00, 0x00, 0x00, 0xdf, 0x40, 0xaf, 0x80, 0x00, 0x00, 0x4f, 0xe0, 0x03, 0xff,
+    0x40, 0x00, 0x2d, 0xf7, 0x00, 0x08, 0xff, 0xa8, 0x9e, 0xfb, 0x00, 0x00, 0x07, 0xef, 0xff, 0xf9,
+    0x10, 0x00, 0x00, 0x01, 0x56, 0x52, 0x00, 0x00,
+
+    /* U+0031 "1" */
+    0x15, 0x55, 0x55, 0x12, 0xff, 0xff, 0xf3, 0x18, 0x88, 0xef, 0x30, 0x00, 0x0c, 0xf3, 0x00, 0x00,
+    0xcf, 0x30, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xcf, 0x30,
+    0x00, 0x0c, 0xf3, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c,
+    0xf3, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x04, 0x51,
+
+    /* U+0032 "2" */
+    0x00, 0x03, 0x66, 0x51, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xf9, 0x10, 0xaf, 0xfc, 0x88, 0xaf, 0xfa,
+    0x06, 0xd4, 0x00, 0x00, 0x4f, 0xf2, 0x01, 0x00, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x0e,
+    0xf3, 0x00, 0x00, 0x00, 0x05, 0xfd, 0x00, 0x00, 0x00, 0x02, 0xef, 0x60, 0x00, 0x00, 0x02, 0xdf,
+    0x90, 0x00, 0x00, 0x03, 0xef, 0x90, 0x00, 0x00, 0x03, 0xef, 0x90, 0x00, 0x00, 0x03, 0xef, 0x90,
+    0x00, 0x00, 0x03, 0xef, 0x80, 0x00, 0x00, 0x03, 0xef, 0xe8, 0x88, 0x88, 0x88, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x55, 0x55, 0x55, 0x55, 0x54,
+
+    /* U+0033 "3" */
+    0x03, 0x55, 0x55, 0x55, 0x55, 0x50, 0x08, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x05, 0x88, 0x88, 0x88,
+    0xef, 0xb0, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x4f, 0xf3, 0x00, 0x00, 0x00,
+    0x02, 0xef, 0x60, 0x00, 0x00, 0x00, 0x1c, 0xfb, 0x10, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfa, 0x10,
+    0x00, 0x00, 0x28, 0x8a, 0xef, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf5, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x08, 0xf8, 0x0a, 0xb2, 0x00, 0x00, 0x2e, 0xf5, 0x1d, 0xff,
+    0xb8, 0x8a, 0xef, 0xc0, 0x01, 0x9e, 0xff, 0xff, 0xfa, 0x10, 0x00, 0x01, 0x46, 0x65, 0x10, 0x00,
+
+    /* U+0034 "4" */
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5f, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xf6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfc, 0x10, 0x48, 0x30,
+    0x00, 0x00, 0x5f, 0xe2, 0x00, 0x8f, 0x70, 0x00, 0x03, 0xef, 0x40, 0x00, 0x8f, 0x70, 0x00, 0x1d,
+    0xfa, 0x44, 0x44, 0xaf, 0x94, 0x41, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x59, 0x99, 0x99,
+    0x99, 0xdf, 0xc9, 0x92, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x20, 0x00,
+
+    /* U+0035 "5" */
+    0x01, 0x55, 0x55, 0x55, 0x55, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf1, 0x05, 0xfd, 0x88, 0x88, 0x88,
+    0x10, 0x6f, 0x90, 0x00, 0x00, 0x00, 0x08, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x00, 0x00,
+    0x00, 0x0b, 0xfa, 0x88, 0x74, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xfd, 0x40, 0x04, 0x55, 0x55, 0x8c,
+    0xff, 0x30, 0x00, 0x00, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x10, 0x00, 0x00,
+    0x04, 0xfc, 0x6d, 0x30, 0x00, 0x01, 0xcf, 0x8a, 0xff, 0xc9, 0x89, 0xef, 0xe2, 0x07, 0xdf, 0xff,
+    0xff, 0xc2, 0x00, 0x00, 0x35, 0x75, 0x20, 0x00,
+
+    /* U+0036 "6" */
+    0x00, 0x00, 0x03, 0x57, 0x52, 0x00, 0x00, 0x04, 0xcf, 0xff, 0xff, 0xc0, 0x00, 0x6f, 0xfc, 0x87,
+    0x8c, 0xa0, 0x02, 0xff, 0x60, 0x00, 0x00, 0x10, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,
+    0x00, 0x00, 0x00, 0x00, 0x2f, 0xe0, 0x38, 0xaa, 0x72, 0x00, 0x4f, 0xda, 0xff, 0xff, 0xff, 0x60,
+    0x4f, 0xff, 0xb4, 0x23, 0x9f, 0xf4, 0x3f, 0xfb, 0x00, 0x00, 0x08, 0xfa, 0x1f, 0xf6, 0x00, 0x00,
+    0x03, 0xfd, 0x0b, 0xf6, 0x00, 0x00, 0x04, 0xfc, 0x05, 0xfd, 0x10, 0x00, 0x0b, 0xf8, 0x00, 0xaf,
+    0xe8, 0x67, 0xcf, 0xe1, 0x00, 0x08, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x15, 0x66, 0x30, 0x00,
+
+    /* U+0037 "7" */
+    0x35, 0x55, 0x55, 0x55, 0x55, 0x51, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xb8, 0x88, 0x88,
+    0xaf, 0xe1, 0xaf, 0x50, 0x00, 0x00, 0x9f, 0x90, 0xaf, 0x50, 0x00, 0x01, 0xff, 0x20, 0x23, 0x10,
+    0x00, 0x08, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x05, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf6,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x80, 0x00, 0x00, 0x00, 0x02,
+    0xff, 0x10, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x00,
+
+    /* U+0038 "8" */
+    0x00, 0x00, 0x36, 0x65, 0x20, 0x00, 0x00, 0x04, 0xdf, 0xff, 0xff, 0xb2, 0x00, 0x03, 0xff, 0xb7,
+    0x68, 0xdf, 0xd1, 0x00, 0xaf, 0x90, 0x00, 0x01, 0xcf, 0x70, 0x0c, 0xf3, 0x00, 0x00, 0x07, 0xf9,
+    0x00, 0xbf, 0x60, 0x00, 0x00, 0xaf, 0x70, 0x04, 0xff, 0x83, 0x34, 0xaf, 0xe1, 0x00, 0x09, 0xff,
+    0xff, 0xff, 0xf5, 0x00, 0x05, 0xff, 0xda, 0x9a, 0xef, 0xe2, 0x01, 0xef, 0x60, 0x00, 0x01, 0xaf,
+    0xb0, 0x4f, 0xc0, 0x00, 0x00, 0x01, 0xff, 0x15, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xf1, 0x2f, 0xf4,
+    0x00, 0x00, 0x08, 0xfd, 0x00, 0x8f, 0xfa, 0x76, 0x7c, 0xff, 0x40, 0x00, 0x7e, 0xff, 0xff, 0xfd,
+    0x40, 0x00, 0x00, 0x04, 0x66, 0x53, 0x00, 0x00,
+
+    /* U+0039 "9" */
+    0x00, 0x02, 0x56, 0x52, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xa1, 0x00, 0x0c, 0xfd, 0x86, 0x8d,
+    0xfc, 0x10, 0x6f, 0xd1, 0x00, 0x01, 0xbf, 0x80, 0x9f, 0x60, 0x00, 0x00, 0x3f, 0xe0, 0xaf, 0x60,
+    0x00, 0x00, 0x3f, 0xf3, 0x7f, 0xb0, 0x00, 0x00, 0x9f, 0xf5, 0x2e, 0xfa, 0x42, 0x4a, 0xff, 0xf6,
+    0x04, 0xef, 0xff, 0xff, 0xcb, 0xf6, 0x00, 0x16, 0x9a, 0x94, 0x0b, 0xf5, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x01, 0x00, 0x00, 0x04, 0xef, 0x50, 0x07, 0xd9,
+    0x77, 0xbf, 0xf8, 0x00, 0x0a, 0xff, 0xff, 0xfd, 0x60, 0x00, 0x00, 0x25, 0x66, 0x30, 0x00, 0x00,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 84, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 122, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 11, .adv_w = 68, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 19, .adv_w = 107, .box_w = 9, .box_h = 21, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 114, .adv_w = 212, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 218, .adv_w = 116, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 274, .adv_w = 182, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 362, .adv_w = 180, .box_w = 12, .box_h = 16, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 458, .adv_w = 212, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 570, .adv_w = 181, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 658, .adv_w = 195, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 754, .adv_w = 188, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 850, .adv_w = 204, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 954, .adv_w = 195, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 45, .range_length = 13, .glyph_id_start = 2,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_digits_20 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 22,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if UI_FONT_DIGITS_20*/
+
+#endif /*DIGIT_FONTS*/
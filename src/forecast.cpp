@@ -0,0 +1,91 @@
+// Bale target and completion forecast - see forecast.h
+
+#include "forecast.h"
+
+// Recalculate bales remaining from the target and the current count
+static void updateRemaining(BaleForecast *fc, uint32_t bales_done) {
+    fc->remaining = (fc->target > bales_done) ? fc->target - bales_done : 0;
+}
+
+// Recalculate the ETA from the smoothed interval and time since the last bale
+static void updateEta(BaleForecast *fc, uint32_t now_ms) {
+    if (fc->target == 0) {
+        fc->eta_valid = false;
+        fc->eta_ms = 0;
+        return;
+    }
+    if (fc->remaining == 0) {
+        // Target reached
+        fc->eta_valid = true;
+        fc->eta_ms = 0;
+        return;
+    }
+    if (fc->smoothed_interval_ms <= 0.0f || !fc->have_last_bale) {
+        // Need at least one interval to know the rate
+        fc->eta_valid = false;
+        fc->eta_ms = 0;
+        return;
+    }
+
+    // The bale in progress has already used up part of its interval
+    float since_last = (float)(uint32_t)(now_ms - fc->last_bale_time);
+    if (since_last > fc->smoothed_interval_ms) {
+        since_last = fc->smoothed_interval_ms;
+    }
+    float eta = fc->remaining * fc->smoothed_interval_ms - since_last;
+    fc->eta_ms = (eta > 0.0f) ? (uint32_t)eta : 0;
+    fc->eta_valid = true;
+}
+
+void forecastInit(BaleForecast *fc, uint32_t target, uint32_t bales_done) {
+    fc->target = target;
+    fc->smoothed_interval_ms = 0.0f;
+    fc->last_bale_time = 0;
+    fc->have_last_bale = false;
+    fc->intervals_seen = 0;
+    fc->eta_ms = 0;
+    fc->eta_valid = false;
+    updateRemaining(fc, bales_done);
+}
+
+void forecastSetTarget(BaleForecast *fc, uint32_t target, uint32_t bales_done, uint32_t now_ms) {
+    fc->target = target;
+    updateRemaining(fc, bales_done);
+    updateEta(fc, now_ms);
+}
+
+void forecastResetRate(BaleForecast *fc, uint32_t bales_done) {
+    forecastInit(fc, fc->target, bales_done);
+}
+
+void forecastOnBale(BaleForecast *fc, uint32_t bales_done, uint32_t now_ms) {
+    if (fc->have_last_bale) {
+        uint32_t interval = now_ms - fc->last_bale_time;
+
+        // Skip breaks (refuelling, moving fields) so they don't drag the rate down
+        if (interval > 0 && interval <= FORECAST_MAX_INTERVAL_MS) {
+            if (fc->intervals_seen == 0) {
+                fc->smoothed_interval_ms = (float)interval;
+            } else {
+                fc->smoothed_interval_ms += FORECAST_SMOOTHING * ((float)interval - fc->smoothed_interval_ms);
+            }
+            fc->intervals_seen++;
+        }
+    }
+    fc->last_bale_time = now_ms;
+    fc->have_last_bale = true;
+
+    updateRemaining(fc, bales_done);
+    updateEta(fc, now_ms);
+}
+
+void forecastTick(BaleForecast *fc, uint32_t now_ms) {
+    updateEta(fc, now_ms);
+}
+
+float forecastBalesPerHour(const BaleForecast *fc) {
+    if (fc->smoothed_interval_ms <= 0.0f) {
+        return 0.0f;
+    }
+    return 3600000.0f / fc->smoothed_interval_ms;
+}
@@ -0,0 +1,45 @@
+// Bale target and completion forecast
+//
+// Keeps a smoothed bale interval that is updated once per bale, so the
+// remaining-bales count and ETA never need the full bale history.
+
+#ifndef BALECOUNTER_FORECAST_H
+#define BALECOUNTER_FORECAST_H
+
+#include <stdint.h>
+
+// Weight of the newest interval in the smoothed interval (0..1)
+#define FORECAST_SMOOTHING 0.2f
+// Intervals longer than this are treated as a break and not averaged in
+#define FORECAST_MAX_INTERVAL_MS (10UL * 60UL * 1000UL)
+
+struct BaleForecast {
+    uint32_t target;              // Bale target for the current job (0 = no target)
+    uint32_t remaining;           // Bales left to reach the target
+    float smoothed_interval_ms;   // Smoothed time between bales (0 = unknown)
+    uint32_t last_bale_time;      // Time of the most recent bale (ms)
+    bool have_last_bale;          // last_bale_time is valid
+    uint32_t intervals_seen;      // Intervals averaged into smoothed_interval_ms
+    uint32_t eta_ms;              // Estimated time until the target is reached
+    bool eta_valid;               // False until a rate is known
+};
+
+// Start a forecast for a job with the given target and bales already counted
+void forecastInit(BaleForecast *fc, uint32_t target, uint32_t bales_done);
+
+// Change the target without losing the learned rate
+void forecastSetTarget(BaleForecast *fc, uint32_t target, uint32_t bales_done, uint32_t now_ms);
+
+// Forget the learned rate (session reset)
+void forecastResetRate(BaleForecast *fc, uint32_t bales_done);
+
+// Call on every counted bale - O(1)
+void forecastOnBale(BaleForecast *fc, uint32_t bales_done, uint32_t now_ms);
+
+// Call from a low-rate timer to age the ETA between bales - O(1)
+void forecastTick(BaleForecast *fc, uint32_t now_ms);
+
+// Smoothed rate in bales per hour (0 if unknown)
+float forecastBalesPerHour(const BaleForecast *fc);
+
+#endif // BALECOUNTER_FORECAST_H
@@ -0,0 +1,96 @@
+/**
+ * @file lv_conf.h
+ * LVGL configuration for the BaleCounter (LVGL v8.3)
+ *
+ * Found by LVGL through the -I./src/ build flag. Only the settings this
+ * project depends on are listed here; everything else keeps the default
+ * from lv_conf_internal.h.
+ */
+
+/* clang-format off */
+#if 1 /*Set it to "1" to enable content*/
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+/*====================
+   COLOR SETTINGS
+ *====================*/
+
+/*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)
+ *UI_RENDER_8BIT (env:cyd_8bit) renders RGB332 and my_disp_flush() expands it
+ *to RGB565 through a palette LUT*/
+#ifdef UI_RENDER_8BIT
+#define LV_COLOR_DEPTH 8
+#else
+#define LV_COLOR_DEPTH 16
+#endif
+
+/*Render RGB565 in the ILI9341's byte order so my_disp_flush() can DMA the
+ *draw buffer as-is, without swapping every pixel on the CPU.
+ *The image arrays in src/ui/ are byte-swapped to match (SquareLine: "16 bit swap").*/
+#define LV_COLOR_16_SWAP 1
+
+/*=========================
+   MEMORY SETTINGS
+ *=========================*/
+
+/*LVGL's heap is a 48 kB size-class pool that keeps per-size allocation
+ *counts, peak use and fragmentation (see mem_pool.h). Its size is
+ *LVGL_POOL_BYTES there; LV_MEM_SIZE is not used.*/
+#define LV_MEM_CUSTOM 1
+#ifdef ALLOC_PROFILING
+/*env:cyd_alloc_check: count every LVGL allocation on the way to the pool (see alloc_counter.h)*/
+#define LV_MEM_CUSTOM_INCLUDE "alloc_counter.h"
+#define LV_MEM_CUSTOM_ALLOC   allocCountedMalloc
+#define LV_MEM_CUSTOM_FREE    allocCountedFree
+#define LV_MEM_CUSTOM_REALLOC allocCountedRealloc
+#else
+#define LV_MEM_CUSTOM_INCLUDE "mem_pool.h"
+#define LV_MEM_CUSTOM_ALLOC   lvglPoolAlloc
+#define LV_MEM_CUSTOM_FREE    lvglPoolFree
+#define LV_MEM_CUSTOM_REALLOC lvglPoolRealloc
+#endif
+
+#ifdef UI_ASSETS_PARTITION
+/*env:cyd_assets: keep the icons from the assets partition open after their
+ *first draw, so they are not looked up and copied again on every redraw
+ *(see asset_fs.h)*/
+#define LV_IMG_CACHE_DEF_SIZE 8
+#endif
+
+/*====================
+   HAL SETTINGS
+ *====================*/
+
+/*Use Arduino's millis() as the LVGL tick source*/
+#define LV_TICK_CUSTOM 1
+#define LV_TICK_CUSTOM_INCLUDE "Arduino.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
+
+/*==================
+ *   FONT USAGE
+ *===================*/
+
+/*Fonts used by the SquareLine UI*/
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_18 1
+
+#ifdef DIGIT_FONTS
+/*env:cyd_digit_fonts: the 20 px font only shows numbers and the flake slashes,
+ *so it is replaced by a digit-only subset from tools/make_digit_fonts.py
+ *(src/fonts/). The define points the UI's references at the subset.*/
+#define LV_FONT_MONTSERRAT_20 0
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(ui_font_digits_20)
+#define lv_font_montserrat_20 ui_font_digits_20
+#else
+#define LV_FONT_MONTSERRAT_20 1
+#endif
+
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+#endif /*LV_CONF_H*/
+
+#endif /*End of "Content enable"*/
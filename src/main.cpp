@@ -9,6 +9,7 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include <atomic>
 
 /*Using LVGL with Arduino requires some extra steps:
  *Be sure to read the docs here: https://docs.lvgl.io/master/get-started/platforms/arduino.html  */
@@ -18,6 +19,31 @@
 #include "ui.h"
 #include <XPT2046_Touchscreen.h>
 #include <Preferences.h> // include Preferences library for saving bale variables across reboots
+#include <LittleFS.h>    // Season bale history file
+#include "forecast.h"
+#include "anomaly.h"
+#include "rate_estimator.h"
+#include "rate_trend.h"
+#include "bale_history.h"
+#include "virtual_list.h"
+#include "scheduler.h"
+#include "view_model.h"
+#include "alloc_counter.h"
+#include "mem_pool.h"
+#include "async_log.h"
+#include "console.h"
+#include "telemetry.h"
+#include "digit_label.h"
+#include "segment_digits.h"
+#include "power_mode.h"
+#include "edge_ring.h"
+#include "touch_filter.h"
+#include "asset_fs.h"
+#include "palette.h"
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <hal/gpio_ll.h>
 // A library for interfacing with the touch screen
 //
 // Can be installed from the library manager (Search for "XPT2046")
@@ -35,6 +61,18 @@
 #define XPT2046_CS 33    // T_CS
 
 #define BRIGHTNESS_ENABLED // Uncomment to enable brightness control
+#define IDLE_MODE_ENABLED // Comment out to keep the display on all the time
+// #define TOUCH_PROFILING // Uncomment to print touch polls and touch SPI reads per second
+// #define POWER_PROFILING // Uncomment to print time, light sleep and wakeups per minute for each power mode
+#define DISPLAY_DMA_ENABLED // Comment out to flush the display with blocking pushColors()
+// #define DISPLAY_PROFILING // Uncomment to print redraw time and CPU time over Serial
+// #define IMAGE_PROFILING // Uncomment to print the draw time of each icon at boot
+// #define TREND_PROFILING // Uncomment to fill the rate trend with a simulated day at boot and time it
+// #define HISTORY_PROFILING // Uncomment to time history list scrolling and its RAM with 10, 1000 and 100000 bales at boot
+// #define IRAM_PROFILING // Uncomment to print the worst CPU cycles of the sensor ISR, edge counting and display flush, with and without NVS writes
+// #define LOG_PROFILING // Uncomment to compare the cost and worst stall of a Serial print and an async log call at boot
+// #define POOL_PROFILING // Uncomment to replay a long UI session at boot and print LVGL pool use and fragmentation
+// #define SEGMENT_DIGITS_ENABLED // Uncomment to show the bale count in large segment digits
 
 // Bale counting variables
 int bale_count = 0;
@@ -44,11 +82,55 @@ int flake_count_prev1 = 0;  // Previous bale's flake count
 int flake_count_prev2 = 0;  // Two bales ago flake count
 Preferences preferences; // Preferences object for saving bale count across reboots
 
+// Counts as last written to preferences - the persist job only writes keys that changed
+struct SavedCounts {
+    int bale_count;
+    int bale_count_year;
+    int flake_count;
+    int flake_prev1;
+    int flake_prev2;
+};
+SavedCounts saved_counts;
+
 // Bales per hour tracking variables
 unsigned long first_bale_time = 0;  // Time when first bale was detected (in milliseconds)
 unsigned long last_bale_time = 0;   // Time when last bale was detected (in milliseconds)
 int bales_in_session = 0;           // Number of bales counted in current session
 float bales_per_hour = 0.0;         // Calculated bales per hour
+RateEstimator rate_estimator;       // Flake cadence estimate used before bale intervals are known
+RateTrend rate_trend;               // Bales per hour over the session (sensor task)
+portMUX_TYPE rate_trend_lock = portMUX_INITIALIZER_UNLOCKED;  // Held while the UI task copies rate_trend
+
+// Season bale history in LittleFS, one BaleRecord per bale (see bale_history.h)
+#define HISTORY_FILE "/bales.bin"
+#define HISTORY_FREE_MARGIN 8192            // Stop logging before the file system is full
+static bool history_fs_ok = false;
+static SemaphoreHandle_t history_lock = NULL;          // Held while the file is read or written
+static HistoryQueue history_queue;                     // Bales from the sensor task to the serial task
+static std::atomic<uint32_t> history_count(0);         // Records in HISTORY_FILE
+static std::atomic<uint32_t> history_generation(0);    // Changes when the history is cleared
+static uint32_t history_clock_offset_s = 0;  // Season clock minus seconds since boot (wraps)
+static int64_t history_prev_time_s = -1;     // Season clock of the last bale since boot (sensor task)
+static uint32_t history_free_bytes = 0;      // Free space in the file system (serial task)
+static uint32_t history_clears_done = 0;     // Clears carried out (serial task)
+static bool history_full_reported = false;   // (serial task)
+static lv_obj_t *history_screen = NULL;      // Season history screen (UI task, NULL while closed)
+static lv_obj_t *touch_cal_overlay = NULL;   // Touch calibration overlay (UI task, NULL while closed)
+
+// Job target / completion forecast
+BaleForecast forecast;              // Bales remaining and ETA for the current job
+#define FORECAST_TICK_MS 5000       // How often the ETA is aged between bales
+#define TARGET_STEP 10              // Bale target +/- button step
+lv_obj_t *job_target_label = NULL;  // Target value on the Job settings page (NULL while the popup is closed)
+
+// Sensor anomaly detection
+AnomalyDetector anomaly;                 // Stuck sensor / chatter / outlier detectors
+#define ANOMALY_TICK_MS 1000             // How often the time-based detectors run
+lv_obj_t *anomaly_indicator = NULL;      // Warning symbol shown while an alert is active
+uint32_t anomaly_reported = 0;           // Alerts already reported over Serial
+
+// Text shown on the main screen labels (UI task only)
+static ViewModel view_model;
 
 // GPIO 35 for binary input sensor (from your old code)
 #define BALE_SENSOR_PIN 35
@@ -57,14 +139,41 @@ float bales_per_hour = 0.0;         // Calculated bales per hour
 
 SPIClass mySpi = SPIClass(VSPI); // critical to get touch working
 
-XPT2046_Touchscreen ts(XPT2046_CS, XPT2046_IRQ);
+// T_IRQ is handled here (touchIrqIsr), not by the library
+XPT2046_Touchscreen ts(XPT2046_CS);
+
+// Touch filtering and calibration (see touch_filter.h)
+#define TOUCH_POLL_ACTIVE_MS 20    // LVGL touch poll period while the pen is down
+#define TOUCH_POLL_IDLE_MS 250     // Backstop poll period while up - T_IRQ speeds it up
+static TouchFilter touch_filter;
+static TouchCal touch_cal;              // Raw to screen mapping, saved as "touch_cal"
+static TouchCal pending_touch_cal;      // New calibration for CMD_SAVE_TOUCH_CAL
+static int16_t touch_raw_x = 0;         // Last filtered raw point (for calibration)
+static int16_t touch_raw_y = 0;
+static lv_timer_t *touch_read_timer = NULL;  // LVGL's poll timer for the touch driver
 
 /*Change to your screen resolution*/
 static const uint16_t screenWidth = 320;
 static const uint16_t screenHeight = 240;
 
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[screenWidth * screenHeight / 10];
+#ifdef UI_RENDER_8BIT
+// 8-bit (RGB332) draw buffer: twice the pixels in the RAM of one RGB565 buffer
+#define DRAW_BUF_SIZE (screenWidth * screenHeight / 5)
+static lv_color_t buf[DRAW_BUF_SIZE];
+// The flush expands the 8-bit buffer into these RGB565 chunks while streaming
+#define EXPAND_CHUNK_PX (screenWidth * 2)
+static DMA_ATTR uint16_t expand_buf[2][EXPAND_CHUNK_PX];
+static DRAM_ATTR uint16_t palette_lut[PALETTE_SIZE];  // RGB332 -> RGB565 in panel byte order
+#else
+#define DRAW_BUF_SIZE (screenWidth * screenHeight / 10)
+// Two draw buffers in DMA-capable internal RAM: LVGL renders into one
+// while the other is being sent to the panel
+static DMA_ATTR lv_color_t buf[DRAW_BUF_SIZE];
+#ifdef DISPLAY_DMA_ENABLED
+static DMA_ATTR lv_color_t buf2[DRAW_BUF_SIZE];
+#endif
+#endif
 
 TFT_eSPI tft = TFT_eSPI(screenWidth, screenHeight); /* TFT instance */
 
@@ -77,108 +186,894 @@ void my_print(const char *buf)
 }
 #endif
 
+#ifdef DISPLAY_PROFILING
+static uint32_t flush_wait_start = 0;   // micros() when LVGL started waiting for the DMA
+static uint32_t flush_wait_us = 0;      // Time LVGL spent waiting on the panel this redraw
+static uint32_t label_updates = 0;      // Labels set from the view-model this second
+static uint32_t redraw_px = 0;          // Pixels redrawn this second
+static uint32_t flush_px = 0;           // Pixels pushed to the panel this redraw
+static uint32_t flush_areas = 0;        // Areas flushed this redraw
+// Goal for a counting redraw: a few digit cells (about 13x22 px each with Montserrat 20)
+#define REDRAW_TARGET_PX 2048
+#endif
+
+#ifdef IRAM_PROFILING
+// Worst-case CPU cycles of the hot paths. A flash write stops the flash
+// cache (and leaves it cold), so samples taken during an NVS write, or the
+// first one after it, are kept apart. The sensor ISR runs from IRAM and
+// should show about the same worst case either way; the task-side paths
+// call into flash code and show what a write costs them.
+#define IRAM_REPORT_MS 10000
+#define NVS_STRESS_MS 200   // Scratch NVS write period, so writes overlap the hot paths
+enum CyclePath { CYCLES_ISR, CYCLES_EDGE, CYCLES_BALE, CYCLES_FLUSH, CYCLE_PATH_COUNT };
+struct CycleStat {
+    uint32_t count;
+    uint32_t worst;          // Cycles, no NVS write since the last sample
+    uint32_t count_nvs;
+    uint32_t worst_nvs;      // Cycles, during or first after an NVS write
+    uint32_t seen_write;     // nvs_write_seq at the last sample
+};
+static const char *const cycle_path_names[CYCLE_PATH_COUNT] = {
+    "sensor ISR", "edge count", "bale count", "display flush"};
+static DRAM_ATTR CycleStat cycle_stats[CYCLE_PATH_COUNT];
+static std::atomic<uint32_t> nvs_writes_active(0);
+static std::atomic<uint32_t> nvs_write_seq(0);
+
+// CPU cycle counter (per core), inline so it is safe in the ISR
+static inline __attribute__((always_inline)) uint32_t cycleCount() {
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+
+static inline __attribute__((always_inline)) void cycleStatAdd(CyclePath path, uint32_t start) {
+    uint32_t cycles = cycleCount() - start;
+    CycleStat *st = &cycle_stats[path];
+    uint32_t seq = nvs_write_seq.load(std::memory_order_relaxed);
+    if (nvs_writes_active.load(std::memory_order_relaxed) != 0 || seq != st->seen_write) {
+        st->count_nvs++;
+        if (cycles > st->worst_nvs) st->worst_nvs = cycles;
+    } else {
+        st->count++;
+        if (cycles > st->worst) st->worst = cycles;
+    }
+    st->seen_write = seq;
+}
+
+// Bracket an NVS write (any task)
+void nvsWriteBegin() {
+    nvs_writes_active++;
+}
+
+void nvsWriteEnd() {
+    nvs_writes_active--;
+    nvs_write_seq++;
+}
+#endif
+
+#ifdef UI_RENDER_8BIT
+// Expand RGB332 pixels to RGB565 through palette_lut (see palette.h). In
+// IRAM with its table in DRAM, so the per-pixel loop never waits on a flash
+// cache miss.
+static void IRAM_ATTR expandPalette(uint16_t *dst, const uint8_t *src, uint32_t n)
+{
+    paletteExpand(dst, src, n, palette_lut);
+}
+
+/* Display flushing (8-bit render mode) */
+// Expands the RGB332 buffer through palette_lut one chunk at a time. Each
+// chunk is sent by DMA while the next one is expanded.
+void my_disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
+{
+#ifdef IRAM_PROFILING
+    uint32_t cycles_start = cycleCount();
+#endif
+    uint32_t w = (area->x2 - area->x1 + 1);
+    uint32_t h = (area->y2 - area->y1 + 1);
+#ifdef DISPLAY_PROFILING
+    flush_px += w * h;
+    flush_areas++;
+#endif
+    uint32_t remaining = w * h;
+    const uint8_t *src = &color_p->full;
+    int chunk = 0;
+
+#ifdef DISPLAY_DMA_ENABLED
+    if (tft.getStartCount() == 0) {
+        tft.startWrite();
+    }
+    tft.dmaWait();  // The address window can't change under a running transfer
+#else
+    tft.startWrite();
+#endif
+    tft.setAddrWindow(area->x1, area->y1, w, h);
+
+    while (remaining > 0) {
+        uint32_t n = remaining < EXPAND_CHUNK_PX ? remaining : EXPAND_CHUNK_PX;
+        uint16_t *dst = expand_buf[chunk];
+        expandPalette(dst, src, n);
+#ifdef DISPLAY_DMA_ENABLED
+        tft.pushPixelsDMA(dst, n);  // Waits for the previous chunk first
+        chunk ^= 1;
+#else
+        tft.pushColors(dst, n, false);
+#endif
+        src += n;
+        remaining -= n;
+    }
+
+#ifndef DISPLAY_DMA_ENABLED
+    tft.endWrite();
+#endif
+    // The 8-bit buffer has been fully expanded, so LVGL can reuse it right away
+    lv_disp_flush_ready(disp_drv);
+#ifdef IRAM_PROFILING
+    cycleStatAdd(CYCLES_FLUSH, cycles_start);
+#endif
+}
+#else
 /* Display flushing */
+// LV_COLOR_16_SWAP is set in lv_conf.h, so the draw buffer is already in
+// panel byte order and is sent without a per-pixel swap
 void my_disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
+#ifdef IRAM_PROFILING
+    uint32_t cycles_start = cycleCount();
+#endif
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
+#ifdef DISPLAY_PROFILING
+    flush_px += w * h;
+    flush_areas++;
+#endif
 
+#ifdef DISPLAY_DMA_ENABLED
+    // The display SPI bus is only used by DMA, so it stays claimed
+    if (tft.getStartCount() == 0) {
+        tft.startWrite();
+    }
+    // Returns as soon as the transfer is queued. lv_disp_flush_ready() is
+    // called from my_disp_wait() when the transfer completes.
+    tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t *)&color_p->full);
+#else
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t *)&color_p->full, w * h, true);
+    tft.pushColors((uint16_t *)&color_p->full, w * h, false);
     tft.endWrite();
 
     lv_disp_flush_ready(disp_drv);
+#endif
+#ifdef IRAM_PROFILING
+    cycleStatAdd(CYCLES_FLUSH, cycles_start);
+#endif
+}
+#endif // UI_RENDER_8BIT
+
+#if defined(DISPLAY_DMA_ENABLED) && !defined(UI_RENDER_8BIT)
+/* Called by LVGL while it waits for the previous buffer to be sent */
+void my_disp_wait(lv_disp_drv_t *disp_drv)
+{
+#ifdef DISPLAY_PROFILING
+    if (flush_wait_start == 0) {
+        flush_wait_start = micros();
+    }
+#endif
+    if (!tft.dmaBusy()) {
+        // Transfer complete - hand the buffer back to LVGL
+#ifdef DISPLAY_PROFILING
+        flush_wait_us += micros() - flush_wait_start;
+        flush_wait_start = 0;
+#endif
+        lv_disp_flush_ready(disp_drv);
+    }
+}
+#endif
+
+#ifdef DISPLAY_PROFILING
+/* Called by LVGL after every redraw */
+void my_disp_monitor(lv_disp_drv_t *disp_drv, uint32_t time_ms, uint32_t px)
+{
+    Serial.print("Redraw: ");
+    Serial.print(time_ms);
+    Serial.print(" ms, ");
+    Serial.print(px);
+    Serial.print(" px, CPU ");
+    Serial.print(time_ms - flush_wait_us / 1000);
+    Serial.print(" ms, waiting for panel ");
+    Serial.print(flush_wait_us / 1000);
+    Serial.print(" ms, pushed ");
+    Serial.print(flush_px);
+    Serial.print(" px in ");
+    Serial.print(flush_areas);
+    Serial.println(" areas");
+    flush_wait_us = 0;
+
+    // Once a second: how many labels changed and how much they cost to redraw
+    static uint32_t second_start = 0;
+    static uint32_t unchanged_seen = 0;
+    static uint32_t over_target = 0;
+    redraw_px += px;
+    if (flush_px > REDRAW_TARGET_PX) {
+        over_target++;
+    }
+    flush_px = 0;
+    flush_areas = 0;
+    uint32_t now = millis();
+    if (now - second_start >= 1000) {
+        Serial.print("Per second: ");
+        Serial.print(label_updates);
+        Serial.print(" label updates, ");
+        Serial.print(view_model.unchanged - unchanged_seen);
+        Serial.print(" unchanged skipped, ");
+        Serial.print(redraw_px);
+        Serial.print(" px invalidated, ");
+        Serial.print(over_target);
+        Serial.println(" redraws over target");
+        over_target = 0;
+        label_updates = 0;
+        unchanged_seen = view_model.unchanged;
+        redraw_px = 0;
+        second_start = now;
+    }
+}
+#endif
+
+#if defined(IMAGE_PROFILING) || defined(HISTORY_PROFILING) || defined(POOL_PROFILING)
+/* Discards the rendered pixels so only LVGL's drawing is timed */
+void my_disp_discard(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    lv_disp_flush_ready(disp_drv);
+}
+#endif
+
+#ifdef IMAGE_PROFILING
+#define IMAGE_PROFILE_ROUNDS 20
+
+// Function to time the redraw of one icon and its background
+void profileIconDraw(const char *name, lv_obj_t *icon) {
+    uint32_t start = micros();
+    for (int i = 0; i < IMAGE_PROFILE_ROUNDS; i++) {
+        lv_obj_invalidate(icon);
+        lv_refr_now(NULL);
+    }
+    uint32_t us = (micros() - start) / IMAGE_PROFILE_ROUNDS;
+#ifdef UI_ASSETS_PARTITION
+    // Cold: the icon is opened from the assets partition again on every redraw
+    start = micros();
+    for (int i = 0; i < IMAGE_PROFILE_ROUNDS; i++) {
+        lv_img_cache_invalidate_src(NULL);
+        lv_obj_invalidate(icon);
+        lv_refr_now(NULL);
+    }
+    uint32_t cold_us = (micros() - start) / IMAGE_PROFILE_ROUNDS;
+    Serial.printf("Icon %s: %dx%d, %lu us per redraw, %lu us cold\n", name,
+                  (int)lv_obj_get_width(icon), (int)lv_obj_get_height(icon),
+                  (unsigned long)us, (unsigned long)cold_us);
+#else
+    Serial.printf("Icon %s: %dx%d, %lu us per redraw\n", name,
+                  (int)lv_obj_get_width(icon), (int)lv_obj_get_height(icon), (unsigned long)us);
+#endif
+}
+
+// Function to time each icon's draw at boot, to compare image formats (tools/img_convert.py)
+void profileIconDraws() {
+    lv_disp_drv_t *drv = lv_disp_get_default()->driver;
+    auto flush_cb = drv->flush_cb;
+    auto wait_cb = drv->wait_cb;
+    auto monitor_cb = drv->monitor_cb;
+    drv->flush_cb = my_disp_discard;
+    drv->wait_cb = NULL;
+    drv->monitor_cb = NULL;
+
+    lv_refr_now(NULL);  // Draw the pending first frame outside the measurement
+    profileIconDraw("hay flake", ui_FlakeCountImage);
+    profileIconDraw("hay", ui_BaleCountImage);
+    profileIconDraw("hay time", ui_BaleCountImage1);
+    profileIconDraw("bales per hour", ui_FlakeCountImage1);
+    profileIconDraw("settings", ui_SettingsImgButton);
+#ifdef UI_ASSETS_PARTITION
+    const AssetFsStats *stats = assetFsStats();
+    Serial.printf("Assets: %lu opens from RAM, %lu from flash, %lu through A:, %lu B RAM\n",
+                  (unsigned long)stats->ram_opens, (unsigned long)stats->flash_opens,
+                  (unsigned long)stats->fs_opens, (unsigned long)stats->ram_used);
+#endif
+
+    drv->flush_cb = flush_cb;
+    drv->wait_cb = wait_cb;
+    drv->monitor_cb = monitor_cb;
+    lv_obj_invalidate(lv_scr_act());
 }
+#endif
 
-static unsigned long lastTouchTime = 0;
 static bool touchProcessed = false;
 
 // Brightness control variables
 int current_brightness = 80;  // Start at 80%
 
+// Function to set the backlight PWM from current_brightness (UI task only)
+void applyBrightness() {
+    analogWrite(21, map(current_brightness, 0, 100, 0, 255));
+}
+
+// Task split: LVGL rendering runs on one core, sensor polling, counting and
+// persistence on the other. Only the UI task calls into LVGL.
+// Each task runs its jobs from a Scheduler and sleeps until the next deadline.
+#define UI_TASK_CORE 1
+#define SENSOR_TASK_CORE 0
+#define UI_MAX_SLEEP_MS 50  // Longest the UI task sleeps when LVGL has no timer due
+#define POWER_TICK_MS 1000  // How often the idle timeout is checked
+#define LIGHT_SLEEP_MAX_MS 1000  // Longest single light sleep
+// #define TASK_PROFILING // Uncomment to print per-task CPU load, the worst sensor edge latency and job jitter
+static SemaphoreHandle_t lvgl_mutex = NULL;  // Held while calling into LVGL
+static TaskHandle_t ui_task_handle = NULL;
+static TaskHandle_t sensor_task_handle = NULL;
+static TaskHandle_t serial_task_handle = NULL;
+static Scheduler ui_sched;
+static Scheduler sensor_sched;
+static Scheduler serial_sched;
+static int lvgl_job = -1;     // UI job that renders
+static int touch_job = -1;    // UI job woken by T_IRQ
+static int backlight_job = -1;  // UI job woken when the display sleeps or wakes
+static int command_job = -1;  // Sensor job that runs command_pending
+static int sensor_job = -1;   // Sensor job that drains sensor_edges
+static int persist_job = -1;  // Sensor job that writes changed counts to NVS
+static int history_job = -1;    // Serial job woken by the history queue
+static int console_job = -1;    // Serial job woken by UART RX
+static int telemetry_job = -1;  // Serial job woken by the telemetry queue
+static int log_job = -1;        // Serial job woken by the log ring
+
+// Sensor edges captured by the GPIO interrupts and counted by the sensor task
+static EdgeRing sensor_edges;
+static bool bale_sensor_active = false;   // Last bale sensor level counted (true = ON)
+static bool flake_sensor_active = false;  // Last flake sensor level counted (true = ON)
+// Contact bounce: an edge this soon after the last one counted on the same sensor is ignored
+#define SENSOR_DEBOUNCE_MS 30
+static uint32_t sensor_last_edge_ms[SENSOR_COUNT];  // Time of the last edge counted on each sensor
+static bool sensor_settle_pending = false;          // An edge was ignored, re-read the pins once settled
+static uint32_t sensor_settle_ms;                   // When to re-read them
+
+// Idle mode: display off, LVGL paused, sensor task may light-sleep (see power_mode.h)
+static PowerState power;
+static std::atomic<bool> display_asleep(false);
+static std::atomic<bool> swallow_touch(false);  // Ignore the touch that woke the display
+static uint32_t ui_wakeups[POWER_MODE_COUNT];   // UI task wakeups in each mode
+
+#ifdef TASK_PROFILING
+#define PROFILE_REPORT_MS 10000
+static uint32_t ui_busy_us = 0;             // UI task time spent in LVGL this period
+static uint32_t sensor_busy_us = 0;         // Sensor task time spent working this period
+static uint32_t sensor_max_latency_ms = 0;  // Longest time from a sensor edge to counting it
+#endif
+
+// Display updates requested by the sensor task and applied by the UI task once per frame
+enum DisplayUpdate {
+    DISP_BALE_COUNT = 1 << 0,
+    DISP_BALE_COUNT_YEAR = 1 << 1,
+    DISP_FLAKE_COUNT = 1 << 2,
+    DISP_FLAKE_PREV1 = 1 << 3,
+    DISP_FLAKE_PREV2 = 1 << 4,
+    DISP_BALES_PER_HOUR = 1 << 5,
+    DISP_FORECAST = 1 << 6,
+    DISP_JOB_TARGET = 1 << 7,
+    DISP_ANOMALY = 1 << 8,
+    DISP_RATE_TREND = 1 << 9,
+    DISP_HISTORY = 1 << 10,
+    DISP_ALL = (1 << 11) - 1
+};
+static std::atomic<uint32_t> display_pending(0);
+
+// Commands from the UI task to the sensor task
+enum CountCommand {
+    CMD_RESET_FLAKES = 1 << 0,
+    CMD_RESET_BALES = 1 << 1,
+    CMD_RESET_YEAR = 1 << 2,
+    CMD_SET_TARGET = 1 << 3,
+    CMD_ACK_ANOMALY = 1 << 4,
+    CMD_USER_ACTIVITY = 1 << 5,
+    CMD_SAVE_TOUCH_CAL = 1 << 6,
+    CMD_TARGET_DELTA = 1 << 7
+};
+static std::atomic<uint32_t> command_pending(0);
+static std::atomic<uint32_t> pending_target(0);       // New bale target for CMD_SET_TARGET
+static std::atomic<int32_t> pending_target_delta(0);  // Bale target change for CMD_TARGET_DELTA
+
+// Counts as last published by the sensor task. Other tasks read a copy
+// (readCounts) instead of the sensor task's variables, so they never see a
+// bale half counted.
+struct CountSnapshot {
+    uint32_t bale_count;
+    uint32_t bale_count_year;
+    uint32_t flake_count;
+    uint32_t flake_prev1;
+    uint32_t flake_prev2;
+    uint32_t bales_in_session;
+    float bales_per_hour;
+    uint32_t target;                        // Job bale target (0 = off)
+    uint32_t remaining;
+    uint32_t eta_ms;
+    bool eta_valid;
+    uint32_t alerts_active;                 // Anomaly alert bit mask
+    uint32_t alerts_total;
+    uint32_t alert_counts[ANOMALY_COUNT];
+};
+static CountSnapshot count_snapshot;
+static portMUX_TYPE count_snapshot_lock = portMUX_INITIALIZER_UNLOCKED;  // Held while count_snapshot is copied
+static uint32_t unpublished_updates = 0;  // Display updates waiting for publishCounts() (sensor task)
+
+// Take the LVGL lock - needed for any LVGL call outside the UI task
+void lvglLock() {
+    xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY);
+}
+
+void lvglUnlock() {
+    xSemaphoreGiveRecursive(lvgl_mutex);
+}
+
+// Ask the UI task to refresh some displays before its next frame (sensor task only).
+// The request goes out with the next publishCounts(), so the UI task always
+// formats counts at least as new as the change it was asked to show.
+void requestDisplayUpdate(uint32_t updates) {
+    unpublished_updates |= updates;
+}
+
+// Copy the counts to count_snapshot, then pass on the display updates
+// requested since the last publish (sensor task, after each scheduler run)
+void publishCounts() {
+    if (unpublished_updates == 0) {
+        return;
+    }
+    CountSnapshot snap;
+    snap.bale_count = bale_count;
+    snap.bale_count_year = bale_count_year;
+    snap.flake_count = flake_count;
+    snap.flake_prev1 = flake_count_prev1;
+    snap.flake_prev2 = flake_count_prev2;
+    snap.bales_in_session = bales_in_session;
+    snap.bales_per_hour = bales_per_hour;
+    snap.target = forecast.target;
+    snap.remaining = forecast.remaining;
+    snap.eta_ms = forecast.eta_ms;
+    snap.eta_valid = forecast.eta_valid;
+    snap.alerts_active = anomaly.active;
+    snap.alerts_total = anomaly.total;
+    memcpy(snap.alert_counts, anomaly.counts, sizeof(snap.alert_counts));
+
+    portENTER_CRITICAL(&count_snapshot_lock);
+    count_snapshot = snap;
+    portEXIT_CRITICAL(&count_snapshot_lock);
+    display_pending.fetch_or(unpublished_updates);
+    unpublished_updates = 0;
+}
+
+// Take a consistent copy of the published counts (any task)
+void readCounts(CountSnapshot *out) {
+    portENTER_CRITICAL(&count_snapshot_lock);
+    *out = count_snapshot;
+    portEXIT_CRITICAL(&count_snapshot_lock);
+}
+
+// Ask the sensor task to run a command (safe from any task)
+void postCountCommand(uint32_t command) {
+    command_pending.fetch_or(command);
+    schedWake(&sensor_sched, command_job);
+}
+
+// Ask the sensor task to save the counts (sensor task only)
+void requestCountsSave() {
+    schedWake(&sensor_sched, persist_job);
+}
+
+// Label each view-model field is applied to. Fields with a digit label or
+// segment digits use those instead.
+static lv_obj_t *view_labels[VIEW_FIELD_COUNT];
+static DigitLabel *view_digits[VIEW_FIELD_COUNT];
+static SegmentDigits *view_segments[VIEW_FIELD_COUNT];
+
+// Fixed-extent number displays next to the icons (see digit_label.h)
+static DigitLabel bale_count_digits;
+static DigitLabel bale_count_year_digits;
+static DigitLabel bales_per_hour_digits;
+#define COUNT_DIGITS 6   // Up to 999999 bales
+#define RATE_DIGITS 5    // "9.9" or up to "99999"
+#define FLAKE_DIGITS 3   // Flake counts keep their centered labels, fixed to 3 digits wide
+
+#ifdef SEGMENT_DIGITS_ENABLED
+// Large bale count for reading from the driver's seat (see segment_digits.h)
+static SegmentDigits bale_count_segments;
+#define SEGMENT_COUNT_DIGITS 5    // Up to 99999 bales
+#define SEGMENT_HEIGHT 36         // Fills most of the 50 px row
+#define SEGMENT_CAPTION_X 80      // The caption moves left, next to the icon
+#endif
+
+// Point the view-model fields at their labels (after the UI is created)
+void bindViewLabels() {
+#ifdef SEGMENT_DIGITS_ENABLED
+    segmentDigitsReplace(&bale_count_segments, uiCYD_BaleCount, SEGMENT_COUNT_DIGITS, SEGMENT_HEIGHT);
+    lv_obj_set_x(bale_count_segments.box, -8);
+    lv_obj_set_align(uiCYD_BaleCountLabel, LV_ALIGN_LEFT_MID);
+    lv_obj_set_x(uiCYD_BaleCountLabel, SEGMENT_CAPTION_X);
+    view_segments[VIEW_BALE_COUNT] = &bale_count_segments;
+#else
+    digitLabelReplace(&bale_count_digits, uiCYD_BaleCount, COUNT_DIGITS);
+    view_digits[VIEW_BALE_COUNT] = &bale_count_digits;
+#endif
+    digitLabelReplace(&bale_count_year_digits, uiCYD_BaleCountYear, COUNT_DIGITS);
+    digitLabelReplace(&bales_per_hour_digits, uiCYD_BaleCountHour, RATE_DIGITS);
+    view_digits[VIEW_BALE_COUNT_YEAR] = &bale_count_year_digits;
+    view_digits[VIEW_BALES_PER_HOUR] = &bales_per_hour_digits;
+
+    digitLabelFixExtent(uiCYD_FlakeCountCurrent, FLAKE_DIGITS);
+    digitLabelFixExtent(uiCYD_FlakeCountPrev1, FLAKE_DIGITS);
+    digitLabelFixExtent(uiCYD_FlakeCountPrev2, FLAKE_DIGITS);
+
+    view_labels[VIEW_FLAKE_COUNT] = uiCYD_FlakeCountCurrent;
+    view_labels[VIEW_FLAKE_PREV1] = uiCYD_FlakeCountPrev1;
+    view_labels[VIEW_FLAKE_PREV2] = uiCYD_FlakeCountPrev2;
+    view_labels[VIEW_FORECAST] = uiCYD_BaleCountLabel;
+    // VIEW_JOB_TARGET is bound while the settings popup is open (openSettingsPopup)
+}
+
 // Function to update the bale count display on the UI
-void updateBaleCountDisplay() {
+void updateBaleCountDisplay(const CountSnapshot *counts) {
     char count_buf[16];
-    lv_snprintf(count_buf, sizeof(count_buf), "%d", bale_count);
-    lv_label_set_text(uiCYD_BaleCount, count_buf);
+    lv_snprintf(count_buf, sizeof(count_buf), "%lu", (unsigned long)counts->bale_count);
+    viewSetText(&view_model, VIEW_BALE_COUNT, count_buf);
 }
 
 // Function to update the yearly bale count display on the UI
-void updateBaleCountYearDisplay() {
+void updateBaleCountYearDisplay(const CountSnapshot *counts) {
     char count_buf[16];
-    lv_snprintf(count_buf, sizeof(count_buf), "%d", bale_count_year);
-    lv_label_set_text(uiCYD_BaleCountYear, count_buf);
+    lv_snprintf(count_buf, sizeof(count_buf), "%lu", (unsigned long)counts->bale_count_year);
+    viewSetText(&view_model, VIEW_BALE_COUNT_YEAR, count_buf);
 }
 
 // Function to update the flake count display on the UI
-void updateFlakeCountDisplay() {
+void updateFlakeCountDisplay(const CountSnapshot *counts) {
     char count_buf[16];
-    lv_snprintf(count_buf, sizeof(count_buf), "%d", flake_count);
-    lv_label_set_text(uiCYD_FlakeCountCurrent, count_buf);
+    lv_snprintf(count_buf, sizeof(count_buf), "%lu", (unsigned long)counts->flake_count);
+    viewSetText(&view_model, VIEW_FLAKE_COUNT, count_buf);
 }
 
 // Function to update the previous flake count displays on the UI
-void updateFlakeCountPrev1Display() {
+void updateFlakeCountPrev1Display(const CountSnapshot *counts) {
     char count_buf[16];
-    lv_snprintf(count_buf, sizeof(count_buf), "%d", flake_count_prev1);
-    lv_label_set_text(uiCYD_FlakeCountPrev1, count_buf);
+    lv_snprintf(count_buf, sizeof(count_buf), "%lu", (unsigned long)counts->flake_prev1);
+    viewSetText(&view_model, VIEW_FLAKE_PREV1, count_buf);
 }
 
-void updateFlakeCountPrev2Display() {
+void updateFlakeCountPrev2Display(const CountSnapshot *counts) {
     char count_buf[16];
-    lv_snprintf(count_buf, sizeof(count_buf), "%d", flake_count_prev2);
-    lv_label_set_text(uiCYD_FlakeCountPrev2, count_buf);
+    lv_snprintf(count_buf, sizeof(count_buf), "%lu", (unsigned long)counts->flake_prev2);
+    viewSetText(&view_model, VIEW_FLAKE_PREV2, count_buf);
 }
 
 // Function to update the bales per hour display on the UI
-void updateBalesPerHourDisplay() {
+void updateBalesPerHourDisplay(const CountSnapshot *counts) {
     char rate_buf[16];
-    if (bales_per_hour == 0.0) {
+    if (counts->bales_per_hour == 0.0) {
         sprintf(rate_buf, "0");
-    } else if (bales_per_hour < 10.0) {
-        sprintf(rate_buf, "%.1f", bales_per_hour);
+    } else if (counts->bales_per_hour < 10.0) {
+        sprintf(rate_buf, "%.1f", counts->bales_per_hour);
     } else {
-        sprintf(rate_buf, "%.0f", bales_per_hour);
+        sprintf(rate_buf, "%.0f", counts->bales_per_hour);
+    }
+    if (viewSetText(&view_model, VIEW_BALES_PER_HOUR, rate_buf)) {
+        // rate_buf is on the stack, so the rate is logged, not the text
+        LOG_DEBUG("Updated bales per hour display to: %.1f", counts->bales_per_hour);
+    }
+}
+
+// Function to update the bales remaining / ETA display on the UI
+// With no target set the caption shows "Bale Count" as designed
+void updateForecastDisplay(const CountSnapshot *counts) {
+    char forecast_buf[VIEW_TEXT_MAX];
+    if (counts->target == 0) {
+        lv_snprintf(forecast_buf, sizeof(forecast_buf), "Bale Count");
+    } else if (counts->remaining == 0) {
+        lv_snprintf(forecast_buf, sizeof(forecast_buf), "Target done");
+    } else if (!counts->eta_valid) {
+        lv_snprintf(forecast_buf, sizeof(forecast_buf), "%lu left", (unsigned long)counts->remaining);
+    } else {
+        unsigned long eta_min = (counts->eta_ms + 59999UL) / 60000UL;  // Round up to the next minute
+        lv_snprintf(forecast_buf, sizeof(forecast_buf), "%lu left %lu:%02lu",
+                    (unsigned long)counts->remaining, eta_min / 60, eta_min % 60);
+    }
+    viewSetText(&view_model, VIEW_FORECAST, forecast_buf);
+}
+
+// Function to update the target value on the Job settings page
+void updateJobTargetDisplay(const CountSnapshot *counts) {
+    char target_buf[VIEW_TEXT_MAX];
+    if (counts->target == 0) {
+        lv_snprintf(target_buf, sizeof(target_buf), "Target: off");
+    } else {
+        lv_snprintf(target_buf, sizeof(target_buf), "Target: %lu", (unsigned long)counts->target);
+    }
+    viewSetText(&view_model, VIEW_JOB_TARGET, target_buf);
+}
+
+// Function to change the job bale target and save it
+void setBaleTarget(uint32_t target) {
+    forecastSetTarget(&forecast, target, bale_count, millis());
+    preferences.putUInt("bale_target", target);
+    requestDisplayUpdate(DISP_JOB_TARGET | DISP_FORECAST);
+
+    LOG_INFO("Bale target set to: %lu", target);
+}
+
+// Low-rate tick so the ETA keeps counting down between bales
+void forecastTimerTick() {
+    if (forecast.target == 0) {
+        return;
+    }
+    forecastTick(&forecast, millis());
+    requestDisplayUpdate(DISP_FORECAST);
+}
+
+// Print anomaly alert counts for diagnostics
+void debugAnomalies() {
+    CountSnapshot counts;
+    readCounts(&counts);
+    Serial.println("=== ANOMALY DEBUG ===");
+    for (int i = 0; i < ANOMALY_COUNT; i++) {
+        Serial.print(anomalyName((AnomalyType)i));
+        Serial.print(": ");
+        Serial.print(counts.alert_counts[i]);
+        Serial.println((counts.alerts_active & (1UL << i)) ? " (active)" : "");
+    }
+    Serial.println("=====================");
+}
+
+// Function to show or hide the anomaly indicator on the UI
+void updateAnomalyIndicator(const CountSnapshot *counts) {
+    if (counts->alerts_total != anomaly_reported) {
+        // Report newly raised alerts once
+        for (int i = 0; i < ANOMALY_COUNT; i++) {
+            if (counts->alerts_active & (1UL << i)) {
+                LOG_WARN("Sensor anomaly: %s", anomalyName((AnomalyType)i));
+            }
+        }
+        anomaly_reported = counts->alerts_total;
+    }
+
+    if (counts->alerts_active) {
+        lv_obj_clear_flag(anomaly_indicator, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(anomaly_indicator, LV_OBJ_FLAG_HIDDEN);
     }
-    lv_label_set_text(uiCYD_BaleCountHour, rate_buf);
-    
-    Serial.print("Updated bales per hour display to: ");
-    Serial.println(rate_buf);
+}
+
+// Periodic tick for the time-based anomaly detectors
+void anomalyTimerTick() {
+    anomalyTick(&anomaly, millis());
+    requestDisplayUpdate(DISP_ANOMALY);
+}
+
+// Tapping the indicator acknowledges the active alerts
+static void anomalyIndicatorClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        debugAnomalies();
+        postCountCommand(CMD_ACK_ANOMALY);
+    }
+}
+
+// Create the small warning symbol in the top right corner of the main screen
+void createAnomalyIndicator() {
+    anomaly_indicator = lv_label_create(ui_Main);
+    lv_obj_set_align(anomaly_indicator, LV_ALIGN_TOP_RIGHT);
+    lv_obj_set_x(anomaly_indicator, -2);
+    lv_obj_set_y(anomaly_indicator, 2);
+    lv_label_set_text_static(anomaly_indicator, LV_SYMBOL_WARNING);
+    lv_obj_set_style_text_color(anomaly_indicator, lv_color_hex(0xFFEA83), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_flag(anomaly_indicator, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(anomaly_indicator, anomalyIndicatorClick, LV_EVENT_ALL, NULL);
 }
 
 // Function to calculate bales per hour based on current session
+// Blends the bale-edge rate with the flake cadence rate (see rate_estimator.h)
 void calculateBalesPerHour() {
-    Serial.print("Calculating bales per hour - Session bales: ");
-    Serial.println(bales_in_session);
+    LOG_DEBUG("Calculating bales per hour - Session bales: %d", bales_in_session);
     
+    float bale_edge_rate = 0.0;
+    int bale_intervals = 0;
     if (bales_in_session <= 1) {
-        // Need at least 2 bales to calculate a rate
-        bales_per_hour = 0.0;
-        Serial.println("Not enough bales for rate calculation");
+        // Need at least 2 bales to calculate a bale-edge rate
+        LOG_DEBUG("Not enough bales for bale-edge rate");
     } else {
         unsigned long elapsed_time_ms = last_bale_time - first_bale_time;
-        Serial.print("Elapsed time (ms): ");
-        Serial.println(elapsed_time_ms);
+        LOG_DEBUG("Elapsed time (ms): %lu", elapsed_time_ms);
         
         if (elapsed_time_ms > 0) {
             // Convert milliseconds to hours and calculate rate
             float elapsed_hours = elapsed_time_ms / 3600000.0;  // 3600000 ms = 1 hour
-            bales_per_hour = (bales_in_session - 1) / elapsed_hours;  // -1 because we count intervals
+            bale_intervals = bales_in_session - 1;  // -1 because we count intervals
+            bale_edge_rate = bale_intervals / elapsed_hours;
             
-            Serial.print("Elapsed hours: ");
-            Serial.println(elapsed_hours, 6);
-            Serial.print("Calculated rate: ");
-            Serial.println(bales_per_hour);
+            LOG_DEBUG("Elapsed hours: %.6f, bale-edge rate: %.2f", elapsed_hours, bale_edge_rate);
         } else {
-            bales_per_hour = 0.0;
-            Serial.println("Zero elapsed time");
+            LOG_DEBUG("Zero elapsed time");
+        }
+    }
+
+    bales_per_hour = rateFuse(&rate_estimator, bale_edge_rate, bale_intervals);
+    LOG_DEBUG("Flake cadence rate: %.2f, calculated rate: %.2f", rateFlakeBalesPerHour(&rate_estimator),
+              bales_per_hour);
+
+    portENTER_CRITICAL(&rate_trend_lock);
+    rateTrendAdd(&rate_trend, bales_per_hour, millis());
+    portEXIT_CRITICAL(&rate_trend_lock);
+
+    requestDisplayUpdate(DISP_BALES_PER_HOUR | DISP_RATE_TREND);
+}
+
+// Seconds on the season clock (see bale_history.h)
+uint32_t historyClockNow() {
+    return millis() / 1000 + history_clock_offset_s;
+}
+
+// Function to mount the history file system and carry the season clock on from the last bale
+void initBaleHistory() {
+    history_lock = xSemaphoreCreateMutex();
+    historyQueueInit(&history_queue);
+    history_fs_ok = LittleFS.begin(true);  // Formats the partition on first use
+    if (!history_fs_ok) {
+        Serial.println("Bale history: LittleFS mount failed, bales will not be logged");
+        return;
+    }
+    uint32_t count = 0;
+    if (LittleFS.exists(HISTORY_FILE)) {
+        File file = LittleFS.open(HISTORY_FILE, "r");
+        count = file.size() / sizeof(BaleRecord);
+        BaleRecord last;
+        if (count > 0 && file.seek((count - 1) * sizeof(BaleRecord)) &&
+            file.read((uint8_t *)&last, sizeof(last)) == sizeof(last)) {
+            history_clock_offset_s = last.time_s - millis() / 1000;
+        }
+        file.close();
+    }
+    history_count.store(count);
+    history_free_bytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+    Serial.printf("Bale history: %lu bales, %lu KB free\n", (unsigned long)count,
+                  (unsigned long)(history_free_bytes / 1024));
+}
+
+// Function to queue the bale just finished for the season history (sensor task)
+// The serial task writes it, so the counting never waits on the flash
+void appendBaleRecord(int flakes) {
+    uint32_t now_s = historyClockNow();
+    BaleRecord rec;
+    baleRecordMake(&rec, now_s, history_prev_time_s, flakes);
+    history_prev_time_s = now_s;
+    if (history_fs_ok) {
+        historyQueuePush(&history_queue, &rec);
+        schedWake(&serial_sched, history_job);
+    }
+}
+
+// Function to start a new season history (sensor task)
+// The serial task removes the file, after any bales already queued
+void clearBaleHistory() {
+    if (history_fs_ok) {
+        historyQueueClear(&history_queue);
+        schedWake(&serial_sched, history_job);
+    } else {
+        history_count.store(0);
+        history_generation.fetch_add(1);
+        requestDisplayUpdate(DISP_HISTORY);
+    }
+    history_clock_offset_s = 0 - millis() / 1000;
+    history_prev_time_s = -1;
+}
+
+// Function to carry out the clears asked for since the last one (serial task)
+static void applyHistoryClears() {
+    uint32_t clears = history_queue.clears.load(std::memory_order_acquire);
+    if (clears == history_clears_done) {
+        return;
+    }
+    xSemaphoreTake(history_lock, portMAX_DELAY);
+    LittleFS.remove(HISTORY_FILE);
+    history_free_bytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+    xSemaphoreGive(history_lock);
+    history_count.store(0);
+    history_generation.fetch_add(1);
+    history_clears_done = clears;
+    history_full_reported = false;
+    requestDisplayUpdate(DISP_HISTORY);
+}
+
+// Function to append the queued bales to the history file (serial task)
+// LittleFS commits on close, so a power cut never leaves half a record. The
+// free space is counted down as records are written instead of asking
+// LittleFS each time; it allocates whole blocks, which the margin covers.
+static void writeBaleHistory() {
+    if (!history_fs_ok) {
+        return;
+    }
+    applyHistoryClears();
+    HistoryQueueEntry entry;
+    while (historyQueuePop(&history_queue, &entry)) {
+        if (entry.epoch != history_clears_done) {
+            applyHistoryClears();
+            if (entry.epoch != history_clears_done) {
+                continue;  // Queued before a clear
+            }
+        }
+        bool saved = false;
+        if (history_free_bytes >= HISTORY_FREE_MARGIN + sizeof(BaleRecord)) {
+            xSemaphoreTake(history_lock, portMAX_DELAY);
+            File file = LittleFS.open(HISTORY_FILE, "a");
+            if (file) {
+                saved = file.write((const uint8_t *)&entry.rec, sizeof(BaleRecord)) == sizeof(BaleRecord);
+                file.close();
+            }
+            xSemaphoreGive(history_lock);
+        }
+        if (saved) {
+            history_free_bytes -= sizeof(BaleRecord);
+            history_count.fetch_add(1);
+            requestDisplayUpdate(DISP_HISTORY);
+        } else if (!history_full_reported) {
+            LOG_WARN("Bale history full, bales are no longer logged");
+            history_full_reported = true;
+        }
+    }
+}
+
+// Read records from the history file (UI task through the HistoryCache, and the console export)
+static uint32_t loadHistoryRecords(void *ctx, uint32_t first, BaleRecord *out, uint32_t n) {
+    if (!history_fs_ok) {
+        return 0;
+    }
+    uint32_t got = 0;
+    xSemaphoreTake(history_lock, portMAX_DELAY);
+    File file = LittleFS.open(HISTORY_FILE, "r");
+    if (file) {
+        if (file.seek(first * sizeof(BaleRecord))) {
+            got = file.read((uint8_t *)out, n * sizeof(BaleRecord)) / sizeof(BaleRecord);
         }
+        file.close();
+    }
+    xSemaphoreGive(history_lock);
+    return got;
+}
+
+// Binary telemetry (see telemetry.h), sent by the serial task while on
+static TelemetryQueue telemetry_queue;
+static std::atomic<bool> telemetry_on(false);
+static std::atomic<uint32_t> sensor_loop_us(0);      // Last sensor task loop
+static std::atomic<uint32_t> sensor_loop_max_us(0);  // Worst since the last status event
+
+static inline uint16_t telemetryClamp(uint32_t v) {
+    return v > 0xFFFF ? 0xFFFF : (uint16_t)v;
+}
+
+// Fill an event with the counts as they are now (sensor task only)
+void makeTelemetryEvent(TelemetryEvent *ev, uint8_t type) {
+    ev->type = type;
+    ev->alerts = (uint8_t)anomaly.active;
+    ev->time_us = (uint64_t)esp_timer_get_time();
+    ev->bale_count = bale_count;
+    ev->bale_count_year = bale_count_year;
+    ev->flake_count = telemetryClamp(flake_count);
+    ev->bales_in_session = telemetryClamp(bales_in_session);
+    ev->rate_x10 = telemetryClamp((uint32_t)(bales_per_hour * 10.0f + 0.5f));
+    ev->loop_us = telemetryClamp(sensor_loop_us.load());
+    ev->loop_max_us = telemetryClamp(sensor_loop_max_us.load());
+}
+
+// Queue a count event for the serial task, if telemetry is on (sensor task only)
+void queueTelemetry(uint8_t type) {
+    if (!telemetry_on.load()) {
+        return;
     }
-    updateBalesPerHourDisplay();
+    TelemetryEvent ev;
+    makeTelemetryEvent(&ev, type);
+    telemetryQueuePush(&telemetry_queue, &ev);
+    schedWake(&serial_sched, telemetry_job);
 }
 
-// Function to increment bale count - needs C linkage for ui_events.c
+// Counting functions - run in the sensor task
 extern "C" {
 void incrementBaleCount() {
     bale_count++;
@@ -186,67 +1081,66 @@ void incrementBaleCount() {
     
     // Track timing for bales per hour calculation
     unsigned long current_time = millis();
+
+    // Learn flakes per bale from the bale just finished
+    rateOnBale(&rate_estimator, flake_count);
     
     if (bales_in_session == 0) {
         // This is the first bale of the session
         first_bale_time = current_time;
         bales_in_session = 1;
-        bales_per_hour = 0.0;  // Can't calculate rate with just one bale
     } else {
         // Subsequent bales
         bales_in_session++;
         last_bale_time = current_time;
-        calculateBalesPerHour();
     }
+    calculateBalesPerHour();
+
+    // Log the finished bale before its flake count is shifted out
+    appendBaleRecord(flake_count);
+    queueTelemetry(TELEM_BALE);
     
     // Shift flake counts: prev2 <- prev1 <- current, then reset current to 0
     flake_count_prev2 = flake_count_prev1;
     flake_count_prev1 = flake_count;
     flake_count = 0;  // Reset current flake count for new bale
     
-    updateBaleCountDisplay();
-    updateBaleCountYearDisplay();
-    updateFlakeCountDisplay();
-    updateFlakeCountPrev1Display();
-    updateFlakeCountPrev2Display();
+    requestDisplayUpdate(DISP_BALE_COUNT | DISP_BALE_COUNT_YEAR | DISP_FLAKE_COUNT |
+                         DISP_FLAKE_PREV1 | DISP_FLAKE_PREV2);
+
+    // Update bales remaining and ETA for the job target
+    forecastOnBale(&forecast, bale_count, current_time);
+    requestDisplayUpdate(DISP_FORECAST);
+
+    // Check the finished bale against the normal interval and flake count
+    anomalyOnBale(&anomaly, flake_count_prev1, current_time);
+    requestDisplayUpdate(DISP_ANOMALY);
     
     // Save the updated counts to preferences
-    preferences.putUInt("bale_count", bale_count);
-    preferences.putUInt("bale_count_year", bale_count_year);
-    preferences.putUInt("flake_count", flake_count);
-    preferences.putUInt("flake_prev1", flake_count_prev1);
-    preferences.putUInt("flake_prev2", flake_count_prev2);
+    requestCountsSave();
     
-    Serial.print("Bale count incremented to: ");
-    Serial.println(bale_count);
-    Serial.print("Yearly bale count incremented to: ");
-    Serial.println(bale_count_year);
-    Serial.print("Bales in session: ");
-    Serial.println(bales_in_session);
-    Serial.print("Current rate: ");
-    Serial.print(bales_per_hour);
-    Serial.println(" bales/hour");
-    Serial.print("Flake counts shifted - Current: ");
-    Serial.print(flake_count);
-    Serial.print(", Prev1: ");
-    Serial.print(flake_count_prev1);
-    Serial.print(", Prev2: ");
-    Serial.println(flake_count_prev2);
-    Serial.println("All counts saved to preferences");
+    LOG_INFO("Bale count incremented to: %d, yearly: %d", bale_count, bale_count_year);
+    LOG_INFO("Bales in session: %d, current rate: %.2f bales/hour", bales_in_session, bales_per_hour);
+    LOG_DEBUG("Flake counts shifted - Current: %d, Prev1: %d, Prev2: %d", flake_count, flake_count_prev1,
+              flake_count_prev2);
 }
 
 void incrementFlakeCount() {
     flake_count++;
-    updateFlakeCountDisplay();
+    requestDisplayUpdate(DISP_FLAKE_COUNT);
+
+    // Flake cadence gives a rate before the second bale
+    rateOnFlake(&rate_estimator, millis());
+    calculateBalesPerHour();
+
+    anomalyOnFlake(&anomaly, millis());
+    requestDisplayUpdate(DISP_ANOMALY);
     
     // Save the updated count to preferences
-    preferences.putUInt("flake_count", flake_count);
-    // Also save previous flake counts to ensure they're always current
-    preferences.putUInt("flake_prev1", flake_count_prev1);
-    preferences.putUInt("flake_prev2", flake_count_prev2);
+    requestCountsSave();
+    queueTelemetry(TELEM_FLAKE);
     
-    Serial.print("Flake count incremented to: ");
-    Serial.println(flake_count);
+    LOG_INFO("Flake count incremented to: %d", flake_count);
 }
 
 // Function to reset the bales per hour session
@@ -255,49 +1149,84 @@ void resetBalesPerHourSession() {
     bales_per_hour = 0.0;
     first_bale_time = 0;
     last_bale_time = 0;
-    updateBalesPerHourDisplay();
+    rateResetSession(&rate_estimator);
+    requestDisplayUpdate(DISP_BALES_PER_HOUR);
+
+    portENTER_CRITICAL(&rate_trend_lock);
+    rateTrendInit(&rate_trend, millis());
+    portEXIT_CRITICAL(&rate_trend_lock);
+    requestDisplayUpdate(DISP_RATE_TREND);
+
+    // The forecast rate belongs to the session too
+    forecastResetRate(&forecast, bale_count);
+    requestDisplayUpdate(DISP_FORECAST);
     
-    Serial.println("Bales per hour session reset");
+    LOG_INFO("Bales per hour session reset");
 }
 
 void resetBaleCount() {
     bale_count = 0;
-    updateBaleCountDisplay();
+    requestDisplayUpdate(DISP_BALE_COUNT);
     
     // Reset the bales per hour session when bale count is reset
     resetBalesPerHourSession();
     
     // Save the reset count to preferences
-    preferences.putUInt("bale_count", bale_count);
+    requestCountsSave();
+    queueTelemetry(TELEM_RESET);
     
-    Serial.println("Bale count reset to 0");
+    LOG_INFO("Bale count reset to 0");
 }
 
 void resetBaleCountYear() {
     bale_count_year = 0;
-    updateBaleCountYearDisplay();
+    requestDisplayUpdate(DISP_BALE_COUNT_YEAR);
+
+    // The history covers the season, so it starts again too
+    clearBaleHistory();
     
     // Save the reset count to preferences
-    preferences.putUInt("bale_count_year", bale_count_year);
+    requestCountsSave();
+    queueTelemetry(TELEM_RESET);
     
-    Serial.println("Yearly bale count reset to 0");
+    LOG_INFO("Yearly bale count reset to 0");
 }
 
 void resetFlakeCount() {
     flake_count = 0;
     flake_count_prev1 = 0;
     flake_count_prev2 = 0;
-    updateFlakeCountDisplay();
-    updateFlakeCountPrev1Display();
-    updateFlakeCountPrev2Display();
+    requestDisplayUpdate(DISP_FLAKE_COUNT | DISP_FLAKE_PREV1 | DISP_FLAKE_PREV2);
     
     // Save the reset counts to preferences
-    preferences.putUInt("flake_count", flake_count);
-    preferences.putUInt("flake_prev1", flake_count_prev1);
-    preferences.putUInt("flake_prev2", flake_count_prev2);
+    requestCountsSave();
+    queueTelemetry(TELEM_RESET);
     
-    Serial.println("All flake counts reset to 0");
-    Serial.println("All flake counts saved to preferences");
+    LOG_INFO("All flake counts reset to 0");
+}
+
+// Write the counts that changed since the last save (sensor task persist job)
+void saveChangedCounts() {
+    if (bale_count != saved_counts.bale_count) {
+        preferences.putUInt("bale_count", bale_count);
+        saved_counts.bale_count = bale_count;
+    }
+    if (bale_count_year != saved_counts.bale_count_year) {
+        preferences.putUInt("bale_count_year", bale_count_year);
+        saved_counts.bale_count_year = bale_count_year;
+    }
+    if (flake_count != saved_counts.flake_count) {
+        preferences.putUInt("flake_count", flake_count);
+        saved_counts.flake_count = flake_count;
+    }
+    if (flake_count_prev1 != saved_counts.flake_prev1) {
+        preferences.putUInt("flake_prev1", flake_count_prev1);
+        saved_counts.flake_prev1 = flake_count_prev1;
+    }
+    if (flake_count_prev2 != saved_counts.flake_prev2) {
+        preferences.putUInt("flake_prev2", flake_count_prev2);
+        saved_counts.flake_prev2 = flake_count_prev2;
+    }
 }
 
 // Debug function to verify preferences are working
@@ -323,82 +1252,1910 @@ void debugPreferences() {
     Serial.println(stored_prev2);
     Serial.println("=========================");
 }
+
+// Reset requests from the settings buttons in ui_events.c (UI task)
+void requestResetFlakeCount() {
+    postCountCommand(CMD_RESET_FLAKES);
+}
+
+void requestResetBaleCount() {
+    postCountCommand(CMD_RESET_BALES);
+}
+
+void requestResetBaleCountYear() {
+    postCountCommand(CMD_RESET_YEAR);
+}
+}
+
+// Change the job bale target from the UI task
+void requestBaleTarget(uint32_t target) {
+    pending_target_delta.store(0);  // Steps pressed before this are replaced
+    pending_target.store(target);
+    postCountCommand(CMD_SET_TARGET);
+}
+
+// Step the job bale target from the UI task. The sensor task applies the
+// step to its own target, so quick presses add up.
+void requestBaleTargetStep(int32_t delta) {
+    pending_target_delta.fetch_add(delta);
+    postCountCommand(CMD_TARGET_DELTA);
+}
+
+// Job target button handlers
+static void jobTargetDownBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        requestBaleTargetStep(-TARGET_STEP);
+    }
+}
+
+static void jobTargetUpBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        requestBaleTargetStep(TARGET_STEP);
+    }
+}
+
+static void jobTargetClearBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        requestBaleTarget(0);
+    }
+}
+
+// Shared styles of the settings pages added here, instead of local styles on each object
+static lv_style_t settings_btn_style;    // Matches the SquareLine reset buttons
+static lv_style_t settings_title_style;  // Page title labels
+// The titles contain letters, which the digit-only 20 px font (env:cyd_digit_fonts) doesn't have
+#ifdef DIGIT_FONTS
+#define SETTINGS_TITLE_FONT lv_font_montserrat_18
+#else
+#define SETTINGS_TITLE_FONT lv_font_montserrat_20
+#endif
+
+// Function to set up the settings page styles (once, before the pages are created)
+void initSettingsStyles() {
+    lv_style_init(&settings_btn_style);
+    lv_style_set_bg_color(&settings_btn_style, lv_color_hex(0x6AC27B));
+    lv_style_set_bg_opa(&settings_btn_style, 255);
+    lv_style_set_text_color(&settings_btn_style, lv_color_hex(0x000000));
+    lv_style_set_text_opa(&settings_btn_style, 255);
+
+    lv_style_init(&settings_title_style);
+    lv_style_set_text_font(&settings_title_style, &SETTINGS_TITLE_FONT);
+}
+
+// Create a settings button matching the SquareLine reset buttons
+static lv_obj_t *createSettingsButton(lv_obj_t *parent, const char *text, lv_align_t align,
+                                      lv_event_cb_t event_cb) {
+    lv_obj_t *btn = lv_btn_create(parent);
+    lv_obj_set_width(btn, 75);
+    lv_obj_set_height(btn, 45);
+    lv_obj_set_align(btn, align);
+    lv_obj_add_style(btn, &settings_btn_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_event_cb(btn, event_cb, LV_EVENT_ALL, NULL);
+
+    lv_obj_t *label = lv_label_create(btn);
+    lv_obj_set_align(label, LV_ALIGN_CENTER);
+    lv_label_set_text(label, text);
+    return btn;
+}
+
+// Add the "Job" page to the settings tabview for setting the bale target
+void createJobSettingsPage() {
+    lv_obj_t *job_page = lv_tabview_add_tab(ui_TabView1, "Job");
+    lv_obj_clear_flag(job_page, LV_OBJ_FLAG_SCROLLABLE);
+
+    job_target_label = lv_label_create(job_page);
+    lv_obj_set_align(job_target_label, LV_ALIGN_TOP_MID);
+    lv_obj_add_style(job_target_label, &settings_title_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    createSettingsButton(job_page, "-10", LV_ALIGN_BOTTOM_LEFT, jobTargetDownBtnClick);
+    createSettingsButton(job_page, "Clear", LV_ALIGN_BOTTOM_MID, jobTargetClearBtnClick);
+    createSettingsButton(job_page, "+10", LV_ALIGN_BOTTOM_RIGHT, jobTargetUpBtnClick);
+
+    // Show the current target and keep it updated while the page exists
+    lv_label_set_text_static(job_target_label, viewText(&view_model, VIEW_JOB_TARGET));
+    view_labels[VIEW_JOB_TARGET] = job_target_label;
 }
 
 /*Read the touchpad*/
+// Only touches the SPI bus while T_IRQ says the pen is down. Samples are
+// median/IIR filtered and mapped through the calibration matrix.
 void my_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
-    uint16_t touchX, touchY;
-    bool touched = (ts.tirqTouched() && ts.touched());
+    bool pen_down = (digitalRead(XPT2046_IRQ) == LOW);
+    bool touched = pen_down && ts.touched();
+#ifdef TOUCH_PROFILING
+    static uint32_t polls = 0, spi_reads = 0, report_start = 0;
+    polls++;
+    if (pen_down) spi_reads++;
+    if (millis() - report_start >= 5000) {
+        float secs = (millis() - report_start) / 1000.0f;
+        Serial.print("Touch polls/s: ");
+        Serial.print(polls / secs, 1);
+        Serial.print(", touch SPI reads/s: ");
+        Serial.println(spi_reads / secs, 1);
+        polls = 0;
+        spi_reads = 0;
+        report_start = millis();
+    }
+#endif
+
+    // Poll fast only while the pen is down
+    lv_timer_set_period(indev_drv->read_timer, touched ? TOUCH_POLL_ACTIVE_MS : TOUCH_POLL_IDLE_MS);
+
+    // The touch that turned the display on is not passed to the UI
+    if (swallow_touch.load()) {
+        data->state = LV_INDEV_STATE_REL;
+        if (!touched) {
+            swallow_touch.store(false);
+        }
+        return;
+    }
     
     if (!touched)
     {
         data->state = LV_INDEV_STATE_REL;
         touchProcessed = false; // Reset when touch is released
+        touchFilterReset(&touch_filter);
     }
     else
     {
-        // Debounce touch input
-        unsigned long currentTime = millis();
-        if (currentTime - lastTouchTime < 100) { // 100ms debounce
-            return;
-        }
-        
         TS_Point p = ts.getPoint();
-        touchX = map(p.x, 200, 3700, 1, screenWidth);
-        touchY = map(p.y, 240, 3800, 1, screenHeight);
+        int16_t touchX, touchY;
+        touchFilterAdd(&touch_filter, p.x, p.y, &touch_raw_x, &touch_raw_y);
+        touchCalApply(&touch_cal, touch_raw_x, touch_raw_y, screenWidth, screenHeight, &touchX, &touchY);
         
         data->state = LV_INDEV_STATE_PR;
         data->point.x = touchX;
         data->point.y = touchY;
 
-#ifdef BRIGHTNESS_ENABLED
+        if (!touchProcessed) {
+            // Keeps the display from going idle
+            postCountCommand(CMD_USER_ACTIVITY);
 
-        // Check for brightness control touch areas (top quadrants of screen)
-        static unsigned long last_brightness_change = 0;
-        
-        if (touchY < screenHeight / 2 && currentTime - last_brightness_change > 200) {  // Top half and debounce
-            if (touchX < screenWidth / 2) {
-                // Top left - decrease brightness
-                current_brightness -= 10;
-                if (current_brightness < 0) current_brightness = 0;
-            } else {
-                // Top right - increase brightness
-                current_brightness += 10;
-                if (current_brightness > 100) current_brightness = 100;
-            }
-            
-            // Update brightness
-            int pwm_value = map(current_brightness, 0, 100, 0, 255);
-            analogWrite(21, pwm_value);
+            LOG_DEBUG("Touch at x: %d, y: %d", touchX, touchY);
             
-            last_brightness_change = currentTime;
-            Serial.print("Brightness changed to ");
-            Serial.print(current_brightness);
-            Serial.println("%");
+            touchProcessed = true;
+        }
+    }
+}
+
+#ifdef BRIGHTNESS_ENABLED
+/* Called by LVGL for every input event */
+// Brightness zones: pressing the top left / top right quarter steps the backlight down / up
+void my_touch_feedback(lv_indev_drv_t *indev_drv, uint8_t event)
+{
+    if (event != LV_EVENT_PRESSED && event != LV_EVENT_PRESSING) {
+        return;
+    }
+    // The history list is dragged up and down and calibration taps land in
+    // the top corners, so no brightness zones on either
+    if (history_screen != NULL || touch_cal_overlay != NULL) {
+        return;
+    }
+    lv_point_t point;
+    lv_indev_get_point(lv_indev_get_act(), &point);
+
+    // Check for brightness control touch areas (top quadrants of screen)
+    static unsigned long last_brightness_change = 0;
+    unsigned long currentTime = millis();
+    
+    if (point.y < screenHeight / 2 && currentTime - last_brightness_change > 200) {  // Top half and debounce
+        if (point.x < screenWidth / 2) {
+            // Top left - decrease brightness
+            current_brightness -= 10;
+            if (current_brightness < 0) current_brightness = 0;
+        } else {
+            // Top right - increase brightness
+            current_brightness += 10;
+            if (current_brightness > 100) current_brightness = 100;
         }
+        
+        // Update brightness
+        applyBrightness();
+        
+        last_brightness_change = currentTime;
+        Serial.print("Brightness changed to ");
+        Serial.print(current_brightness);
+        Serial.println("%");
+    }
+}
 #endif // BRIGHTNESS_ENABLED
 
-        if (!touchProcessed) {
-            Serial.print("Touch at x: ");
-            Serial.print(touchX);
-            Serial.print(", y: ");
-            Serial.println(touchY);
+// T_IRQ falling edge: wake the UI task so the pen-down is read right away
+void IRAM_ATTR touchIrqIsr(void *arg) {
+    if (schedMarkWoken(&ui_sched, touch_job) && ui_task_handle != NULL) {
+        BaseType_t higher_woken = pdFALSE;
+        vTaskNotifyGiveFromISR(ui_task_handle, &higher_woken);
+        if (higher_woken) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+// Load the touch calibration, or fall back to the old fixed mapping
+void loadTouchCalibration() {
+    size_t len = preferences.getBytes("touch_cal", &touch_cal, sizeof(touch_cal));
+    if (len != sizeof(touch_cal) || !touchCalValid(&touch_cal)) {
+        touchCalDefault(&touch_cal, screenWidth, screenHeight);
+        Serial.println("Touch calibration: default");
+    } else {
+        Serial.println("Loaded touch calibration from preferences");
+    }
+}
+
+// 3-point touch calibration: tap a marker at each target on a full-screen overlay
+#define TOUCH_CAL_POINTS 3
+static const int16_t touch_cal_targets[TOUCH_CAL_POINTS][2] = {{32, 24}, {288, 120}, {160, 216}};
+static int16_t touch_cal_raw[TOUCH_CAL_POINTS][2];
+static int touch_cal_step = 0;
+static lv_obj_t *touch_cal_marker = NULL;
+static lv_obj_t *touch_cal_label = NULL;
+
+// Function to show the marker and prompt for the current calibration step
+void showTouchCalStep(const char *prompt) {
+    lv_obj_set_pos(touch_cal_marker, touch_cal_targets[touch_cal_step][0] - 4, touch_cal_targets[touch_cal_step][1] - 4);
+    lv_label_set_text_fmt(touch_cal_label, "%s (%d/%d)", prompt, touch_cal_step + 1, TOUCH_CAL_POINTS);
+}
+
+static void touchCalOverlayEvent(lv_event_t *e) {
+    if (lv_event_get_code(e) != LV_EVENT_RELEASED) {
+        return;
+    }
+    // The filtered raw point of the press that just ended
+    touch_cal_raw[touch_cal_step][0] = touch_raw_x;
+    touch_cal_raw[touch_cal_step][1] = touch_raw_y;
+    touch_cal_step++;
+    if (touch_cal_step < TOUCH_CAL_POINTS) {
+        showTouchCalStep("Tap the red square");
+        return;
+    }
+
+    TouchCal cal;
+    if (!touchCalSolve(&cal, touch_cal_targets, touch_cal_raw)) {
+        touch_cal_step = 0;
+        showTouchCalStep("Try again");
+        return;
+    }
+    touch_cal = cal;
+    pending_touch_cal = cal;
+    postCountCommand(CMD_SAVE_TOUCH_CAL);
+    lv_obj_del(touch_cal_overlay);
+    touch_cal_overlay = NULL;
+    Serial.println("Touch calibration done");
+}
+
+// Function to start the touch calibration (UI task)
+void startTouchCalibration() {
+    if (touch_cal_overlay != NULL) {
+        return;
+    }
+    touch_cal_step = 0;
+    touch_cal_overlay = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(touch_cal_overlay);
+    lv_obj_set_size(touch_cal_overlay, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(touch_cal_overlay, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(touch_cal_overlay, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_flag(touch_cal_overlay, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(touch_cal_overlay, touchCalOverlayEvent, LV_EVENT_ALL, NULL);
+
+    touch_cal_marker = lv_obj_create(touch_cal_overlay);
+    lv_obj_remove_style_all(touch_cal_marker);
+    lv_obj_set_size(touch_cal_marker, 9, 9);
+    lv_obj_set_style_bg_color(touch_cal_marker, lv_color_hex(0xFF0000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(touch_cal_marker, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_clear_flag(touch_cal_marker, LV_OBJ_FLAG_CLICKABLE);
+
+    touch_cal_label = lv_label_create(touch_cal_overlay);
+    lv_obj_set_align(touch_cal_label, LV_ALIGN_CENTER);
+    lv_obj_set_style_text_color(touch_cal_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    showTouchCalStep("Tap the red square");
+}
+
+static void touchCalBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        startTouchCalibration();
+    }
+}
+
+// Add the "Touch" page to the settings tabview for calibrating the touchscreen
+void createTouchSettingsPage() {
+    lv_obj_t *touch_page = lv_tabview_add_tab(ui_TabView1, "Touch");
+    lv_obj_clear_flag(touch_page, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *label = lv_label_create(touch_page);
+    lv_obj_set_align(label, LV_ALIGN_TOP_MID);
+    lv_label_set_text_static(label, "Touch calibration");
+    lv_obj_add_style(label, &settings_title_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    createSettingsButton(touch_page, "Start", LV_ALIGN_BOTTOM_MID, touchCalBtnClick);
+}
+
+// Rate trend chart on the "Trend" page (UI task, NULL while the popup is closed)
+static RateTrend trend_view;              // UI task's copy of rate_trend
+static lv_obj_t *trend_chart = NULL;
+static lv_obj_t *trend_scale_label = NULL;
+
+// Draw the trend columns inside the area being redrawn, one pixel per column
+static void trendDrawEvent(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+    lv_coord_t height = lv_area_get_height(&content);
+    uint32_t top = (uint32_t)trend_view.scale * 10;  // In tenths
+
+    int first = draw_ctx->clip_area->x1 - content.x1;
+    int last = draw_ctx->clip_area->x2 - content.x1;
+    if (first < 0) first = 0;
+    if (last >= trend_view.count) last = trend_view.count - 1;
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    dsc.bg_opa = LV_OPA_COVER;
+    for (int i = first; i <= last; i++) {
+        const RateTrendColumn *col = &trend_view.columns[i];
+        if (!rateTrendColumnUsed(col)) {
+            continue;  // Nothing counted (a stop)
+        }
+        // A vertical line from the column's lowest to highest rate
+        lv_area_t area;
+        area.x1 = content.x1 + i;
+        area.x2 = area.x1;
+        area.y1 = content.y2 - (lv_coord_t)((uint32_t)col->max_tenths * (height - 1) / top);
+        area.y2 = content.y2 - (lv_coord_t)((uint32_t)col->min_tenths * (height - 1) / top);
+        lv_draw_rect(draw_ctx, &dsc, &area);
+    }
+}
+
+// Show the y scale and time per column above the chart
+static void updateTrendScaleLabel() {
+    lv_label_set_text_fmt(trend_scale_label, "Bales/hr 0-%u, %lu min/px", (unsigned)trend_view.scale,
+                          (unsigned long)(trend_view.span_ms / 60000UL));
+}
+
+// Function to copy the rate trend and redraw the columns that changed (UI task)
+void updateRateTrendDisplay() {
+    uint16_t old_count = trend_view.count;
+    uint32_t old_layout = trend_view.layout;
+    portENTER_CRITICAL(&rate_trend_lock);
+    trend_view = rate_trend;
+    portEXIT_CRITICAL(&rate_trend_lock);
+    if (trend_chart == NULL) {
+        return;
+    }
+
+    if (trend_view.layout != old_layout || trend_view.count < old_count) {
+        // Columns merged, the scale grew or the session was reset
+        lv_obj_invalidate(trend_chart);
+        updateTrendScaleLabel();
+        return;
+    }
+    if (trend_view.count == 0) {
+        return;
+    }
+    // Only the newest column, plus any started since the last copy
+    lv_area_t area;
+    lv_obj_get_content_coords(trend_chart, &area);
+    lv_coord_t left = area.x1;
+    area.x1 = left + (old_count > 0 ? old_count - 1 : 0);
+    area.x2 = left + trend_view.count - 1;
+    lv_obj_invalidate_area(trend_chart, &area);
+}
+
+// Add the "Trend" page to the settings tabview showing bales per hour over the session
+void createTrendSettingsPage() {
+    lv_obj_t *trend_page = lv_tabview_add_tab(ui_TabView1, "Trend");
+    lv_obj_clear_flag(trend_page, LV_OBJ_FLAG_SCROLLABLE);
+
+    trend_scale_label = lv_label_create(trend_page);
+    lv_obj_set_align(trend_scale_label, LV_ALIGN_TOP_MID);
+
+    trend_chart = lv_obj_create(trend_page);
+    lv_obj_remove_style_all(trend_chart);
+    lv_obj_set_size(trend_chart, RATE_TREND_COLUMNS, 80);
+    lv_obj_set_align(trend_chart, LV_ALIGN_BOTTOM_MID);
+    lv_obj_clear_flag(trend_chart, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_border_width(trend_chart, 1, LV_PART_MAIN);
+    lv_obj_set_style_border_side(trend_chart, LV_BORDER_SIDE_BOTTOM | LV_BORDER_SIDE_LEFT, LV_PART_MAIN);
+    lv_obj_set_style_border_color(trend_chart, lv_color_hex(0x6AC27B), LV_PART_MAIN);
+    lv_obj_set_style_border_opa(trend_chart, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_add_event_cb(trend_chart, trendDrawEvent, LV_EVENT_DRAW_MAIN, NULL);
+
+    // Drawn in full from the current copy
+    updateRateTrendDisplay();
+    updateTrendScaleLabel();
+}
+
+#ifdef TREND_PROFILING
+// Fill the trend with a simulated 14 hour day, a sample every 60-90 s with the
+// pace slowly falling, and time each add. Open Settings > Trend with
+// DISPLAY_PROFILING on to see the full redraw, then the one-column redraws.
+void profileRateTrend() {
+    static RateTrend sim;
+    const uint32_t day_ms = 14UL * 3600000UL;
+    rateTrendInit(&sim, 0);
+    uint32_t adds = 0, merges = 0, total_us = 0, worst_us = 0;
+    for (uint32_t t = 0; t < day_ms; t += 60000UL + (adds * 7919UL) % 30000UL) {
+        float rate = 50.0f - 20.0f * t / day_ms + (float)((adds * 31) % 9) - 4.0f;
+        uint32_t start = micros();
+        merges += rateTrendAdd(&sim, rate, t);
+        uint32_t us = micros() - start;
+        total_us += us;
+        if (us > worst_us) worst_us = us;
+        adds++;
+    }
+    Serial.printf("Rate trend: %lu samples over 14 h in %u columns of %lu min, %lu full redraws\n",
+                  (unsigned long)adds, sim.count, (unsigned long)(sim.span_ms / 60000UL), (unsigned long)merges);
+    Serial.printf("Rate trend add: %lu us average, %lu us worst (a merge)\n",
+                  (unsigned long)(total_us / adds), (unsigned long)worst_us);
+
+    // Show the simulated day as if the session had started 14 hours ago
+    sim.start_ms = millis() - day_ms;
+    portENTER_CRITICAL(&rate_trend_lock);
+    rate_trend = sim;
+    portEXIT_CRITICAL(&rate_trend_lock);
+}
+#endif
+
+// Season history screen (UI task). Only the rows on screen exist as objects
+// and they are reused as the list scrolls (see virtual_list.h), so its RAM
+// and scroll cost don't grow with the season. Newest bale first.
+#define HISTORY_ROW_H 18
+#define HISTORY_LIST_Y 58          // Top of the list, below the title and column headings
+#define HISTORY_BAR_W 24           // Dragging in this strip on the right jumps through the list
+#define HISTORY_TEXT_MAX 12
+enum HistoryColumn {
+    HISTORY_COL_NUMBER,
+    HISTORY_COL_TIME,
+    HISTORY_COL_FLAKES,
+    HISTORY_COL_INTERVAL,
+    HISTORY_COLUMNS
+};
+static const lv_coord_t history_col_x[HISTORY_COLUMNS] = {8, 80, 160, 220};
+static const char *const history_col_titles[HISTORY_COLUMNS] = {"Bale", "Run time", "Flakes", "Interval"};
+static lv_obj_t *history_viewport = NULL;
+static lv_obj_t *history_thumb = NULL;
+static lv_obj_t *history_rows[VLIST_MAX_SLOTS];
+static lv_obj_t *history_cells[VLIST_MAX_SLOTS][HISTORY_COLUMNS];
+static char history_text[VLIST_MAX_SLOTS][HISTORY_COLUMNS][HISTORY_TEXT_MAX];
+static VirtualList history_list;
+static HistoryCache history_cache;
+static uint32_t history_view_count = 0;        // Bales the list shows
+static uint32_t history_view_generation = 0;   // history_generation when the cache was filled
+static bool history_scrubbing = false;         // Press started in the scroll bar strip
+static lv_obj_t *history_summary_label = NULL; // On the "History" settings page
+
+// Fill a slot with its row's bale, or hide it past the end of the list
+static void setHistoryRow(uint8_t slot) {
+    uint32_t row = history_list.slot_row[slot];
+    BaleRecord rec;
+    if (row == VLIST_NO_ROW || !historyCacheGet(&history_cache, history_view_count - 1 - row, &rec)) {
+        lv_obj_add_flag(history_rows[slot], LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    char(*text)[HISTORY_TEXT_MAX] = history_text[slot];
+    lv_snprintf(text[HISTORY_COL_NUMBER], HISTORY_TEXT_MAX, "%lu", (unsigned long)(history_view_count - row));
+    baleRecordFormatTime(&rec, text[HISTORY_COL_TIME], HISTORY_TEXT_MAX);
+    baleRecordFormatFlakes(&rec, text[HISTORY_COL_FLAKES], HISTORY_TEXT_MAX);
+    baleRecordFormatInterval(&rec, text[HISTORY_COL_INTERVAL], HISTORY_TEXT_MAX);
+    for (int col = 0; col < HISTORY_COLUMNS; col++) {
+        lv_label_set_text_static(history_cells[slot][col], text[col]);
+    }
+    lv_obj_clear_flag(history_rows[slot], LV_OBJ_FLAG_HIDDEN);
+}
+
+// Function to scroll the history list: move the rows and refill the ones that changed
+void scrollHistoryList(int32_t scroll_y) {
+    uint32_t changed = vlistUpdate(&history_list, history_view_count, scroll_y);
+    for (uint8_t slot = 0; slot < history_list.slots; slot++) {
+        if (changed & (1UL << slot)) {
+            setHistoryRow(slot);
+        }
+        if (history_list.slot_row[slot] != VLIST_NO_ROW) {
+            lv_obj_set_y(history_rows[slot], (lv_coord_t)vlistSlotY(&history_list, slot));
+        }
+    }
+
+    // Scroll bar thumb, at least a finger's width of the list long
+    int32_t max_scroll = vlistMaxScroll(&history_list);
+    if (max_scroll == 0) {
+        lv_obj_add_flag(history_thumb, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    int32_t view_h = history_list.view_h;
+    int32_t thumb_h = (int32_t)((int64_t)view_h * view_h / (max_scroll + view_h));
+    if (thumb_h < 12) thumb_h = 12;
+    lv_obj_set_height(history_thumb, (lv_coord_t)thumb_h);
+    lv_obj_set_y(history_thumb, (lv_coord_t)((int64_t)history_list.scroll_y * (view_h - thumb_h) / max_scroll));
+    lv_obj_clear_flag(history_thumb, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Drag the list to scroll it, or drag in the bar strip to jump through the season
+static void historyViewportEvent(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_indev_t *indev = lv_indev_get_act();
+    if (indev == NULL) {
+        return;
+    }
+    lv_point_t point;
+    lv_indev_get_point(indev, &point);
+    lv_area_t area;
+    lv_obj_get_coords(history_viewport, &area);
+
+    if (code == LV_EVENT_PRESSED) {
+        history_scrubbing = point.x > area.x2 - HISTORY_BAR_W;
+    } else if (code == LV_EVENT_PRESSING) {
+        int32_t scroll_y;
+        if (history_scrubbing) {
+            scroll_y = (int32_t)((int64_t)(point.y - area.y1) * vlistMaxScroll(&history_list) / (history_list.view_h - 1));
+        } else {
+            lv_point_t vect;
+            lv_indev_get_vect(indev, &vect);
+            scroll_y = history_list.scroll_y - vect.y;
+        }
+        if (scroll_y != history_list.scroll_y) {
+            scrollHistoryList(scroll_y);
+        }
+    }
+}
+
+// Show the number of bales logged on the "History" settings page
+static void updateHistorySummary() {
+    lv_label_set_text_fmt(history_summary_label, "%lu bales this season", (unsigned long)history_count.load());
+}
+
+// Function to show newly logged bales, or the emptied list after a reset (UI task)
+void updateHistoryDisplay() {
+    if (history_summary_label != NULL) {
+        updateHistorySummary();
+    }
+    if (history_screen == NULL) {
+        return;
+    }
+    uint32_t generation = history_generation.load();
+    uint32_t count = history_count.load();
+    int32_t scroll_y = history_list.scroll_y;
+    if (generation != history_view_generation) {
+        historyCacheInvalidate(&history_cache);
+        history_view_generation = generation;
+        scroll_y = 0;
+    } else if (scroll_y > 0 && count > history_view_count) {
+        // Keep the same bales in view while scrolled down
+        scroll_y += (int32_t)(count - history_view_count) * HISTORY_ROW_H;
+    }
+    history_view_count = count;
+    // Rows are numbered from the newest bale, so every row has moved
+    vlistInvalidate(&history_list);
+    scrollHistoryList(scroll_y);
+}
+
+// Function to close the history screen and go back to the main screen (UI task)
+void closeHistoryScreen() {
+    if (history_screen == NULL) {
+        return;
+    }
+    lv_scr_load(ui_Main);
+    // Deleted after the current event, which may come from its close button
+    lv_obj_del_async(history_screen);
+    history_screen = NULL;
+    history_viewport = NULL;
+    history_thumb = NULL;
+}
+
+static void historyCloseBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        closeHistoryScreen();
+    }
+}
+
+// Function to build the history screen with one recycled row per slot and show it (UI task)
+void openHistoryScreen() {
+    if (history_screen != NULL) {
+        return;
+    }
+    history_screen = lv_obj_create(NULL);
+    lv_obj_clear_flag(history_screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *title = lv_label_create(history_screen);
+    lv_obj_set_pos(title, 8, 8);
+    lv_label_set_text_static(title, "Bale history");
+    lv_obj_add_style(title, &settings_title_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_t *close_btn = createSettingsButton(history_screen, "Close", LV_ALIGN_TOP_RIGHT, historyCloseBtnClick);
+    lv_obj_set_height(close_btn, 32);
+
+    for (int col = 0; col < HISTORY_COLUMNS; col++) {
+        lv_obj_t *heading = lv_label_create(history_screen);
+        lv_obj_set_pos(heading, history_col_x[col], HISTORY_LIST_Y - HISTORY_ROW_H);
+        lv_label_set_text_static(heading, history_col_titles[col]);
+        lv_obj_set_style_text_color(heading, lv_color_hex(0x6AC27B), LV_PART_MAIN | LV_STATE_DEFAULT);
+    }
+
+    // Not an LVGL scrollable: the rows are placed from history_list instead
+    history_viewport = lv_obj_create(history_screen);
+    lv_obj_remove_style_all(history_viewport);
+    lv_obj_set_pos(history_viewport, 0, HISTORY_LIST_Y);
+    lv_obj_set_size(history_viewport, screenWidth, screenHeight - HISTORY_LIST_Y);
+    lv_obj_clear_flag(history_viewport, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(history_viewport, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(history_viewport, historyViewportEvent, LV_EVENT_ALL, NULL);
+
+    vlistInit(&history_list, HISTORY_ROW_H, screenHeight - HISTORY_LIST_Y);
+    for (uint8_t slot = 0; slot < history_list.slots; slot++) {
+        lv_obj_t *row = lv_obj_create(history_viewport);
+        lv_obj_remove_style_all(row);
+        lv_obj_set_size(row, screenWidth - HISTORY_BAR_W, HISTORY_ROW_H);
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        history_rows[slot] = row;
+        for (int col = 0; col < HISTORY_COLUMNS; col++) {
+            lv_obj_t *cell = lv_label_create(row);
+            lv_obj_set_pos(cell, history_col_x[col], 1);
+            lv_label_set_text_static(cell, "");
+            history_cells[slot][col] = cell;
+        }
+    }
+
+    history_thumb = lv_obj_create(history_viewport);
+    lv_obj_remove_style_all(history_thumb);
+    lv_obj_set_width(history_thumb, 4);
+    lv_obj_set_align(history_thumb, LV_ALIGN_TOP_RIGHT);
+    lv_obj_set_x(history_thumb, -4);
+    lv_obj_set_style_bg_color(history_thumb, lv_color_hex(0x6AC27B), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(history_thumb, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_clear_flag(history_thumb, LV_OBJ_FLAG_CLICKABLE);
+
+    history_view_count = history_count.load();
+    history_view_generation = history_generation.load();
+    historyCacheInvalidate(&history_cache);
+    scrollHistoryList(0);
+    lv_scr_load(history_screen);
+}
+
+extern "C" void closeSettingsPopup();
+
+static void historyShowBtnClick(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        closeSettingsPopup();
+        openHistoryScreen();
+    }
+}
+
+// Add the "History" page to the settings tabview for opening the season history
+void createHistorySettingsPage() {
+    lv_obj_t *history_page = lv_tabview_add_tab(ui_TabView1, "History");
+    lv_obj_clear_flag(history_page, LV_OBJ_FLAG_SCROLLABLE);
+
+    history_summary_label = lv_label_create(history_page);
+    lv_obj_set_align(history_summary_label, LV_ALIGN_TOP_MID);
+    lv_obj_add_style(history_summary_label, &settings_title_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    createSettingsButton(history_page, "Show", LV_ALIGN_BOTTOM_MID, historyShowBtnClick);
+    updateHistorySummary();
+}
+
+#ifdef HISTORY_PROFILING
+#define HISTORY_PROFILE_STEPS 200
+#define HISTORY_PROFILE_STEP_PX 7   // About a fast finger drag per frame
+
+// Made-up bales for the profile, a bale every 75 s
+static uint32_t loadProfileRecords(void *ctx, uint32_t first, BaleRecord *out, uint32_t n) {
+    uint32_t count = *(uint32_t *)ctx;
+    uint32_t got = 0;
+    for (uint32_t i = first; i < count && got < n; i++, got++) {
+        baleRecordMake(&out[got], i * 75, i > 0 ? (int64_t)(i - 1) * 75 : -1, 10 + i % 5);
+    }
+    return got;
+}
+
+// Function to time one history redraw with the panel output discarded
+static uint32_t profileHistoryFrame(int32_t scroll_y) {
+    uint32_t start = micros();
+    scrollHistoryList(scroll_y);
+    lv_refr_now(NULL);
+    return micros() - start;
+}
+
+// Open the history screen on made-up seasons of 10, 1000 and 100000 bales and
+// print the LVGL heap it takes and the time per frame for a drag and a jump
+// through the list. Neither should grow with the number of bales.
+void profileHistoryList() {
+    static const uint32_t sizes[] = {10, 1000, 100000};
+    static uint32_t profile_count;
+    lv_disp_drv_t *drv = lv_disp_get_default()->driver;
+    auto flush_cb = drv->flush_cb;
+    auto wait_cb = drv->wait_cb;
+    auto monitor_cb = drv->monitor_cb;
+    drv->flush_cb = my_disp_discard;
+    drv->wait_cb = NULL;
+    drv->monitor_cb = NULL;
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t heap_before = lvglPool()->live_bytes;
+
+        profile_count = sizes[s];
+        openHistoryScreen();
+        historyCacheInit(&history_cache, loadProfileRecords, &profile_count);
+        history_view_count = profile_count;
+        vlistInvalidate(&history_list);
+        uint32_t first_frame_us = profileHistoryFrame(0);
+
+        uint32_t heap_used = lvglPool()->live_bytes - heap_before;
+
+        // Drag down from the top, then jump to the end and back to the middle
+        uint32_t total_us = 0, worst_us = 0;
+        for (int i = 1; i <= HISTORY_PROFILE_STEPS; i++) {
+            uint32_t us = profileHistoryFrame(i * HISTORY_PROFILE_STEP_PX);
+            total_us += us;
+            if (us > worst_us) worst_us = us;
+        }
+        uint32_t end_us = profileHistoryFrame(vlistMaxScroll(&history_list));
+        uint32_t middle_us = profileHistoryFrame(vlistMaxScroll(&history_list) / 2);
+
+        Serial.printf("History %lu bales: %lu bytes LVGL heap, first frame %lu us, "
+                      "drag %lu us average / %lu us worst, jump to end %lu us, to middle %lu us, %lu file reads\n",
+                      (unsigned long)profile_count, (unsigned long)heap_used, (unsigned long)first_frame_us,
+                      (unsigned long)(total_us / HISTORY_PROFILE_STEPS), (unsigned long)worst_us,
+                      (unsigned long)end_us, (unsigned long)middle_us, (unsigned long)history_cache.loads);
+
+        closeHistoryScreen();
+        lv_timer_handler();  // Runs the async delete
+    }
+    Serial.printf("History list: %u row slots, %u bytes of static list state\n", (unsigned)history_list.slots,
+                  (unsigned)(sizeof(history_list) + sizeof(history_cache) + sizeof(history_text) +
+                             sizeof(history_rows) + sizeof(history_cells)));
+    historyCacheInit(&history_cache, loadHistoryRecords, NULL);
+
+    drv->flush_cb = flush_cb;
+    drv->wait_cb = wait_cb;
+    drv->monitor_cb = monitor_cb;
+    lv_obj_invalidate(lv_scr_act());
+}
+#endif
+
+// Function to print LVGL's pool use and its allocations per size class (UI task)
+void printLvglPoolReport() {
+    MemPoolStats stats;
+    memPoolGetStats(lvglPool(), &stats);
+    Serial.printf("LVGL pool: %lu of %lu bytes used, peak %lu, largest free %lu in %lu free blocks, "
+                  "%u%% fragmented, %lu failed\n",
+                  (unsigned long)stats.live_bytes, (unsigned long)stats.size, (unsigned long)stats.peak_bytes,
+                  (unsigned long)stats.largest_free, (unsigned long)stats.free_blocks, (unsigned)stats.frag_pct,
+                  (unsigned long)stats.failed);
+    for (uint8_t c = 0; c < MEM_POOL_CLASSES; c++) {
+        const MemPoolClassStats *cls = &stats.classes[c];
+        if (cls->allocs > 0) {
+            Serial.printf("  %5lu+ bytes: %lu allocs, %lu frees, %lu live\n", (unsigned long)memPoolClassSize(c),
+                          (unsigned long)cls->allocs, (unsigned long)cls->frees, (unsigned long)cls->live);
+        }
+    }
+}
+
+#ifdef DISPLAY_PROFILING
+// Print how much of the LVGL heap is in use
+void printLvglHeap(const char *when) {
+    MemPoolStats stats;
+    memPoolGetStats(lvglPool(), &stats);
+    Serial.printf("LVGL heap %s: %lu bytes used, %u%% fragmented\n", when,
+                  (unsigned long)stats.live_bytes, (unsigned)stats.frag_pct);
+}
+#endif
+
+// The settings popup only exists while it is open (UI task, from LVGL events).
+// Closing it frees its objects, so new pages or screens cost no heap at boot.
+extern "C" {
+void openSettingsPopup() {
+    if (ui_SettingsPopupPanel != NULL) {
+        return;
+    }
+#ifdef DISPLAY_PROFILING
+    // Also shows that the last close gave all of its memory back
+    printLvglHeap("before settings open");
+    uint32_t start = micros();
+#endif
+    ui_SettingsPopup_create();
+    createJobSettingsPage();
+    createTouchSettingsPage();
+    createTrendSettingsPage();
+    createHistorySettingsPage();
+#ifdef DISPLAY_PROFILING
+    // The popup shows on the next redraw, printed by my_disp_monitor
+    Serial.printf("Settings popup built in %lu us\n", (unsigned long)(micros() - start));
+    printLvglHeap("with settings open");
+#endif
+}
+
+void closeSettingsPopup() {
+    if (ui_SettingsPopupPanel == NULL) {
+        return;
+    }
+    view_labels[VIEW_JOB_TARGET] = NULL;
+    job_target_label = NULL;
+    trend_chart = NULL;
+    trend_scale_label = NULL;
+    history_summary_label = NULL;
+    ui_SettingsPopup_destroy();
+}
+
+void toggleSettingsPopup() {
+    if (ui_SettingsPopupPanel != NULL) {
+        closeSettingsPopup();
+    } else {
+        openSettingsPopup();
+    }
+}
+}
+
+// Copy the changed view-model fields to their labels (UI task only)
+void applyViewModel() {
+    uint32_t dirty = viewTakeDirty(&view_model);
+    for (int field = 0; field < VIEW_FIELD_COUNT; field++) {
+        if (!(dirty & (1UL << field))) {
+            continue;
+        }
+        if (view_segments[field] != NULL) {
+            segmentDigitsSetText(view_segments[field], viewText(&view_model, (ViewField)field));
+        } else if (view_digits[field] != NULL) {
+            digitLabelSetText(view_digits[field], viewText(&view_model, (ViewField)field));
+        } else if (view_labels[field] != NULL) {
+            // The label shows the view-model's buffer directly, so nothing is copied or allocated
+            lv_label_set_text_static(view_labels[field], viewText(&view_model, (ViewField)field));
+        }
+#ifdef DISPLAY_PROFILING
+        label_updates++;
+#endif
+    }
+}
+
+// Apply the display updates requested by the sensor task (UI task only, once per frame)
+void applyDisplayUpdates() {
+    uint32_t updates = display_pending.exchange(0);
+    if (updates == 0) {
+        return;
+    }
+    // Published before the update bits, so at least as new as the changes
+    CountSnapshot counts;
+    readCounts(&counts);
+    if (updates & DISP_BALE_COUNT) updateBaleCountDisplay(&counts);
+    if (updates & DISP_BALE_COUNT_YEAR) updateBaleCountYearDisplay(&counts);
+    if (updates & DISP_FLAKE_COUNT) updateFlakeCountDisplay(&counts);
+    if (updates & DISP_FLAKE_PREV1) updateFlakeCountPrev1Display(&counts);
+    if (updates & DISP_FLAKE_PREV2) updateFlakeCountPrev2Display(&counts);
+    if (updates & DISP_BALES_PER_HOUR) updateBalesPerHourDisplay(&counts);
+    if (updates & DISP_FORECAST) updateForecastDisplay(&counts);
+    if (updates & DISP_JOB_TARGET) updateJobTargetDisplay(&counts);
+    if (updates & DISP_ANOMALY) updateAnomalyIndicator(&counts);
+    if (updates & DISP_RATE_TREND) updateRateTrendDisplay();
+    if (updates & DISP_HISTORY) updateHistoryDisplay();
+    applyViewModel();
+}
+
+#ifdef POOL_PROFILING
+#define POOL_SOAK_ROUNDS 500
+#define POOL_SOAK_MAX_FRAG 25       // Fragmentation allowed after the soak (percent)
+#define POOL_REPORT_MS 60000
+
+// Function to replay a long session of UI changes at boot: the settings popup
+// opened and closed, every display updated, and the history screen shown and
+// scrolled. The pool must end with the bytes it started with and bounded
+// fragmentation, or a long-running unit would run out of LVGL heap.
+void profileLvglPool() {
+    lv_disp_drv_t *drv = lv_disp_get_default()->driver;
+    auto flush_cb = drv->flush_cb;
+    auto wait_cb = drv->wait_cb;
+    auto monitor_cb = drv->monitor_cb;
+    drv->flush_cb = my_disp_discard;
+    drv->wait_cb = NULL;
+    drv->monitor_cb = NULL;
+
+    lv_refr_now(NULL);
+    MemPoolStats before, stats;
+    memPoolGetStats(lvglPool(), &before);
+    uint8_t worst_frag = before.frag_pct;
+    uint32_t start = millis();
+    for (int round = 1; round <= POOL_SOAK_ROUNDS; round++) {
+        openSettingsPopup();
+        display_pending.fetch_or(DISP_ALL);
+        applyDisplayUpdates();
+        lv_refr_now(NULL);
+        if (round % 4 == 0) {
+            closeSettingsPopup();
+            openHistoryScreen();
+            scrollHistoryList(round * HISTORY_ROW_H);
+            lv_refr_now(NULL);
+            closeHistoryScreen();
+        } else {
+            closeSettingsPopup();
+        }
+        lv_timer_handler();  // Runs the async deletes
+        memPoolGetStats(lvglPool(), &stats);
+        if (stats.frag_pct > worst_frag) worst_frag = stats.frag_pct;
+        if (round % 100 == 0) {
+            Serial.printf("Pool soak round %d: %lu bytes used, largest free %lu, %u%% fragmented\n", round,
+                          (unsigned long)stats.live_bytes, (unsigned long)stats.largest_free,
+                          (unsigned)stats.frag_pct);
+        }
+    }
+    lv_refr_now(NULL);
+    memPoolGetStats(lvglPool(), &stats);
+    bool intact = memPoolCheck(lvglPool());
+    int32_t leaked = (int32_t)(stats.live_bytes - before.live_bytes);
+    bool ok = intact && leaked == 0 && stats.frag_pct <= POOL_SOAK_MAX_FRAG && stats.failed == 0;
+    Serial.printf("Pool soak %s: %d rounds in %lu ms, %ld bytes leaked, %u%% fragmented (worst %u%%), "
+                  "peak %lu bytes, pool %s\n", ok ? "PASS" : "FAIL", POOL_SOAK_ROUNDS,
+                  (unsigned long)(millis() - start), (long)leaked, (unsigned)stats.frag_pct, (unsigned)worst_frag,
+                  (unsigned long)stats.peak_bytes, intact ? "intact" : "CORRUPT");
+    printLvglPoolReport();
+
+    drv->flush_cb = flush_cb;
+    drv->wait_cb = wait_cb;
+    drv->monitor_cb = monitor_cb;
+    lv_obj_invalidate(lv_scr_act());
+}
+
+// Print the pool report every minute (UI task, which owns LVGL's heap)
+uint32_t poolReportJob(void *arg) {
+    printLvglPoolReport();
+    return POOL_REPORT_MS;
+}
+#endif
+
+#ifdef LOG_PROFILING
+#define LOG_BENCH_CALLS 200
+
+// Function to time the bale messages printed the old way (Serial.print, which
+// waits once the UART buffer is full) against the same message queued with
+// logWrite(), then a burst that overfills the ring. Runs before the log task
+// starts, so the queued records are drained here and thrown away.
+void profileLogging() {
+    uint32_t serial_total = 0, serial_worst = 0;
+    Serial.flush();
+    for (int i = 0; i < LOG_BENCH_CALLS; i++) {
+        uint32_t start = micros();
+        Serial.print("Bale count incremented to: ");
+        Serial.println(bale_count + i);
+        Serial.print("Current rate: ");
+        Serial.print(bales_per_hour);
+        Serial.println(" bales/hour");
+        uint32_t us = micros() - start;
+        serial_total += us;
+        if (us > serial_worst) serial_worst = us;
+    }
+    Serial.flush();
+
+    LogRecord rec;
+    uint32_t log_total = 0, log_worst = 0;
+    for (int i = 0; i < LOG_BENCH_CALLS; i++) {
+        uint32_t start = micros();
+        logWrite(LOG_LEVEL_INFO, "Bale count incremented to: %d, current rate: %.2f bales/hour", bale_count + i,
+                 bales_per_hour);
+        uint32_t us = micros() - start;
+        log_total += us;
+        if (us > log_worst) log_worst = us;
+        logRingPop(&log_ring, &rec);
+    }
+
+    // Nothing drains during the burst: the ring fills and the rest are dropped
+    uint32_t dropped = log_ring.dropped.load();
+    uint32_t burst_worst = 0;
+    for (int i = 0; i < LOG_BENCH_CALLS; i++) {
+        uint32_t start = micros();
+        logWrite(LOG_LEVEL_INFO, "Burst record %d", i);
+        uint32_t us = micros() - start;
+        if (us > burst_worst) burst_worst = us;
+    }
+    dropped = log_ring.dropped.load() - dropped;
+    logRingInit(&log_ring);
+
+    Serial.printf("Serial.print: %lu us per message, worst %lu us\n",
+                  (unsigned long)(serial_total / LOG_BENCH_CALLS), (unsigned long)serial_worst);
+    Serial.printf("Async log: %lu.%02lu us per message, worst %lu us\n",
+                  (unsigned long)(log_total / LOG_BENCH_CALLS),
+                  (unsigned long)(log_total * 100 / LOG_BENCH_CALLS % 100), (unsigned long)log_worst);
+    Serial.printf("Async log burst of %d: %lu dropped, worst %lu us\n", LOG_BENCH_CALLS,
+                  (unsigned long)dropped, (unsigned long)burst_worst);
+}
+#endif
+
+// Turn the display back on after idle (sensor task). The reason is logged
+// as a pointer, so it must be a string literal.
+void wakeDisplay(const char *reason) {
+    display_asleep.store(false);
+    // Counts changed while asleep were never rendered
+    requestDisplayUpdate(DISP_ALL);
+    schedWake(&ui_sched, lvgl_job);
+    schedWake(&ui_sched, backlight_job);
+    LOG_INFO("Display on: %s", reason);
+}
+
+// Turn the display off and stop rendering (sensor task)
+void sleepDisplay() {
+    display_asleep.store(true);
+    schedWake(&ui_sched, backlight_job);
+    LOG_INFO("Display off: idle");
+}
+
+// A touch or a bale keeps the display on, or turns it back on
+void userActivity(const char *reason) {
+    if (powerOnActivity(&power, millis())) {
+        wakeDisplay(reason);
+    }
+}
+
+// Run the commands posted by the UI task (sensor task only)
+void processCountCommands() {
+    uint32_t commands = command_pending.exchange(0);
+    if (commands == 0) {
+        return;
+    }
+    if (commands & CMD_RESET_FLAKES) resetFlakeCount();
+    if (commands & CMD_RESET_BALES) resetBaleCount();
+    if (commands & CMD_RESET_YEAR) resetBaleCountYear();
+    if (commands & CMD_SET_TARGET) setBaleTarget(pending_target.load());
+    if (commands & CMD_TARGET_DELTA) {
+        int64_t target = (int64_t)forecast.target + pending_target_delta.exchange(0);
+        setBaleTarget(target > 0 ? (uint32_t)target : 0);
+    }
+    if (commands & CMD_ACK_ANOMALY) {
+        anomalyAcknowledge(&anomaly);
+        requestDisplayUpdate(DISP_ANOMALY);
+    }
+    if (commands & CMD_USER_ACTIVITY) userActivity("touch");
+    if (commands & CMD_SAVE_TOUCH_CAL) {
+        preferences.putBytes("touch_cal", &pending_touch_cal, sizeof(pending_touch_cal));
+        LOG_INFO("Touch calibration saved to preferences");
+    }
+}
+
+// Count on the ON -> OFF edge. Repeated levels and contact bounce are ignored.
+void handleSensorEdge(uint8_t sensor, bool active, uint32_t time_ms) {
+    bool *last_active = (sensor == SENSOR_BALE) ? &bale_sensor_active : &flake_sensor_active;
+    if (active == *last_active) {
+        return;
+    }
+    if ((int32_t)(time_ms - sensor_last_edge_ms[sensor]) < SENSOR_DEBOUNCE_MS) {
+        // The last edge of a burst may be the real one, so the pin is read again later
+        uint32_t settle = sensor_last_edge_ms[sensor] + SENSOR_DEBOUNCE_MS;
+        if (!sensor_settle_pending || (int32_t)(settle - sensor_settle_ms) > 0) {
+            sensor_settle_ms = settle;
+        }
+        sensor_settle_pending = true;
+        return;
+    }
+    sensor_last_edge_ms[sensor] = time_ms;
+    *last_active = active;
+    anomalyOnEdge(&anomaly, (SensorId)sensor, active, time_ms);
+
+    if (sensor == SENSOR_BALE) {
+        if (active) {  // Sensor triggered (active LOW)
+            LOG_DEBUG("Bale sensor triggered: ON");
+        } else {
+            LOG_DEBUG("Bale sensor state: OFF");
             
-            lastTouchTime = currentTime;
-            touchProcessed = true;
+            // Increment counter when sensor goes from ON (LOW) to OFF (HIGH) - end of detection
+            incrementBaleCount();
+            LOG_INFO("Bale detected by sensor!");
+            userActivity("bale");
+        }
+    } else {
+        if (active) {  // Sensor triggered (active LOW)
+            LOG_DEBUG("Flake sensor triggered: ON");
+        } else {
+            LOG_DEBUG("Flake sensor state: OFF");
+            
+            // Increment counter when sensor goes from ON (LOW) to OFF (HIGH) - end of detection
+            incrementFlakeCount();
+            LOG_DEBUG("Flake detected by sensor!");
+        }
+    }
+}
+
+// Read both sensor pins directly (after a light sleep, when the interrupts were off)
+void syncSensors() {
+    uint32_t now = millis();
+    handleSensorEdge(SENSOR_BALE, digitalRead(BALE_SENSOR_PIN) == LOW, now);
+    handleSensorEdge(SENSOR_FLAKE, digitalRead(FLAKE_SENSOR_PIN) == LOW, now);
+}
+
+// Count the edges captured by the interrupts
+void pollSensors()
+{
+    SensorEdge edge;
+    while (edgeRingPop(&sensor_edges, &edge)) {
+#ifdef TASK_PROFILING
+        uint32_t latency = millis() - edge.time_ms;
+        if (latency > sensor_max_latency_ms) {
+            sensor_max_latency_ms = latency;
+        }
+#endif
+#ifdef IRAM_PROFILING
+        // A bale ending also appends to the history file, so it is kept apart
+        CyclePath path = (edge.sensor == SENSOR_BALE && !edge.active && bale_sensor_active) ? CYCLES_BALE : CYCLES_EDGE;
+        uint32_t cycles_start = cycleCount();
+#endif
+        handleSensorEdge(edge.sensor, edge.active, edge.time_ms);
+#ifdef IRAM_PROFILING
+        cycleStatAdd(path, cycles_start);
+#endif
+    }
+}
+
+// GPIO interrupts: record the new level and wake the sensor job. They are
+// registered with ESP_INTR_FLAG_IRAM, so they also run while a flash write
+// has the cache off: everything they call must be in IRAM, and the pins and
+// the clock are read without Arduino's digitalRead() and millis(), which are in flash.
+static inline __attribute__((always_inline)) uint32_t isrMillis() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static inline __attribute__((always_inline)) bool isrPinLow(int pin) {
+    return gpio_ll_get_level(&GPIO, (gpio_num_t)pin) == 0;
+}
+
+void IRAM_ATTR wakeSensorJobFromIsr() {
+    if (schedMarkWoken(&sensor_sched, sensor_job) && sensor_task_handle != NULL) {
+        BaseType_t higher_woken = pdFALSE;
+        vTaskNotifyGiveFromISR(sensor_task_handle, &higher_woken);
+        if (higher_woken) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+void IRAM_ATTR baleSensorIsr(void *arg) {
+#ifdef IRAM_PROFILING
+    uint32_t cycles_start = cycleCount();
+#endif
+    edgeRingPush(&sensor_edges, isrMillis(), SENSOR_BALE, isrPinLow(BALE_SENSOR_PIN));
+    wakeSensorJobFromIsr();
+#ifdef IRAM_PROFILING
+    cycleStatAdd(CYCLES_ISR, cycles_start);
+#endif
+}
+
+void IRAM_ATTR flakeSensorIsr(void *arg) {
+#ifdef IRAM_PROFILING
+    uint32_t cycles_start = cycleCount();
+#endif
+    edgeRingPush(&sensor_edges, isrMillis(), SENSOR_FLAKE, isrPinLow(FLAKE_SENSOR_PIN));
+    wakeSensorJobFromIsr();
+#ifdef IRAM_PROFILING
+    cycleStatAdd(CYCLES_ISR, cycles_start);
+#endif
+}
+
+// Add a pin's handler to the GPIO ISR service and enable its interrupt
+void attachGpioIsr(int pin, gpio_int_type_t type, gpio_isr_t handler) {
+    gpio_set_intr_type((gpio_num_t)pin, type);
+    gpio_isr_handler_add((gpio_num_t)pin, handler, NULL);
+    gpio_intr_enable((gpio_num_t)pin);
+}
+
+// Light-sleep until the next deadline or until a sensor changes or the screen is touched
+void lightSleep(uint32_t wait_ms) {
+    if (wait_ms > LIGHT_SLEEP_MAX_MS) {
+        wait_ms = LIGHT_SLEEP_MAX_MS;
+    }
+    Serial.flush();
+
+    // GPIO wakeup uses level triggers, so the edge interrupts are paused while asleep.
+    // Each sensor wakes on the level opposite to the one last counted.
+    gpio_intr_disable((gpio_num_t)BALE_SENSOR_PIN);
+    gpio_intr_disable((gpio_num_t)FLAKE_SENSOR_PIN);
+    gpio_intr_disable((gpio_num_t)XPT2046_IRQ);
+    gpio_wakeup_enable((gpio_num_t)BALE_SENSOR_PIN, bale_sensor_active ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)FLAKE_SENSOR_PIN, flake_sensor_active ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)XPT2046_IRQ, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)wait_ms * 1000ULL);
+
+    uint32_t start = millis();
+    esp_light_sleep_start();
+    powerOnSleep(&power, millis() - start);
+
+    // Back to edge interrupts (T_IRQ uses a falling edge)
+    gpio_wakeup_disable((gpio_num_t)BALE_SENSOR_PIN);
+    gpio_wakeup_disable((gpio_num_t)FLAKE_SENSOR_PIN);
+    gpio_wakeup_disable((gpio_num_t)XPT2046_IRQ);
+    gpio_set_intr_type((gpio_num_t)BALE_SENSOR_PIN, GPIO_INTR_ANYEDGE);
+    gpio_set_intr_type((gpio_num_t)FLAKE_SENSOR_PIN, GPIO_INTR_ANYEDGE);
+    gpio_set_intr_type((gpio_num_t)XPT2046_IRQ, GPIO_INTR_NEGEDGE);
+    gpio_intr_enable((gpio_num_t)BALE_SENSOR_PIN);
+    gpio_intr_enable((gpio_num_t)FLAKE_SENSOR_PIN);
+    gpio_intr_enable((gpio_num_t)XPT2046_IRQ);
+
+    // Catch the edge that woke us
+    syncSensors();
+}
+
+// While idle, a touch (T_IRQ low) turns the display on without being passed to the UI
+void checkTouchWake() {
+    if (power.mode == POWER_IDLE && digitalRead(XPT2046_IRQ) == LOW) {
+        swallow_touch.store(true);
+        userActivity("touch");
+    }
+}
+
+#ifdef TASK_PROFILING
+// Print how often each job ran and its worst deadline miss, then reset the miss
+void debugScheduler(const char *task, Scheduler *sc) {
+    for (uint8_t i = 0; i < sc->count; i++) {
+        Serial.print(task);
+        Serial.print(" job ");
+        Serial.print(sc->jobs[i].name);
+        Serial.print(": runs ");
+        Serial.print(sc->jobs[i].runs);
+        Serial.print(", worst lateness ");
+        Serial.print(sc->jobs[i].max_late_ms);
+        Serial.println(" ms");
+        sc->jobs[i].max_late_ms = 0;
+    }
+}
+
+uint32_t reportTaskLoad(void *arg) {
+    static uint32_t period_start = 0;
+    uint32_t now = micros();
+    uint32_t elapsed = now - period_start;
+    Serial.print("CPU load - UI task: ");
+    Serial.print(ui_busy_us * 100.0 / elapsed, 1);
+    Serial.print("%, sensor task: ");
+    Serial.print(sensor_busy_us * 100.0 / elapsed, 1);
+    Serial.print("%, worst sensor edge latency: ");
+    Serial.print(sensor_max_latency_ms);
+    Serial.print(" ms, edges dropped: ");
+    Serial.println(sensor_edges.dropped.load());
+    debugScheduler("ui", &ui_sched);
+    debugScheduler("sensors", &sensor_sched);
+    debugScheduler("serial", &serial_sched);
+    ui_busy_us = 0;
+    sensor_busy_us = 0;
+    sensor_max_latency_ms = 0;
+    period_start = now;
+    return PROFILE_REPORT_MS;
+}
+#endif
+
+// Scheduler clock and wake-up hooks
+uint32_t schedulerMillis() {
+    return millis();
+}
+
+void notifyTask(void *ctx) {
+    TaskHandle_t task = *(TaskHandle_t *)ctx;
+    if (task != NULL) {
+        xTaskNotifyGive(task);
+    }
+}
+
+// UI job
+// Display updates posted since the last run are applied in one go right
+// before LVGL renders, so a burst of counts costs one redraw
+uint32_t lvglJob(void *arg) {
+    if (display_asleep.load()) {
+        // Idle mode: stop rendering until wakeDisplay()
+        return SCHED_IDLE;
+    }
+#ifdef TASK_PROFILING
+    uint32_t start = micros();
+#endif
+    lvglLock();
+    applyDisplayUpdates();
+    uint32_t next = lv_timer_handler(); /* let the GUI do its work */
+    lvglUnlock();
+#ifdef TASK_PROFILING
+    ui_busy_us += micros() - start;
+#endif
+    // Sleep until LVGL's next timer is due
+    if (next < 1) next = 1;
+    if (next > UI_MAX_SLEEP_MS) next = UI_MAX_SLEEP_MS;
+    return next;
+}
+
+// Woken by T_IRQ: read the touch now and poll fast until the pen lifts
+uint32_t touchJob(void *arg) {
+    lvglLock();
+    lv_timer_set_period(touch_read_timer, TOUCH_POLL_ACTIVE_MS);
+    lv_timer_ready(touch_read_timer);
+    lvglUnlock();
+    schedWake(&ui_sched, lvgl_job);
+    return SCHED_IDLE;
+}
+
+// Woken by wakeDisplay() and sleepDisplay(), so only the UI task writes the
+// backlight PWM and the brightness zones can't race it. Runs after the
+// lvgl job, so the display comes on with the counts already drawn.
+uint32_t backlightJob(void *arg) {
+    if (display_asleep.load()) {
+        analogWrite(21, 0);
+    } else {
+        applyBrightness();
+    }
+    return SCHED_IDLE;
+}
+
+// Sensor jobs
+uint32_t commandJob(void *arg) {
+    processCountCommands();
+    return SCHED_IDLE;
+}
+
+// Woken by the sensor interrupts, and again when a bounce has settled
+uint32_t sensorPollJob(void *arg) {
+    pollSensors();
+    if (!sensor_settle_pending) {
+        return SCHED_IDLE;
+    }
+    int32_t wait = (int32_t)(sensor_settle_ms - millis());
+    if (wait > 0) {
+        return (uint32_t)wait;
+    }
+    sensor_settle_pending = false;
+    syncSensors();
+    return sensor_settle_pending ? SENSOR_DEBOUNCE_MS : SCHED_IDLE;
+}
+
+uint32_t persistJob(void *arg) {
+#ifdef IRAM_PROFILING
+    nvsWriteBegin();
+#endif
+    saveChangedCounts();
+#ifdef IRAM_PROFILING
+    nvsWriteEnd();
+#endif
+    return SCHED_IDLE;
+}
+
+uint32_t forecastJob(void *arg) {
+    forecastTimerTick();
+    return FORECAST_TICK_MS;
+}
+
+uint32_t anomalyJob(void *arg) {
+    anomalyTimerTick();
+    return ANOMALY_TICK_MS;
+}
+
+// Turn the display off after the idle timeout
+uint32_t powerJob(void *arg) {
+    if (powerTick(&power, millis())) {
+        sleepDisplay();
+    }
+    return POWER_TICK_MS;
+}
+
+#ifdef POWER_PROFILING
+#define POWER_REPORT_MS 60000
+uint32_t powerReportJob(void *arg) {
+    static const char *mode_names[POWER_MODE_COUNT] = {"active", "idle"};
+    PowerStats stats;
+    powerTakeStats(&power, millis(), &stats);
+    for (int m = 0; m < POWER_MODE_COUNT; m++) {
+        if (stats.mode_ms[m] == 0) {
+            continue;
+        }
+        float minutes = stats.mode_ms[m] / 60000.0f;
+        Serial.print("Power ");
+        Serial.print(mode_names[m]);
+        Serial.print(": ");
+        Serial.print(stats.mode_ms[m] / 1000);
+        Serial.print(" s, CPU awake ");
+        Serial.print(100.0f - stats.sleep_ms[m] * 100.0f / stats.mode_ms[m], 1);
+        Serial.print("%, sensor task wakeups/min ");
+        Serial.print(stats.wakeups[m] / minutes, 0);
+        Serial.print(", UI task wakeups/min ");
+        Serial.println(ui_wakeups[m] / minutes, 0);
+        ui_wakeups[m] = 0;
+    }
+    return POWER_REPORT_MS;
+}
+#endif
+
+#ifdef IRAM_PROFILING
+// Write a scratch key over and over, so NVS writes overlap the hot paths
+// (profiling only - it wears the flash). It is its own task on the UI core
+// with its own namespace: a job on sensor_sched would only ever write between
+// two edges, never during one. Every IRAM_REPORT_MS, print each hot path's
+// worst case in cycles and microseconds, apart from and with NVS writes.
+void iramProfileTask(void *arg) {
+    Preferences scratch;
+    scratch.begin("iram-prof", false);
+    uint32_t writes = 0;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(NVS_STRESS_MS));
+        nvsWriteBegin();
+        scratch.putUInt("scratch", ++writes);
+        nvsWriteEnd();
+        if (writes % (IRAM_REPORT_MS / NVS_STRESS_MS) != 0) {
+            continue;
+        }
+
+        uint32_t mhz = getCpuFrequencyMhz();
+        Serial.printf("Hot paths (%lu NVS writes so far):\n", (unsigned long)nvs_write_seq.load());
+        for (int i = 0; i < CYCLE_PATH_COUNT; i++) {
+            const CycleStat *st = &cycle_stats[i];
+            Serial.printf("  %-28s worst %6lu cycles (%4lu us) in %lu runs, with NVS writes %6lu cycles (%4lu us) in %lu runs\n",
+                          cycle_path_names[i], (unsigned long)st->worst, (unsigned long)(st->worst / mhz),
+                          (unsigned long)st->count, (unsigned long)st->worst_nvs, (unsigned long)(st->worst_nvs / mhz),
+                          (unsigned long)st->count_nvs);
+        }
+    }
+}
+#endif
+
+#ifdef ALLOC_PROFILING
+#define ALLOC_REPORT_MS 10000
+// The first run marks the end of boot, later runs report any allocation since
+uint32_t allocReportJob(void *arg) {
+    static bool booted = false;
+    if (!booted) {
+        allocMarkSteadyState();
+        booted = true;
+        Serial.print("Heap allocations during boot: ");
+        Serial.println(allocCount());
+        return ALLOC_REPORT_MS;
+    }
+    uint32_t allocs = allocSinceSteadyState();
+    Serial.print("Heap allocations since boot: ");
+    Serial.println(allocs);
+    if (allocs > 0) {
+        Serial.println("WARNING: steady state is allocating");
+    }
+    return ALLOC_REPORT_MS;
+}
+#endif
+
+// Register the jobs of both tasks (before the tasks start)
+void setupSchedulers() {
+    schedInit(&ui_sched, schedulerMillis, notifyTask, &ui_task_handle);
+    lvgl_job = schedAdd(&ui_sched, "lvgl", lvglJob, NULL, 0);
+    touch_job = schedAdd(&ui_sched, "touch", touchJob, NULL, SCHED_IDLE);
+    backlight_job = schedAdd(&ui_sched, "backlight", backlightJob, NULL, SCHED_IDLE);
+#ifdef POOL_PROFILING
+    schedAdd(&ui_sched, "pool report", poolReportJob, NULL, POOL_REPORT_MS);
+#endif
+
+    schedInit(&sensor_sched, schedulerMillis, notifyTask, &sensor_task_handle);
+    command_job = schedAdd(&sensor_sched, "commands", commandJob, NULL, SCHED_IDLE);
+    sensor_job = schedAdd(&sensor_sched, "sensors", sensorPollJob, NULL, SCHED_IDLE);
+    persist_job = schedAdd(&sensor_sched, "persist", persistJob, NULL, SCHED_IDLE);
+    schedAdd(&sensor_sched, "forecast", forecastJob, NULL, FORECAST_TICK_MS);
+    schedAdd(&sensor_sched, "anomaly", anomalyJob, NULL, ANOMALY_TICK_MS);
+#ifdef IDLE_MODE_ENABLED
+    schedAdd(&sensor_sched, "power", powerJob, NULL, POWER_TICK_MS);
+#endif
+#ifdef TASK_PROFILING
+    schedAdd(&sensor_sched, "report", reportTaskLoad, NULL, PROFILE_REPORT_MS);
+#endif
+#ifdef POWER_PROFILING
+    schedAdd(&sensor_sched, "power report", powerReportJob, NULL, POWER_REPORT_MS);
+#endif
+#ifdef ALLOC_PROFILING
+    schedAdd(&sensor_sched, "allocs", allocReportJob, NULL, ALLOC_REPORT_MS);
+#endif
+}
+
+// Sleep until a scheduler's next deadline or a wake from another task
+void waitForScheduler(uint32_t wait_ms) {
+    ulTaskNotifyTake(pdTRUE, wait_ms == SCHED_IDLE ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms));
+}
+
+// LVGL rendering task: the only task that touches LVGL objects
+void uiTask(void *param)
+{
+    for (;;) {
+        uint32_t wait_ms = schedRunDue(&ui_sched);
+        waitForScheduler(wait_ms);
+        ui_wakeups[power.mode]++;
+    }
+}
+
+// Telemetry frames (serial task)
+#define TELEMETRY_STATUS_MS 5000   // Status event period
+#define TELEMETRY_BATCH_MS 1000    // Longest an event waits for its batch to fill
+static TelemetryEvent telemetry_batch[TELEMETRY_BATCH_MAX];
+static uint8_t telemetry_batch_size = 1;   // Events per frame, from "telemetry on <n>"
+static uint8_t telemetry_batched = 0;
+static uint32_t telemetry_batch_start = 0; // millis() of the first event in the batch
+static uint32_t telemetry_status_due = 0;
+static uint16_t telemetry_seq = 0;
+static uint8_t telemetry_packed[TELEMETRY_PACKED_MAX];
+static uint32_t telemetry_frames = 0;
+static uint32_t telemetry_bytes = 0;       // Frame bytes sent
+static uint32_t log_text_bytes = 0;        // Log text bytes sent
+
+// Function to send the batched events as one frame
+static void flushTelemetry() {
+    if (telemetry_batched == 0) {
+        return;
+    }
+    size_t len = telemetryPack(telemetry_packed, telemetry_seq++, telemetry_batch, telemetry_batched);
+    Serial.write(telemetry_packed, len);
+    telemetry_frames++;
+    telemetry_bytes += len;
+    telemetry_batched = 0;
+}
+
+static void addTelemetryEvent(const TelemetryEvent *ev) {
+    if (telemetry_batched == 0) {
+        telemetry_batch_start = millis();
+    }
+    telemetry_batch[telemetry_batched++] = *ev;
+    if (telemetry_batched >= telemetry_batch_size) {
+        flushTelemetry();
+    }
+}
+
+// Function to fill a status event from the published snapshot, since the
+// counters belong to the sensor task. Takes the worst loop time and starts
+// the next period.
+static void makeStatusEvent(TelemetryEvent *ev) {
+    CountSnapshot counts;
+    readCounts(&counts);
+    ev->type = TELEM_STATUS;
+    ev->alerts = (uint8_t)counts.alerts_active;
+    ev->time_us = (uint64_t)esp_timer_get_time();
+    ev->bale_count = counts.bale_count;
+    ev->bale_count_year = counts.bale_count_year;
+    ev->flake_count = telemetryClamp(counts.flake_count);
+    ev->bales_in_session = telemetryClamp(counts.bales_in_session);
+    ev->rate_x10 = telemetryClamp((uint32_t)(counts.bales_per_hour * 10.0f + 0.5f));
+    ev->loop_us = telemetryClamp(sensor_loop_us.load());
+    ev->loop_max_us = telemetryClamp(sensor_loop_max_us.exchange(0));
+}
+
+// Function to send the queued count events, and a status event every
+// TELEMETRY_STATUS_MS. A part-filled batch goes out after TELEMETRY_BATCH_MS.
+static void sendTelemetry() {
+    TelemetryEvent ev;
+    while (telemetryQueuePop(&telemetry_queue, &ev)) {
+        addTelemetryEvent(&ev);
+    }
+    uint32_t now = millis();
+    if ((int32_t)(now - telemetry_status_due) >= 0) {
+        makeStatusEvent(&ev);
+        addTelemetryEvent(&ev);
+        telemetry_status_due = now + TELEMETRY_STATUS_MS;
+    }
+    if (telemetry_batched > 0 && now - telemetry_batch_start >= TELEMETRY_BATCH_MS) {
+        flushTelemetry();
+    }
+}
+
+// Function to turn telemetry on with batch events per frame, or off (batch 0)
+static void setTelemetry(uint8_t batch) {
+    if (batch == 0) {
+        telemetry_on.store(false);
+        flushTelemetry();
+        return;
+    }
+    // Nothing is queued while off; drop anything left from the last time on
+    TelemetryEvent ev;
+    while (telemetryQueuePop(&telemetry_queue, &ev)) {
+    }
+    telemetry_batch_size = batch;
+    telemetry_status_due = millis();
+    telemetry_on.store(true);
+    schedWake(&serial_sched, telemetry_job);
+}
+
+// Serial command console (see console.h). Runs in the serial task.
+static ConsoleInput console_input;
+static bool wall_clock_set = false;
+static uint32_t wall_clock_offset_s = 0;   // Unix time minus the season clock, from "time"
+static BaleRecord export_records[HISTORY_CHUNK_RECORDS];
+static char export_chunk[HISTORY_CHUNK_MAX];
+
+static const char *const console_help[] = {
+    "status            counts, rate, target and clocks",
+    "stats             log, sensor edge and memory statistics",
+    "target <n>|off    set the job bale target",
+    "reset flakes|bales|year",
+    "ack               acknowledge the sensor alerts",
+    "time [unix]       show or set the wall clock",
+    "history [cursor]  stream the season history from record cursor on",
+    "telemetry on [n]|off  binary count events instead of log text, n per frame",
+};
+
+// Function to print the counters and the job state, from the snapshot the
+// sensor task publishes (the counters themselves belong to that task)
+static void consoleStatus() {
+    CountSnapshot counts;
+    readCounts(&counts);
+    Serial.printf("@bales %lu\n@year %lu\n", (unsigned long)counts.bale_count, (unsigned long)counts.bale_count_year);
+    Serial.printf("@flakes %lu %lu %lu\n", (unsigned long)counts.flake_count, (unsigned long)counts.flake_prev1,
+                  (unsigned long)counts.flake_prev2);
+    Serial.printf("@session %lu\n@rate %.1f\n", (unsigned long)counts.bales_in_session, counts.bales_per_hour);
+    Serial.printf("@target %lu\n@remaining %lu\n", (unsigned long)counts.target, (unsigned long)counts.remaining);
+    if (counts.target != 0 && counts.eta_valid) {
+        Serial.printf("@eta_s %lu\n", (unsigned long)(counts.eta_ms / 1000));
+    }
+    Serial.printf("@history %lu\n@alerts %lu\n", (unsigned long)history_count.load(),
+                  (unsigned long)counts.alerts_active);
+    uint32_t season_s = historyClockNow();
+    Serial.printf("@clock %lu\n@uptime_s %lu\n", (unsigned long)season_s, (unsigned long)(millis() / 1000));
+    if (wall_clock_set) {
+        Serial.printf("@time %lu\n", (unsigned long)(season_s + wall_clock_offset_s));
+    }
+}
+
+// Function to print the log, sensor and memory statistics
+static void consoleStats() {
+    Serial.printf("@log %lu %lu\n", (unsigned long)log_ring.written.load(), (unsigned long)log_ring.dropped.load());
+    Serial.printf("@edges_dropped %lu\n", (unsigned long)sensor_edges.dropped.load());
+    Serial.printf("@history_dropped %lu\n", (unsigned long)history_queue.dropped.load());
+    Serial.printf("@heap %lu %lu\n", (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+    MemPoolStats pool;
+    lvglLock();  // The UI task allocates from the pool while it holds the lock
+    memPoolGetStats(lvglPool(), &pool);
+    lvglUnlock();
+    Serial.printf("@lvgl_pool %lu %lu %lu %lu %u %lu\n", (unsigned long)pool.size, (unsigned long)pool.live_bytes,
+                  (unsigned long)pool.peak_bytes, (unsigned long)pool.largest_free, (unsigned)pool.frag_pct,
+                  (unsigned long)pool.failed);
+    CountSnapshot counts;
+    readCounts(&counts);
+    Serial.printf("@anomalies %lu\n", (unsigned long)counts.alerts_total);
+    Serial.printf("@serial_bytes %lu %lu\n", (unsigned long)log_text_bytes, (unsigned long)telemetry_bytes);
+    Serial.printf("@telemetry %s %u %lu %lu\n", telemetry_on.load() ? "on" : "off", (unsigned)telemetry_batch_size,
+                  (unsigned long)telemetry_frames, (unsigned long)telemetry_queue.dropped.load());
+}
+
+// Function to stream the season history from record cursor on. Each chunk
+// goes out in one Serial.write, so no other print can land inside it.
+static void consoleHistory(uint32_t cursor) {
+    uint32_t count = history_count.load();
+    if (cursor > count) {
+        Serial.printf("@err cursor past the last record (%lu)\n", (unsigned long)count);
+        return;
+    }
+    uint32_t generation = history_generation.load();
+    Serial.printf("@history %lu\n", (unsigned long)count);
+    while (cursor < count) {
+        uint32_t n = count - cursor;
+        if (n > HISTORY_CHUNK_RECORDS) n = HISTORY_CHUNK_RECORDS;
+        uint32_t got = loadHistoryRecords(NULL, cursor, export_records, n);
+        if (history_generation.load() != generation) {
+            Serial.println("@err history cleared");
+            return;
+        }
+        if (got != n) {
+            Serial.printf("@err read failed at %lu\n", (unsigned long)cursor);
+            return;
+        }
+        size_t len = historyChunkEncode(export_chunk, cursor, export_records, n);
+        Serial.write((const uint8_t *)export_chunk, len);
+        cursor += n;
+    }
+    uint32_t season_s = historyClockNow();
+    Serial.printf("@end %lu %lu %lu\n", (unsigned long)cursor, (unsigned long)season_s,
+                  wall_clock_set ? (unsigned long)(season_s + wall_clock_offset_s) : 0UL);
+    Serial.println("@ok");
+}
+
+// Function to run one console line. Changes go through the same commands as
+// the settings buttons, so the sensor task applies them.
+static void runConsoleCommand(char *line) {
+    char *argv[CONSOLE_MAX_ARGS];
+    int argc = consoleSplit(line, argv, CONSOLE_MAX_ARGS);
+    uint32_t value = 0;
+    if (argc == 0) {
+        return;
+    }
+    const char *cmd = argv[0];
+    if (strcmp(cmd, "help") == 0) {
+        for (const char *text : console_help) {
+            Serial.printf("@ %s\n", text);
+        }
+    } else if (strcmp(cmd, "status") == 0) {
+        consoleStatus();
+    } else if (strcmp(cmd, "stats") == 0) {
+        consoleStats();
+    } else if (strcmp(cmd, "target") == 0 && argc == 2) {
+        if (strcmp(argv[1], "off") == 0) {
+            value = 0;
+        } else if (!consoleParseU32(argv[1], &value)) {
+            Serial.println("@err target must be a number or off");
+            return;
+        }
+        requestBaleTarget(value);
+    } else if (strcmp(cmd, "reset") == 0 && argc == 2) {
+        if (strcmp(argv[1], "flakes") == 0) {
+            requestResetFlakeCount();
+        } else if (strcmp(argv[1], "bales") == 0) {
+            requestResetBaleCount();
+        } else if (strcmp(argv[1], "year") == 0) {
+            requestResetBaleCountYear();
+        } else {
+            Serial.println("@err reset flakes, bales or year");
+            return;
+        }
+    } else if (strcmp(cmd, "ack") == 0) {
+        postCountCommand(CMD_ACK_ANOMALY);
+    } else if (strcmp(cmd, "time") == 0 && argc <= 2) {
+        if (argc == 2) {
+            if (!consoleParseU32(argv[1], &value)) {
+                Serial.println("@err time is seconds since 1970");
+                return;
+            }
+            wall_clock_offset_s = value - historyClockNow();
+            wall_clock_set = true;
+        }
+        if (wall_clock_set) {
+            Serial.printf("@time %lu\n", (unsigned long)(historyClockNow() + wall_clock_offset_s));
+        } else {
+            Serial.println("@time unset");
+        }
+    } else if (strcmp(cmd, "telemetry") == 0 && argc >= 2 && argc <= 3) {
+        if (strcmp(argv[1], "off") == 0 && argc == 2) {
+            setTelemetry(0);
+        } else if (strcmp(argv[1], "on") == 0) {
+            value = 1;
+            if (argc == 3 && (!consoleParseU32(argv[2], &value) || value < 1 || value > TELEMETRY_BATCH_MAX)) {
+                Serial.printf("@err batch must be 1 to %d\n", TELEMETRY_BATCH_MAX);
+                return;
+            }
+            Serial.println("@ok");  // Before the first frame
+            setTelemetry((uint8_t)value);
+            return;
+        } else {
+            Serial.println("@err telemetry on [n] or off");
+            return;
+        }
+    } else if (strcmp(cmd, "history") == 0 && argc <= 2) {
+        if (argc == 2 && !consoleParseU32(argv[1], &value)) {
+            Serial.println("@err cursor must be a record number");
+            return;
+        }
+        consoleHistory(value);  // Ends with its own @ok or @err
+        return;
+    } else {
+        Serial.printf("@err unknown command %s, try help\n", cmd);
+        return;
+    }
+    Serial.println("@ok");
+}
+
+// Function to read console input without waiting
+static void pollConsole() {
+    while (Serial.available() > 0) {
+        if (!consoleInputFeed(&console_input, (char)Serial.read())) {
+            continue;
+        }
+        if (console_input.overflow) {
+            Serial.println("@err line too long");
+        } else {
+            runConsoleCommand(console_input.line);
+        }
+    }
+}
+
+// Serial jobs
+// Each is woken by the queue it drains, so the serial task sleeps until
+// there is work instead of polling.
+uint32_t historyJob(void *arg) {
+    writeBaleHistory();
+    return SCHED_IDLE;
+}
+
+uint32_t consoleJob(void *arg) {
+    pollConsole();
+    return SCHED_IDLE;
+}
+
+// Also runs for the next status event or part-filled batch while on
+uint32_t telemetryJob(void *arg) {
+    if (!telemetry_on.load()) {
+        return SCHED_IDLE;
+    }
+    sendTelemetry();
+    uint32_t now = millis();
+    int32_t wait = (int32_t)(telemetry_status_due - now);
+    if (telemetry_batched > 0) {
+        int32_t flush_wait = (int32_t)(telemetry_batch_start + TELEMETRY_BATCH_MS - now);
+        if (flush_wait < wait) {
+            wait = flush_wait;
+        }
+    }
+    return wait > 0 ? (uint32_t)wait : 0;
+}
+
+// With telemetry on the log text is dropped, so it can't break up a frame
+uint32_t logJob(void *arg) {
+    static uint32_t dropped_reported = 0;
+    char line[LOG_LINE_MAX];
+    bool text = !telemetry_on.load();
+    LogRecord rec;
+    while (logRingPop(&log_ring, &rec)) {
+        if (!text) {
+            continue;
+        }
+        size_t len = logFormat(&rec, line, sizeof(line));
+        Serial.write((const uint8_t *)line, len);
+        log_text_bytes += len;
+    }
+    uint32_t dropped = log_ring.dropped.load();
+    if (dropped != dropped_reported) {
+        Serial.printf("Log: %lu records dropped\n", (unsigned long)(dropped - dropped_reported));
+        dropped_reported = dropped;
+    }
+    return SCHED_IDLE;
+}
+
+void wakeLogJob() {
+    schedWake(&serial_sched, log_job);
+}
+
+// Called from the UART driver's event task when input arrives
+void wakeConsoleJob() {
+    schedWake(&serial_sched, console_job);
+}
+
+// Register the serial jobs and their wake-ups (after Serial.begin(), before
+// the tasks start). Each runs once at the start for anything queued in setup().
+void setupSerialScheduler() {
+    schedInit(&serial_sched, schedulerMillis, notifyTask, &serial_task_handle);
+    history_job = schedAdd(&serial_sched, "history", historyJob, NULL, 0);
+    console_job = schedAdd(&serial_sched, "console", consoleJob, NULL, 0);
+    telemetry_job = schedAdd(&serial_sched, "telemetry", telemetryJob, NULL, SCHED_IDLE);
+    log_job = schedAdd(&serial_sched, "log", logJob, NULL, 0);
+    logSetWake(wakeLogJob);
+    Serial.onReceive(wakeConsoleJob);
+}
+
+// Serial task: formats the records queued by the LOG_* calls and writes them
+// to Serial (see async_log.h), appends the queued bales to the history file,
+// and runs the console. With telemetry on it
+// sends the count events as frames instead, and the log text is dropped.
+// Lowest priority, so only it ever waits on the UART or the flash.
+#define SERIAL_TASK_PRIORITY 1
+void serialTask(void *param)
+{
+    consoleInputInit(&console_input);
+    for (;;) {
+        uint32_t wait_ms = schedRunDue(&serial_sched);
+        waitForScheduler(wait_ms);
+    }
+}
+
+// Sensor task: counting and persistence. Never waits on the display.
+// In idle mode it light-sleeps between deadlines.
+void sensorTask(void *param)
+{
+    for (;;) {
+        uint32_t start = micros();
+        uint32_t wait_ms = schedRunDue(&sensor_sched);
+        publishCounts();
+        uint32_t busy_us = micros() - start;
+#ifdef TASK_PROFILING
+        sensor_busy_us += busy_us;
+#endif
+        // Loop timing for the telemetry status events. The serial task resets
+        // the worst to 0 when it sends one, so it is raised with a
+        // compare-exchange, which loses neither a reset nor a new worst.
+        sensor_loop_us.store(busy_us);
+        uint32_t worst = sensor_loop_max_us.load();
+        while (busy_us > worst && !sensor_loop_max_us.compare_exchange_weak(worst, busy_us)) {
+        }
+#ifdef IDLE_MODE_ENABLED
+        if (powerCanSleep(&power, wait_ms)) {
+            lightSleep(wait_ms);
+        } else {
+            waitForScheduler(wait_ms);
         }
+        checkTouchWake();
+#else
+        waitForScheduler(wait_ms);
+#endif
+        powerOnWakeup(&power);
     }
 }
 
 void setup()
 {
     Serial.begin(115200); /* prepare for possible serial debug */
+    logInit(schedulerMillis);  // Records queue until the serial task starts
 
-    String LVGL_Arduino = "Hello Arduino! ";
-    LVGL_Arduino += String('V') + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
-
-    Serial.println(LVGL_Arduino);
+    Serial.printf("Hello Arduino! V%d.%d.%d\n", lv_version_major(), lv_version_minor(), lv_version_patch());
     Serial.println("I am LVGL_Arduino");
 
     // Open Preferences with bale-nums namespace
@@ -428,7 +3185,36 @@ void setup()
     Serial.print("Loaded flake count prev2 from preferences: ");
     Serial.println(flake_count_prev2);
 
+    saved_counts.bale_count = bale_count;
+    saved_counts.bale_count_year = bale_count_year;
+    saved_counts.flake_count = flake_count;
+    saved_counts.flake_prev1 = flake_count_prev1;
+    saved_counts.flake_prev2 = flake_count_prev2;
+
+    // Season bale history, read by the history screen through a small cache
+    initBaleHistory();
+    historyCacheInit(&history_cache, loadHistoryRecords, NULL);
+
+    // Seed flakes per bale from the saved previous bales so the flake rate works right away
+    int seed_bales = (flake_count_prev1 > 0) + (flake_count_prev2 > 0);
+    rateInit(&rate_estimator, seed_bales ? (float)(flake_count_prev1 + flake_count_prev2) / seed_bales : 0.0f);
+    rateTrendInit(&rate_trend, millis());
+#ifdef TREND_PROFILING
+    profileRateTrend();
+#endif
+
+    // Load saved job bale target from preferences
+    forecastInit(&forecast, preferences.getUInt("bale_target", 0), bale_count);
+    Serial.print("Loaded bale target from preferences: ");
+    Serial.println(forecast.target);
+
     lv_init();
+#ifdef UI_ASSETS_PARTITION
+    // Before ui_init() so the icons find drive A:
+    if (!assetFsInit()) {
+        Serial.println("No valid assets partition - run tools/pack_assets.py --upload");
+    }
+#endif
 
 #if LV_USE_LOG != 0
     lv_log_register_print_cb(my_print); /* register print function for debugging */
@@ -437,10 +3223,15 @@ void setup()
     mySpi.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS); /* Start second SPI bus for touchscreen */
     ts.begin(mySpi);                                                  /* Touchscreen init */
     ts.setRotation(3);                                                /* Landscape orientation */
+    loadTouchCalibration();
 
     tft.begin();        /* TFT init */
     tft.setRotation(3); // Landscape orientation  1 =  CYC usb on right, 2 for vertical, 3 for usb on left
     tft.invertDisplay(1); // Fix inverted colors - if colors are still wrong, try tft.invertDisplay(0)
+    tft.setSwapBytes(false); // Pixels are already swapped by LVGL (LV_COLOR_16_SWAP)
+#ifdef DISPLAY_DMA_ENABLED
+    tft.initDMA();
+#endif
 
     // Initialize the backlight pin for PWM control and set initial brightness
     pinMode(21, OUTPUT);  // TFT_BL pin
@@ -452,7 +3243,14 @@ void setup()
     // Initialize GPIO 22 as input with pull-up resistor for flake sensor
     pinMode(FLAKE_SENSOR_PIN, INPUT_PULLUP);
 
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * screenHeight / 10);
+#ifdef UI_RENDER_8BIT
+    paletteBuildLut(palette_lut);
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, DRAW_BUF_SIZE);
+#elif defined(DISPLAY_DMA_ENABLED)
+    lv_disp_draw_buf_init(&draw_buf, buf, buf2, DRAW_BUF_SIZE);
+#else
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, DRAW_BUF_SIZE);
+#endif
 
     /*Initialize the display*/
     static lv_disp_drv_t disp_drv;
@@ -462,6 +3260,12 @@ void setup()
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
     disp_drv.draw_buf = &draw_buf;
+#if defined(DISPLAY_DMA_ENABLED) && !defined(UI_RENDER_8BIT)
+    disp_drv.wait_cb = my_disp_wait;
+#endif
+#ifdef DISPLAY_PROFILING
+    disp_drv.monitor_cb = my_disp_monitor;
+#endif
     lv_disp_drv_register(&disp_drv);
 
     /*Initialize the (dummy) input device driver*/
@@ -469,76 +3273,115 @@ void setup()
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = my_touchpad_read;
+#ifdef BRIGHTNESS_ENABLED
+    indev_drv.feedback_cb = my_touch_feedback;
+#endif
     lv_indev_drv_register(&indev_drv);
+    touch_read_timer = indev_drv.read_timer;
+    lv_timer_set_period(touch_read_timer, TOUCH_POLL_IDLE_MS);
 
     /* Uncomment to create simple label */
     // lv_obj_t *label = lv_label_create( lv_scr_act() );
     // lv_label_set_text( label, "Hello Ardino and LVGL!");
     // lv_obj_align( label, LV_ALIGN_CENTER, 0, 0 );
 
+#ifdef DISPLAY_PROFILING
+    uint32_t ui_init_start = micros();
+#endif
     ui_init();
+#ifdef DISPLAY_PROFILING
+    // LVGL heap taken by the UI (local styles are allocated here, shared ones are static)
+    Serial.printf("ui_init took %lu us\n", (unsigned long)(micros() - ui_init_start));
+    printLvglHeap("after ui_init");
+#endif
+
+    // Publish the loaded counts for the displays
+    requestDisplayUpdate(DISP_ALL);
+    publishCounts();
+    CountSnapshot counts;
+    readCounts(&counts);
 
     // Update the bale count display with the loaded value
-    updateBaleCountDisplay();
+    updateBaleCountDisplay(&counts);
     
     // Update the yearly bale count display with the loaded value
-    updateBaleCountYearDisplay();
+    updateBaleCountYearDisplay(&counts);
     
     // Update the flake count display with the loaded value
-    updateFlakeCountDisplay();
+    updateFlakeCountDisplay(&counts);
     
     // Update the previous flake count displays with the loaded values
-    updateFlakeCountPrev1Display();
-    updateFlakeCountPrev2Display();
+    updateFlakeCountPrev1Display(&counts);
+    updateFlakeCountPrev2Display(&counts);
     
     // Initialize the bales per hour display
-    updateBalesPerHourDisplay();
+    updateBalesPerHourDisplay(&counts);
+
+    // Settings pages are created when the popup opens; start the forecast display
+    initSettingsStyles();
+    updateJobTargetDisplay(&counts);
+    updateForecastDisplay(&counts);
+
+    // Show the loaded values
+    bindViewLabels();
+    applyViewModel();
+#ifdef IMAGE_PROFILING
+    profileIconDraws();
+#endif
+#ifdef HISTORY_PROFILING
+    profileHistoryList();
+#endif
+#ifdef POOL_PROFILING
+    profileLvglPool();
+#endif
+#ifdef LOG_PROFILING
+    profileLogging();
+#endif
+
+    // Start the sensor anomaly detectors
+    anomalyInit(&anomaly, millis());
+    createAnomalyIndicator();
 
     // Debug preferences to verify they're working
     debugPreferences();
 
+    // Split the work across both cores
+    lvgl_mutex = xSemaphoreCreateRecursiveMutex();
+    setupSchedulers();
+    setupSerialScheduler();
+
+    // Capture sensor edges with interrupts, starting from the current levels
+    edgeRingInit(&sensor_edges);
+    bale_sensor_active = (digitalRead(BALE_SENSOR_PIN) == LOW);
+    flake_sensor_active = (digitalRead(FLAKE_SENSOR_PIN) == LOW);
+    // Through the IDF's GPIO ISR service with an IRAM interrupt, not
+    // attachInterrupt(), so edges are still captured during a flash write
+    esp_err_t isr_err = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+    if (isr_err != ESP_OK) {
+        Serial.printf("GPIO ISR service: error %d\n", (int)isr_err);
+    }
+    attachGpioIsr(BALE_SENSOR_PIN, GPIO_INTR_ANYEDGE, baleSensorIsr);
+    attachGpioIsr(FLAKE_SENSOR_PIN, GPIO_INTR_ANYEDGE, flakeSensorIsr);
+    // Pen-down on T_IRQ wakes the UI task instead of polling the touch controller
+    pinMode(XPT2046_IRQ, INPUT);
+    attachGpioIsr(XPT2046_IRQ, GPIO_INTR_NEGEDGE, touchIrqIsr);
+    powerInit(&power, millis(), POWER_IDLE_TIMEOUT_MS);
+    xTaskCreatePinnedToCore(uiTask, "ui", 8192, NULL, 2, &ui_task_handle, UI_TASK_CORE);
+    xTaskCreatePinnedToCore(sensorTask, "sensors", 4096, NULL, 3, &sensor_task_handle, SENSOR_TASK_CORE);
+    xTaskCreatePinnedToCore(serialTask, "serial", 4096, NULL, SERIAL_TASK_PRIORITY, &serial_task_handle, SENSOR_TASK_CORE);
+#ifdef IRAM_PROFILING
+    xTaskCreatePinnedToCore(iramProfileTask, "iram-prof", 3072, NULL, 1, NULL, UI_TASK_CORE);
+#endif
+
+#ifdef DISPLAY_PROFILING
+    Serial.printf("Setup done after %lu ms\n", millis());
+#else
     Serial.println("Setup done");
+#endif
 }
 
 void loop()
 {
-    lv_timer_handler(); /* let the GUI do its work */
-    
-    // Read bale sensor state and update display (matching old code behavior)
-    static bool last_sensor_state = true;  // Start with HIGH (pull-up default)
-    bool current_sensor_state = digitalRead(BALE_SENSOR_PIN);
-    
-    // Update bale sensor display and count when state changes
-    if (current_sensor_state != last_sensor_state) {
-        if (current_sensor_state == LOW) {  // Sensor triggered (active LOW)
-            Serial.println("Bale sensor triggered: ON");
-        } else {
-            Serial.println("Bale sensor state: OFF");
-            
-            // Increment counter when sensor goes from ON (LOW) to OFF (HIGH) - end of detection
-            incrementBaleCount();
-            Serial.println("Bale detected by sensor!");
-        }
-        last_sensor_state = current_sensor_state;
-    }
-    
-    // Read flake sensor state and update display
-    static bool last_flake_sensor_state = true;  // Start with HIGH (pull-up default)
-    bool current_flake_sensor_state = digitalRead(FLAKE_SENSOR_PIN);
-    
-    // Update flake sensor display and count when state changes
-    if (current_flake_sensor_state != last_flake_sensor_state) {
-        if (current_flake_sensor_state == LOW) {  // Sensor triggered (active LOW)
-            Serial.println("Flake sensor triggered: ON");
-        } else {
-            Serial.println("Flake sensor state: OFF");
-            
-            // Increment counter when sensor goes from ON (LOW) to OFF (HIGH) - end of detection
-            incrementFlakeCount();
-            Serial.println("Flake detected by sensor!");
-        }
-        last_flake_sensor_state = current_flake_sensor_state;
-    }
-    
-    delay(5);
-}
\ No newline at end of file
+    // All work runs in uiTask and sensorTask
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,320 @@
+// Size-class pool allocator for LVGL's heap, with usage statistics - see mem_pool.h
+
+#include "mem_pool.h"
+#include <string.h>
+
+// Header word: block size (a multiple of 8) and two flags
+#define BLOCK_USED 1U
+#define BLOCK_PREV_USED 2U
+#define BLOCK_SIZE_MASK (~7U)
+#define HEADER_BYTES 4U
+// Blocks sit at 8n + 4 from the 8-byte aligned base, so block + HEADER_BYTES
+// is aligned. The first 4 bytes of the arena are unused.
+#define FIRST_BLOCK 4U
+
+static inline uint32_t *word(const MemPool *pool, uint32_t offset) {
+    return (uint32_t *)(pool->base + offset);
+}
+
+static inline uint32_t blockSize(const MemPool *pool, uint32_t block) {
+    return *word(pool, block) & BLOCK_SIZE_MASK;
+}
+
+// Free blocks hold their list links after the header and their size in the last word
+static inline uint32_t *nextLink(const MemPool *pool, uint32_t block) {
+    return word(pool, block + 4);
+}
+
+static inline uint32_t *prevLink(const MemPool *pool, uint32_t block) {
+    return word(pool, block + 8);
+}
+
+static uint8_t sizeClass(uint32_t size) {
+    uint8_t c = 0;
+    while (c < MEM_POOL_CLASSES - 1 && size >= (memPoolClassSize(c) << 1)) {
+        c++;
+    }
+    return c;
+}
+
+static void listInsert(MemPool *pool, uint32_t block, uint32_t size) {
+    uint8_t c = sizeClass(size);
+    uint32_t head = pool->free_head[c];
+    *nextLink(pool, block) = head;
+    *prevLink(pool, block) = MEM_POOL_NONE;
+    if (head != MEM_POOL_NONE) {
+        *prevLink(pool, head) = block;
+    }
+    pool->free_head[c] = block;
+    pool->nonempty |= 1U << c;
+}
+
+static void listRemove(MemPool *pool, uint32_t block, uint32_t size) {
+    uint8_t c = sizeClass(size);
+    uint32_t next = *nextLink(pool, block);
+    uint32_t prev = *prevLink(pool, block);
+    if (prev != MEM_POOL_NONE) {
+        *nextLink(pool, prev) = next;
+    } else {
+        pool->free_head[c] = next;
+        if (next == MEM_POOL_NONE) {
+            pool->nonempty &= ~(1U << c);
+        }
+    }
+    if (next != MEM_POOL_NONE) {
+        *prevLink(pool, next) = prev;
+    }
+}
+
+// Write a free block's header and footer, list it, and tell the next block
+static void makeFree(MemPool *pool, uint32_t block, uint32_t size, uint32_t prev_used) {
+    *word(pool, block) = size | prev_used;
+    *word(pool, block + size - 4) = size;
+    listInsert(pool, block, size);
+    *word(pool, block + size) &= ~BLOCK_PREV_USED;
+}
+
+// Mark block used at size, giving any usable tail back as a free block
+static void useBlock(MemPool *pool, uint32_t block, uint32_t block_size, uint32_t size) {
+    uint32_t prev_used = *word(pool, block) & BLOCK_PREV_USED;
+    if (block_size - size >= MEM_POOL_MIN_BLOCK) {
+        *word(pool, block) = size | BLOCK_USED | prev_used;
+        makeFree(pool, block + size, block_size - size, BLOCK_PREV_USED);
+    } else {
+        *word(pool, block) = block_size | BLOCK_USED | prev_used;
+        *word(pool, block + block_size) |= BLOCK_PREV_USED;
+    }
+}
+
+static void noteAlloc(MemPool *pool, uint32_t size) {
+    MemPoolClassStats *c = &pool->classes[sizeClass(size)];
+    c->allocs++;
+    c->live++;
+    pool->live_bytes += size - HEADER_BYTES;
+    if (pool->live_bytes > pool->peak_bytes) {
+        pool->peak_bytes = pool->live_bytes;
+    }
+}
+
+static void noteFree(MemPool *pool, uint32_t size) {
+    MemPoolClassStats *c = &pool->classes[sizeClass(size)];
+    c->frees++;
+    c->live--;
+    pool->live_bytes -= size - HEADER_BYTES;
+}
+
+// Block size for a request: header added, rounded up to 8, at least the minimum
+static uint32_t blockFor(size_t size) {
+    uint32_t need = ((uint32_t)size + HEADER_BYTES + 7) & BLOCK_SIZE_MASK;
+    return need < MEM_POOL_MIN_BLOCK ? MEM_POOL_MIN_BLOCK : need;
+}
+
+static inline uint32_t blockOf(const MemPool *pool, void *ptr) {
+    return (uint32_t)((uint8_t *)ptr - pool->base) - HEADER_BYTES;
+}
+
+// Offset of the zero-size block at the end of the arena
+static inline uint32_t endBlock(const MemPool *pool) {
+    return pool->size - HEADER_BYTES;
+}
+
+void memPoolInit(MemPool *pool, void *buf, uint32_t size) {
+    memset(pool, 0, sizeof(*pool));
+    uint32_t skip = (uint32_t)(-(uintptr_t)buf & 7U);
+    pool->base = (uint8_t *)buf + skip;
+    pool->size = (size - skip) & BLOCK_SIZE_MASK;
+    for (uint8_t c = 0; c < MEM_POOL_CLASSES; c++) {
+        pool->free_head[c] = MEM_POOL_NONE;
+    }
+    // One free block, then a used zero-size block that stops merging at the end
+    uint32_t end = endBlock(pool);
+    *word(pool, end) = BLOCK_USED;
+    makeFree(pool, FIRST_BLOCK, end - FIRST_BLOCK, BLOCK_PREV_USED);
+}
+
+void *memPoolAlloc(MemPool *pool, size_t size) {
+    if (size > pool->size) {
+        pool->failed++;
+        return NULL;
+    }
+    uint32_t need = blockFor(size);
+    uint8_t c = sizeClass(need);
+
+    // First fit in the request's own class, whose blocks may be too small
+    uint32_t block = MEM_POOL_NONE;
+    for (uint32_t b = pool->free_head[c]; b != MEM_POOL_NONE; b = *nextLink(pool, b)) {
+        if (blockSize(pool, b) >= need) {
+            block = b;
+            break;
+        }
+    }
+    // Else any block of the next non-empty class up fits
+    if (block == MEM_POOL_NONE) {
+        uint32_t larger = pool->nonempty & ~((2U << c) - 1);
+        if (larger == 0) {
+            pool->failed++;
+            return NULL;
+        }
+        block = pool->free_head[__builtin_ctz(larger)];
+    }
+
+    uint32_t block_size = blockSize(pool, block);
+    listRemove(pool, block, block_size);
+    useBlock(pool, block, block_size, need);
+    noteAlloc(pool, blockSize(pool, block));
+    return pool->base + block + HEADER_BYTES;
+}
+
+void memPoolFree(MemPool *pool, void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    uint32_t block = blockOf(pool, ptr);
+    uint32_t header = *word(pool, block);
+    uint32_t size = header & BLOCK_SIZE_MASK;
+    noteFree(pool, size);
+
+    // Merge with the free neighbours on either side
+    uint32_t next = block + size;
+    uint32_t next_header = *word(pool, next);
+    if (!(next_header & BLOCK_USED)) {
+        uint32_t next_size = next_header & BLOCK_SIZE_MASK;
+        listRemove(pool, next, next_size);
+        size += next_size;
+    }
+    uint32_t prev_used = header & BLOCK_PREV_USED;
+    if (!prev_used) {
+        uint32_t prev_size = *word(pool, block - 4);
+        block -= prev_size;
+        listRemove(pool, block, prev_size);
+        size += prev_size;
+        prev_used = *word(pool, block) & BLOCK_PREV_USED;
+    }
+    makeFree(pool, block, size, prev_used);
+}
+
+void *memPoolRealloc(MemPool *pool, void *ptr, size_t size) {
+    if (ptr == NULL) {
+        return memPoolAlloc(pool, size);
+    }
+    if (size > pool->size) {
+        pool->failed++;
+        return NULL;
+    }
+    uint32_t block = blockOf(pool, ptr);
+    uint32_t old_size = blockSize(pool, block);
+    uint32_t need = blockFor(size);
+
+    // Shrink, or grow into a free block that follows
+    uint32_t available = old_size;
+    uint32_t next_header = *word(pool, block + old_size);
+    if (!(next_header & BLOCK_USED)) {
+        available += next_header & BLOCK_SIZE_MASK;
+    }
+    if (need <= available) {
+        noteFree(pool, old_size);
+        if (available > old_size) {
+            listRemove(pool, block + old_size, available - old_size);
+        }
+        useBlock(pool, block, available, need);
+        noteAlloc(pool, blockSize(pool, block));
+        return ptr;
+    }
+
+    void *moved = memPoolAlloc(pool, size);
+    if (moved == NULL) {
+        return NULL;
+    }
+    memcpy(moved, ptr, old_size - HEADER_BYTES);
+    memPoolFree(pool, ptr);
+    return moved;
+}
+
+void memPoolGetStats(const MemPool *pool, MemPoolStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->size = pool->size;
+    stats->live_bytes = pool->live_bytes;
+    stats->peak_bytes = pool->peak_bytes;
+    stats->failed = pool->failed;
+    memcpy(stats->classes, pool->classes, sizeof(stats->classes));
+    for (uint8_t c = 0; c < MEM_POOL_CLASSES; c++) {
+        for (uint32_t b = pool->free_head[c]; b != MEM_POOL_NONE; b = *nextLink(pool, b)) {
+            uint32_t size = blockSize(pool, b);
+            stats->free_bytes += size - HEADER_BYTES;
+            stats->free_blocks++;
+            if (size - HEADER_BYTES > stats->largest_free) {
+                stats->largest_free = size - HEADER_BYTES;
+            }
+        }
+    }
+    if (stats->free_bytes > 0) {
+        stats->frag_pct = (uint8_t)(100 - (uint64_t)stats->largest_free * 100 / stats->free_bytes);
+    }
+}
+
+bool memPoolCheck(const MemPool *pool) {
+    uint32_t end = endBlock(pool);
+    uint32_t free_count = 0;
+    uint32_t prev_used = BLOCK_PREV_USED;
+    uint32_t block = FIRST_BLOCK;
+    while (block < end) {
+        uint32_t header = *word(pool, block);
+        uint32_t size = header & BLOCK_SIZE_MASK;
+        if (size < MEM_POOL_MIN_BLOCK || size > end - block || (header & BLOCK_PREV_USED) != prev_used) {
+            return false;
+        }
+        if (!(header & BLOCK_USED)) {
+            // Free blocks are always merged, so two are never adjacent
+            if (!prev_used || *word(pool, block + size - 4) != size) {
+                return false;
+            }
+            free_count++;
+        }
+        prev_used = (header & BLOCK_USED) ? BLOCK_PREV_USED : 0;
+        block += size;
+    }
+    if (block != end || (*word(pool, end) & ~BLOCK_PREV_USED) != BLOCK_USED ||
+        (*word(pool, end) & BLOCK_PREV_USED) != prev_used) {
+        return false;
+    }
+
+    // Every free block is in the list of its class, and nothing else is
+    uint32_t listed = 0;
+    for (uint8_t c = 0; c < MEM_POOL_CLASSES; c++) {
+        uint32_t prev = MEM_POOL_NONE;
+        for (uint32_t b = pool->free_head[c]; b != MEM_POOL_NONE; b = *nextLink(pool, b)) {
+            if (b >= end || (*word(pool, b) & BLOCK_USED) || sizeClass(blockSize(pool, b)) != c ||
+                *prevLink(pool, b) != prev || ++listed > free_count) {
+                return false;
+            }
+            prev = b;
+        }
+        if (((pool->nonempty >> c) & 1U) != (pool->free_head[c] != MEM_POOL_NONE)) {
+            return false;
+        }
+    }
+    return listed == free_count;
+}
+
+// LVGL's pool, 8-byte aligned
+static uint64_t lvgl_arena[LVGL_POOL_BYTES / sizeof(uint64_t)];
+static MemPool lvgl_pool;
+
+MemPool *lvglPool(void) {
+    if (lvgl_pool.base == NULL) {
+        memPoolInit(&lvgl_pool, lvgl_arena, sizeof(lvgl_arena));
+    }
+    return &lvgl_pool;
+}
+
+void *lvglPoolAlloc(size_t size) {
+    return memPoolAlloc(lvglPool(), size);
+}
+
+void lvglPoolFree(void *ptr) {
+    memPoolFree(lvglPool(), ptr);
+}
+
+void *lvglPoolRealloc(void *ptr, size_t size) {
+    return memPoolRealloc(lvglPool(), ptr, size);
+}
@@ -0,0 +1,101 @@
+// Size-class pool allocator for LVGL's heap, with usage statistics
+//
+// lv_conf.h points LVGL's memory hooks (LV_MEM_CUSTOM) at lvglPoolAlloc(),
+// lvglPoolFree() and lvglPoolRealloc(), which use a static arena of
+// LVGL_POOL_BYTES. LVGL's own allocator has the same idea but only reports
+// totals; this one also counts allocations per size class, so a leak or a
+// fragmenting allocation pattern can be traced to the sizes involved.
+//
+// Each block has a 4-byte header with its size. Blocks start 4 bytes past an
+// 8-byte boundary and are a multiple of 8 long, so every pointer handed out
+// is 8-byte aligned, as LVGL and malloc() callers expect for doubles and
+// 64-bit fields, without a bigger header. Free blocks are kept in one
+// list per power-of-two size class, with a bitmap of the non-empty lists,
+// and are merged with free neighbours when freed (boundary tags). A request
+// takes the first fit in its own class, else the first block of the next
+// non-empty larger class, so alloc and free cost about the same at any fill.
+
+#ifndef BALECOUNTER_MEM_POOL_H
+#define BALECOUNTER_MEM_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LVGL_POOL_BYTES (48U * 1024U)   // Was LV_MEM_SIZE
+#define MEM_POOL_CLASSES 10             // Block sizes 16-31, 32-63, ... 8192 and up
+#define MEM_POOL_MIN_BLOCK 16           // Header, two free-list links and a footer
+#define MEM_POOL_NONE 0xFFFFFFFFUL      // No block (free-list end)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL allocator hooks (LV_MEM_CUSTOM_ALLOC / _FREE / _REALLOC). The pool
+// is set up on first use, so it is ready before lv_init() allocates.
+void *lvglPoolAlloc(size_t size);
+void lvglPoolFree(void *ptr);
+void *lvglPoolRealloc(void *ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+// The rest is C++ only (lv_conf.h includes this header into LVGL's C files)
+#ifdef __cplusplus
+
+struct MemPoolClassStats {
+    uint32_t allocs;       // Allocations since init
+    uint32_t frees;
+    uint32_t live;         // Blocks in use now
+};
+
+struct MemPoolStats {
+    uint32_t size;             // Arena bytes
+    uint32_t live_bytes;       // Bytes handed out now (block size less the header)
+    uint32_t peak_bytes;       // Highest live_bytes since init
+    uint32_t free_bytes;
+    uint32_t largest_free;     // Biggest allocation that would succeed now
+    uint32_t free_blocks;
+    uint32_t failed;           // Allocations that found no block
+    uint8_t frag_pct;          // 100 - largest_free / free_bytes, like lv_mem_monitor()
+    MemPoolClassStats classes[MEM_POOL_CLASSES];   // By block size class
+};
+
+struct MemPool {
+    uint8_t *base;
+    uint32_t size;                             // Arena bytes, end sentinel included
+    uint32_t free_head[MEM_POOL_CLASSES];      // Offset of each list's first block
+    uint32_t nonempty;                         // Bit n set if free_head[n] has blocks
+    uint32_t live_bytes;
+    uint32_t peak_bytes;
+    uint32_t failed;
+    MemPoolClassStats classes[MEM_POOL_CLASSES];
+};
+
+// Start an empty pool in buf (at least 64 bytes; an unaligned start is skipped)
+void memPoolInit(MemPool *pool, void *buf, uint32_t size);
+
+void *memPoolAlloc(MemPool *pool, size_t size);
+void memPoolFree(MemPool *pool, void *ptr);
+
+// Grows in place into a free neighbour when it can, else moves the data
+void *memPoolRealloc(MemPool *pool, void *ptr, size_t size);
+
+// Fill in stats; walks the free lists, so call it for reports, not per frame
+void memPoolGetStats(const MemPool *pool, MemPoolStats *stats);
+
+// Walk every block and check headers, footers and free lists agree.
+// Returns false if the pool is corrupt (a write past the end of a block).
+bool memPoolCheck(const MemPool *pool);
+
+// Smallest block size in a size class (its row label in a report)
+static inline uint32_t memPoolClassSize(uint8_t size_class) {
+    return (uint32_t)MEM_POOL_MIN_BLOCK << size_class;
+}
+
+// The pool behind LVGL's heap
+MemPool *lvglPool(void);
+
+#endif // __cplusplus
+
+#endif // BALECOUNTER_MEM_POOL_H
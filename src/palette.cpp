@@ -0,0 +1,13 @@
+// RGB332 to RGB565 palette - see palette.h
+
+#include "palette.h"
+
+void paletteBuildLut(uint16_t *lut) {
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        uint16_t r = ((i >> 5) & 0x07) * 31 / 7;
+        uint16_t g = ((i >> 2) & 0x07) * 63 / 7;
+        uint16_t b = (i & 0x03) * 31 / 3;
+        uint16_t c = (r << 11) | (g << 5) | b;
+        lut[i] = (uint16_t)((c >> 8) | (c << 8));
+    }
+}
@@ -0,0 +1,28 @@
+// RGB332 to RGB565 palette for the 8-bit render mode (UI_RENDER_8BIT)
+//
+// LVGL renders into an RGB332 buffer and the flush expands each pixel
+// through a 256-entry table into RGB565. The table holds the RGB565 values
+// already byte-swapped for the panel, like LV_COLOR_16_SWAP does for the
+// 16-bit buffers, so the expanded chunk goes to the panel as it is.
+
+#ifndef BALECOUNTER_PALETTE_H
+#define BALECOUNTER_PALETTE_H
+
+#include <stdint.h>
+
+#define PALETTE_SIZE 256
+
+// Fill lut with the swapped RGB565 value of each RGB332 code. Each channel
+// is scaled so 0 and its full value map to 0 and the full RGB565 value.
+void paletteBuildLut(uint16_t *lut);
+
+// Expand n RGB332 pixels through lut. Inline, so the IRAM flush code in
+// main.cpp gets the loop itself instead of a call into flash.
+static inline __attribute__((always_inline)) void paletteExpand(uint16_t *dst, const uint8_t *src, uint32_t n,
+                                                                const uint16_t *lut) {
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = lut[src[i]];
+    }
+}
+
+#endif // BALECOUNTER_PALETTE_H
@@ -0,0 +1,64 @@
+// Display power state machine: active vs idle - see power_mode.h
+
+#include "power_mode.h"
+#include <string.h>
+
+// Add the time since the last accounting to the current mode
+static void powerAccount(PowerState *ps, uint32_t now_ms) {
+    ps->mode_ms[ps->mode] += now_ms - ps->accounted_until;
+    ps->accounted_until = now_ms;
+}
+
+void powerInit(PowerState *ps, uint32_t now_ms, uint32_t idle_timeout_ms) {
+    memset(ps, 0, sizeof(*ps));
+    ps->mode = POWER_ACTIVE;
+    ps->idle_timeout_ms = idle_timeout_ms;
+    ps->last_activity = now_ms;
+    ps->accounted_until = now_ms;
+}
+
+bool powerOnActivity(PowerState *ps, uint32_t now_ms) {
+    ps->last_activity = now_ms;
+    if (ps->mode == POWER_ACTIVE) {
+        return false;
+    }
+    powerAccount(ps, now_ms);
+    ps->mode = POWER_ACTIVE;
+    return true;
+}
+
+bool powerTick(PowerState *ps, uint32_t now_ms) {
+    if (ps->mode != POWER_ACTIVE || ps->idle_timeout_ms == 0) {
+        return false;
+    }
+    if (now_ms - ps->last_activity < ps->idle_timeout_ms) {
+        return false;
+    }
+    powerAccount(ps, now_ms);
+    ps->mode = POWER_IDLE;
+    return true;
+}
+
+bool powerCanSleep(const PowerState *ps, uint32_t wait_ms) {
+    return ps->mode == POWER_IDLE && wait_ms >= POWER_MIN_SLEEP_MS;
+}
+
+void powerOnWakeup(PowerState *ps) {
+    ps->wakeups[ps->mode]++;
+}
+
+void powerOnSleep(PowerState *ps, uint32_t slept_ms) {
+    ps->sleep_ms[ps->mode] += slept_ms;
+}
+
+void powerTakeStats(PowerState *ps, uint32_t now_ms, PowerStats *out) {
+    powerAccount(ps, now_ms);
+    for (int m = 0; m < POWER_MODE_COUNT; m++) {
+        out->mode_ms[m] = ps->mode_ms[m];
+        out->sleep_ms[m] = ps->sleep_ms[m];
+        out->wakeups[m] = ps->wakeups[m];
+        ps->mode_ms[m] = 0;
+        ps->sleep_ms[m] = 0;
+        ps->wakeups[m] = 0;
+    }
+}
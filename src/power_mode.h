@@ -0,0 +1,61 @@
+// Display power state machine: active vs idle (display off, CPU light sleep)
+//
+// The unit goes idle after a period with no touch and no bale. In idle the
+// backlight is off, LVGL stops rendering and the sensor task may light-sleep
+// between deadlines; sensor edges still wake it. A touch or a bale returns
+// to active. Also keeps the duty-cycle counters for each mode.
+
+#ifndef BALECOUNTER_POWER_MODE_H
+#define BALECOUNTER_POWER_MODE_H
+
+#include <stdint.h>
+
+// No touch and no bale for this long turns the display off
+#define POWER_IDLE_TIMEOUT_MS (10UL * 60UL * 1000UL)
+// Waits shorter than this are not worth a light sleep
+#define POWER_MIN_SLEEP_MS 20
+
+enum PowerMode {
+    POWER_ACTIVE,
+    POWER_IDLE,
+    POWER_MODE_COUNT
+};
+
+struct PowerState {
+    PowerMode mode;
+    uint32_t idle_timeout_ms;
+    uint32_t last_activity;               // Last touch or bale (ms)
+    // Duty-cycle counters since the last powerTakeStats()
+    uint32_t accounted_until;             // Time already added to mode_ms
+    uint32_t mode_ms[POWER_MODE_COUNT];   // Time spent in each mode
+    uint32_t sleep_ms[POWER_MODE_COUNT];  // Time spent in light sleep in each mode
+    uint32_t wakeups[POWER_MODE_COUNT];   // Task wakeups in each mode
+};
+
+struct PowerStats {
+    uint32_t mode_ms[POWER_MODE_COUNT];
+    uint32_t sleep_ms[POWER_MODE_COUNT];
+    uint32_t wakeups[POWER_MODE_COUNT];
+};
+
+void powerInit(PowerState *ps, uint32_t now_ms, uint32_t idle_timeout_ms);
+
+// A touch or a new bale. Returns true if it woke the display from idle.
+bool powerOnActivity(PowerState *ps, uint32_t now_ms);
+
+// Check the idle timeout. Returns true when the display should turn off now.
+bool powerTick(PowerState *ps, uint32_t now_ms);
+
+// True if a wait of wait_ms may be spent in light sleep
+bool powerCanSleep(const PowerState *ps, uint32_t wait_ms);
+
+// Count one wakeup of the task doing the counting
+void powerOnWakeup(PowerState *ps);
+
+// Count time spent in light sleep
+void powerOnSleep(PowerState *ps, uint32_t slept_ms);
+
+// Copy the counters since the last call and start a new period
+void powerTakeStats(PowerState *ps, uint32_t now_ms, PowerStats *out);
+
+#endif // BALECOUNTER_POWER_MODE_H
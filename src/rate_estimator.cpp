@@ -0,0 +1,68 @@
+// Bales per hour estimator that fuses flake cadence with bale edges - see rate_estimator.h
+
+#include "rate_estimator.h"
+
+void rateInit(RateEstimator *re, float flakes_per_bale_seed) {
+    re->flakes_per_bale = (flakes_per_bale_seed > 0.0f) ? flakes_per_bale_seed : 0.0f;
+    re->fpb_samples = (flakes_per_bale_seed > 0.0f) ? 1 : 0;
+    rateResetSession(re);
+}
+
+void rateResetSession(RateEstimator *re) {
+    re->last_flake_time = 0;
+    re->have_last_flake = false;
+    re->flake_interval_ms = 0.0f;
+    re->flake_intervals = 0;
+}
+
+void rateOnFlake(RateEstimator *re, uint32_t now_ms) {
+    if (re->have_last_flake) {
+        uint32_t interval = now_ms - re->last_flake_time;
+
+        // Skip stops so they don't drag the cadence down
+        if (interval > 0 && interval <= RATE_MAX_FLAKE_GAP_MS) {
+            if (re->flake_intervals == 0) {
+                re->flake_interval_ms = (float)interval;
+            } else {
+                re->flake_interval_ms += RATE_FLAKE_SMOOTHING * ((float)interval - re->flake_interval_ms);
+            }
+            re->flake_intervals++;
+        }
+    }
+    re->last_flake_time = now_ms;
+    re->have_last_flake = true;
+}
+
+void rateOnBale(RateEstimator *re, uint32_t flakes_in_bale) {
+    if (flakes_in_bale == 0) {
+        // No flake data for this bale (flake sensor not fitted or just reset)
+        return;
+    }
+    if (re->fpb_samples == 0) {
+        re->flakes_per_bale = (float)flakes_in_bale;
+    } else {
+        re->flakes_per_bale += RATE_FPB_SMOOTHING * ((float)flakes_in_bale - re->flakes_per_bale);
+    }
+    re->fpb_samples++;
+}
+
+float rateFlakeBalesPerHour(const RateEstimator *re) {
+    if (re->flake_interval_ms <= 0.0f || re->flakes_per_bale <= 0.0f) {
+        return 0.0f;
+    }
+    // 3600000 ms = 1 hour
+    return 3600000.0f / (re->flake_interval_ms * re->flakes_per_bale);
+}
+
+float rateFuse(const RateEstimator *re, float bale_edge_rate, uint32_t bale_intervals) {
+    float flake_rate = rateFlakeBalesPerHour(re);
+    if (bale_intervals == 0) {
+        return flake_rate;
+    }
+    if (flake_rate <= 0.0f) {
+        return bale_edge_rate;
+    }
+    // Trust the bale-edge rate more as bale intervals accumulate
+    float weight = bale_intervals / (bale_intervals + RATE_BLEND_BALES);
+    return weight * bale_edge_rate + (1.0f - weight) * flake_rate;
+}
@@ -0,0 +1,49 @@
+// Bales per hour estimator that fuses flake cadence with bale edges
+//
+// Before the second bale there is no bale interval to measure, but flakes
+// arrive every few seconds. Flake cadence divided by the running flakes per
+// bale average gives a bales/hour prediction almost immediately. As bale
+// intervals accumulate, the estimate blends over to the bale-edge rate.
+
+#ifndef BALECOUNTER_RATE_ESTIMATOR_H
+#define BALECOUNTER_RATE_ESTIMATOR_H
+
+#include <stdint.h>
+
+// Weight of the newest flake interval in the smoothed flake interval (0..1)
+#define RATE_FLAKE_SMOOTHING 0.2f
+// Weight of the newest bale in the flakes per bale average (0..1)
+#define RATE_FPB_SMOOTHING 0.25f
+// Flake gaps longer than this are stops, not cadence
+#define RATE_MAX_FLAKE_GAP_MS 60000UL
+// Bale intervals at which the bale-edge rate and flake rate count equally
+#define RATE_BLEND_BALES 3.0f
+
+struct RateEstimator {
+    uint32_t last_flake_time;     // Time of the most recent flake (ms)
+    bool have_last_flake;         // last_flake_time is valid
+    float flake_interval_ms;      // Smoothed time between flakes (0 = unknown)
+    uint32_t flake_intervals;     // Intervals averaged into flake_interval_ms
+    float flakes_per_bale;        // Running flakes per bale average (0 = unknown)
+    uint32_t fpb_samples;         // Bales averaged into flakes_per_bale
+};
+
+// Start the estimator, optionally seeded with a known flakes per bale value
+void rateInit(RateEstimator *re, float flakes_per_bale_seed);
+
+// Forget the flake cadence (session reset). Flakes per bale is kept.
+void rateResetSession(RateEstimator *re);
+
+// Call on every counted flake - O(1)
+void rateOnFlake(RateEstimator *re, uint32_t now_ms);
+
+// Call on every counted bale with the flakes that went into it - O(1)
+void rateOnBale(RateEstimator *re, uint32_t flakes_in_bale);
+
+// Rate predicted from flake cadence alone (0 if unknown)
+float rateFlakeBalesPerHour(const RateEstimator *re);
+
+// Blend the bale-edge rate measured over bale_intervals with the flake rate
+float rateFuse(const RateEstimator *re, float bale_edge_rate, uint32_t bale_intervals);
+
+#endif // BALECOUNTER_RATE_ESTIMATOR_H
@@ -0,0 +1,73 @@
+// Bales per hour over the session, decimated to a fixed number of columns - see rate_trend.h
+
+#include "rate_trend.h"
+
+static void clearColumn(RateTrendColumn *col) {
+    col->min_tenths = UINT16_MAX;
+    col->max_tenths = 0;
+}
+
+bool rateTrendColumnUsed(const RateTrendColumn *col) {
+    return col->min_tenths <= col->max_tenths;
+}
+
+// Merge neighbouring columns in pairs and double the time per column
+static void mergePairs(RateTrend *rt) {
+    uint16_t merged = (rt->count + 1) / 2;
+    for (uint16_t i = 0; i < merged; i++) {
+        RateTrendColumn col = rt->columns[2 * i];
+        if (2 * i + 1 < rt->count) {
+            const RateTrendColumn *next = &rt->columns[2 * i + 1];
+            if (next->min_tenths < col.min_tenths) col.min_tenths = next->min_tenths;
+            if (next->max_tenths > col.max_tenths) col.max_tenths = next->max_tenths;
+        }
+        rt->columns[i] = col;
+    }
+    for (uint16_t i = merged; i < rt->count; i++) {
+        clearColumn(&rt->columns[i]);
+    }
+    rt->count = merged;
+    rt->span_ms *= 2;
+    rt->layout++;
+}
+
+void rateTrendInit(RateTrend *rt, uint32_t now_ms) {
+    for (uint16_t i = 0; i < RATE_TREND_COLUMNS; i++) {
+        clearColumn(&rt->columns[i]);
+    }
+    rt->count = 0;
+    rt->start_ms = now_ms;
+    rt->span_ms = RATE_TREND_FIRST_SPAN_MS;
+    rt->scale = RATE_TREND_SCALE_STEP;
+    rt->layout++;
+}
+
+bool rateTrendAdd(RateTrend *rt, float bales_per_hour, uint32_t now_ms) {
+    uint32_t layout = rt->layout;
+
+    // Column for this time, merging until it fits
+    uint32_t elapsed = now_ms - rt->start_ms;
+    uint32_t index = elapsed / rt->span_ms;
+    while (index >= RATE_TREND_COLUMNS) {
+        mergePairs(rt);
+        index = elapsed / rt->span_ms;
+    }
+    // Columns skipped since the last sample stay empty
+    if (index + 1 > rt->count) {
+        rt->count = index + 1;
+    }
+
+    if (bales_per_hour < 0.0f) bales_per_hour = 0.0f;
+    float tenths = bales_per_hour * 10.0f + 0.5f;
+    uint16_t value = (tenths >= (float)(UINT16_MAX - 1)) ? UINT16_MAX - 1 : (uint16_t)tenths;
+    RateTrendColumn *col = &rt->columns[index];
+    if (value < col->min_tenths) col->min_tenths = value;
+    if (value > col->max_tenths) col->max_tenths = value;
+
+    // Grow the scale to the next step above the new value
+    while (value > (uint32_t)rt->scale * 10 && rt->scale <= UINT16_MAX / 10 - RATE_TREND_SCALE_STEP) {
+        rt->scale += RATE_TREND_SCALE_STEP;
+        rt->layout++;
+    }
+    return rt->layout != layout;
+}
@@ -0,0 +1,47 @@
+// Bales per hour over the session, decimated to a fixed number of columns
+//
+// Each column covers the same span of time and keeps the lowest and highest
+// rate seen in it. When the session outgrows the columns, neighbouring
+// columns are merged in pairs (min of the mins, max of the maxes) and the
+// span doubles, so a whole day fits in RATE_TREND_COLUMNS columns and a dip
+// in the pace is never averaged away. Adding a sample only changes the
+// newest column, unless it causes a merge or a new y scale.
+
+#ifndef BALECOUNTER_RATE_TREND_H
+#define BALECOUNTER_RATE_TREND_H
+
+#include <stdint.h>
+
+// One column per pixel of the chart
+#define RATE_TREND_COLUMNS 200
+// Time per column at the start of a session (200 columns = 3 h 20 min)
+#define RATE_TREND_FIRST_SPAN_MS 60000UL
+// The y scale grows in steps of this many bales per hour
+#define RATE_TREND_SCALE_STEP 10
+
+struct RateTrendColumn {
+    uint16_t min_tenths;   // Lowest rate in tenths of a bale per hour
+    uint16_t max_tenths;   // Highest rate (min > max = no samples, a stop)
+};
+
+struct RateTrend {
+    RateTrendColumn columns[RATE_TREND_COLUMNS];  // Oldest first
+    uint16_t count;          // Columns in use, the last one is the newest
+    uint32_t start_ms;       // Start of column 0
+    uint32_t span_ms;        // Time per column
+    uint16_t scale;          // Top of the y scale in bales per hour
+    uint32_t layout;         // Changes whenever every column moves or is rescaled
+};
+
+// Start an empty trend for a session starting now
+void rateTrendInit(RateTrend *rt, uint32_t now_ms);
+
+// Add a rate sample. Returns true if every column changed (merge or new
+// scale), false if only the newest column did. O(1) except on a merge,
+// which is O(RATE_TREND_COLUMNS) and happens once per doubling of the session.
+bool rateTrendAdd(RateTrend *rt, float bales_per_hour, uint32_t now_ms);
+
+// True if the column has at least one sample
+bool rateTrendColumnUsed(const RateTrendColumn *col);
+
+#endif // BALECOUNTER_RATE_TREND_H
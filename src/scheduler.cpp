@@ -0,0 +1,86 @@
+// Allocation-free cooperative job scheduler - see scheduler.h
+
+#include "scheduler.h"
+#include <stddef.h>
+
+void schedInit(Scheduler *sc, uint32_t (*now_ms)(void), void (*notify)(void *ctx), void *notify_ctx) {
+    sc->count = 0;
+    sc->now_ms = now_ms;
+    sc->notify = notify;
+    sc->notify_ctx = notify_ctx;
+}
+
+int schedAdd(Scheduler *sc, const char *name, SchedJobFn fn, void *arg, uint32_t first_delay_ms) {
+    if (sc->count >= SCHED_MAX_JOBS) {
+        return -1;
+    }
+    SchedJob *job = &sc->jobs[sc->count];
+    job->name = name;
+    job->fn = fn;
+    job->arg = arg;
+    job->idle = (first_delay_ms == SCHED_IDLE);
+    job->due_ms = job->idle ? 0 : sc->now_ms() + first_delay_ms;
+    job->woken.store(0);
+    job->runs = 0;
+    job->max_late_ms = 0;
+    return sc->count++;
+}
+
+void schedWake(Scheduler *sc, int job) {
+    // Only notify on the first wake, further wakes before the run coalesce
+    if (schedMarkWoken(sc, job) && sc->notify != NULL) {
+        sc->notify(sc->notify_ctx);
+    }
+}
+
+uint32_t schedNextDeadline(Scheduler *sc) {
+    uint32_t now = sc->now_ms();
+    uint32_t wait = SCHED_IDLE;
+    for (uint8_t i = 0; i < sc->count; i++) {
+        SchedJob *job = &sc->jobs[i];
+        // Not at all if a job was woken since it last ran
+        if (job->woken.load() != 0) {
+            return 0;
+        }
+        if (job->idle) {
+            continue;
+        }
+        int32_t remaining = (int32_t)(job->due_ms - now);
+        uint32_t job_wait = remaining > 0 ? (uint32_t)remaining : 0;
+        if (job_wait < wait) {
+            wait = job_wait;
+        }
+    }
+    return wait;
+}
+
+uint32_t schedRunDue(Scheduler *sc) {
+    uint32_t now = sc->now_ms();
+
+    for (uint8_t i = 0; i < sc->count; i++) {
+        SchedJob *job = &sc->jobs[i];
+        bool woken = job->woken.exchange(0) != 0;
+        bool due = !job->idle && (int32_t)(now - job->due_ms) >= 0;
+        if (!woken && !due) {
+            continue;
+        }
+
+        if (due) {
+            uint32_t late = now - job->due_ms;
+            if (late > job->max_late_ms) {
+                job->max_late_ms = late;
+            }
+        }
+
+        uint32_t next = job->fn(job->arg);
+        job->runs++;
+        now = sc->now_ms();
+        if (next == SCHED_IDLE) {
+            job->idle = true;
+        } else {
+            job->idle = false;
+            job->due_ms = now + next;
+        }
+    }
+    return schedNextDeadline(sc);
+}
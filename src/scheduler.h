@@ -0,0 +1,68 @@
+// Allocation-free cooperative job scheduler
+//
+// Each task (UI, sensors, serial) owns one Scheduler with a fixed table of jobs.
+// A job runs when its deadline passes or when another task wakes it, and
+// returns how long until it wants to run again. The owning task then sleeps
+// only until the earliest deadline instead of a fixed delay().
+
+#ifndef BALECOUNTER_SCHEDULER_H
+#define BALECOUNTER_SCHEDULER_H
+
+#include <stdint.h>
+#include <atomic>
+
+#define SCHED_MAX_JOBS 8
+// Returned by a job (or schedRunDue) when there is no deadline - wait for schedWake()
+#define SCHED_IDLE 0xFFFFFFFFUL
+
+// Job body: returns ms until the next run, or SCHED_IDLE
+typedef uint32_t (*SchedJobFn)(void *arg);
+
+struct SchedJob {
+    const char *name;
+    SchedJobFn fn;
+    void *arg;
+    uint32_t due_ms;              // Next deadline (valid unless idle)
+    bool idle;                    // Waiting for schedWake() only
+    std::atomic<uint32_t> woken;  // Set by schedWake() from any task (32-bit so ISRs get a lock-free exchange)
+    uint32_t runs;                // Times the job has run
+    uint32_t max_late_ms;         // Worst time between deadline and run (jitter)
+};
+
+struct Scheduler {
+    SchedJob jobs[SCHED_MAX_JOBS];
+    uint8_t count;
+    uint32_t (*now_ms)(void);          // Clock source
+    void (*notify)(void *ctx);         // Wakes the owning task from its sleep
+    void *notify_ctx;
+};
+
+// Set up an empty scheduler. notify may be NULL if nothing sleeps on it.
+void schedInit(Scheduler *sc, uint32_t (*now_ms)(void), void (*notify)(void *ctx), void *notify_ctx);
+
+// Add a job that first runs after first_delay_ms (or SCHED_IDLE to wait for a wake)
+// Returns the job id, or -1 if the table is full
+int schedAdd(Scheduler *sc, const char *name, SchedJobFn fn, void *arg, uint32_t first_delay_ms);
+
+// Make a job run as soon as possible - safe from any task. Not for IRAM
+// ISRs: the notify callback may be flash code (use schedMarkWoken()).
+void schedWake(Scheduler *sc, int job);
+
+// Mark a job woken without calling notify - for ISRs, which wake the task
+// themselves. Returns true if the job was not already woken.
+// Inline so it ends up inside an IRAM_ATTR ISR.
+static inline __attribute__((always_inline)) bool schedMarkWoken(Scheduler *sc, int job) {
+    if (job < 0 || job >= sc->count) {
+        return false;
+    }
+    return sc->jobs[job].woken.exchange(1) == 0;
+}
+
+// Ms until the earliest deadline: 0 if a job is due or woken, SCHED_IDLE
+// if every job is waiting for a wake. The owning task sleeps this long.
+uint32_t schedNextDeadline(Scheduler *sc);
+
+// Run every job that is due or woken. Returns schedNextDeadline().
+uint32_t schedRunDue(Scheduler *sc);
+
+#endif // BALECOUNTER_SCHEDULER_H
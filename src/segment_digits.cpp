@@ -0,0 +1,105 @@
+// Large seven-segment number drawn from filled rectangles - see segment_digits.h
+
+#include "segment_digits.h"
+#include <string.h>
+
+// Segments a-g for '0' to '9'
+static const uint8_t DIGIT_SEGMENTS[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+#define SEGMENT_MINUS 0x40
+
+static uint8_t segmentsFor(char c) {
+    if (c >= '0' && c <= '9') {
+        return DIGIT_SEGMENTS[c - '0'];
+    }
+    return (c == '-') ? SEGMENT_MINUS : 0;
+}
+
+// Fill one segment given relative to the digit's top left corner
+static void fillSegment(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *digit,
+                        lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2) {
+    lv_area_t area;
+    area.x1 = digit->x1 + x1;
+    area.y1 = digit->y1 + y1;
+    area.x2 = digit->x1 + x2;
+    area.y2 = digit->y1 + y2;
+    lv_draw_rect(draw_ctx, dsc, &area);
+}
+
+static void segmentDrawEvent(lv_event_t *e) {
+    uint8_t lit = *(const uint8_t *)lv_event_get_user_data(e);
+    if (lit == 0) {
+        return;
+    }
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+
+    lv_area_t digit;
+    lv_obj_get_coords(obj, &digit);
+    lv_coord_t w = lv_area_get_width(&digit);
+    lv_coord_t h = lv_area_get_height(&digit);
+    lv_coord_t t = h / 8;              // Segment thickness
+    if (t < 2) t = 2;
+    lv_coord_t gap = t / 4 > 0 ? t / 4 : 1;
+    lv_coord_t mid = (h - t) / 2;      // Top of the middle segment
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    dsc.bg_opa = LV_OPA_COVER;
+
+    // Horizontal segments leave a gap to the verticals, which run the full half height
+    if (lit & 0x01) fillSegment(draw_ctx, &dsc, &digit, t + gap, 0, w - 1 - t - gap, t - 1);             // a
+    if (lit & 0x02) fillSegment(draw_ctx, &dsc, &digit, w - t, 0, w - 1, h / 2 - 1);                     // b
+    if (lit & 0x04) fillSegment(draw_ctx, &dsc, &digit, w - t, h / 2, w - 1, h - 1);                     // c
+    if (lit & 0x08) fillSegment(draw_ctx, &dsc, &digit, t + gap, h - t, w - 1 - t - gap, h - 1);         // d
+    if (lit & 0x10) fillSegment(draw_ctx, &dsc, &digit, 0, h / 2, t - 1, h - 1);                         // e
+    if (lit & 0x20) fillSegment(draw_ctx, &dsc, &digit, 0, 0, t - 1, h / 2 - 1);                         // f
+    if (lit & 0x40) fillSegment(draw_ctx, &dsc, &digit, t + gap, mid, w - 1 - t - gap, mid + t - 1);     // g
+}
+
+void segmentDigitsReplace(SegmentDigits *sd, lv_obj_t *label, uint8_t digit_count, lv_coord_t height) {
+    if (digit_count > SEGMENT_MAX_DIGITS) {
+        digit_count = SEGMENT_MAX_DIGITS;
+    }
+    lv_coord_t digit_width = height * 5 / 9;
+    lv_coord_t spacing = height / 8;
+
+    sd->digit_count = digit_count;
+    sd->box = lv_obj_create(lv_obj_get_parent(label));
+    lv_obj_remove_style_all(sd->box);
+    lv_obj_set_size(sd->box, digit_width * digit_count + spacing * (digit_count - 1), height);
+    lv_obj_set_align(sd->box, lv_obj_get_style_align(label, LV_PART_MAIN));
+    lv_obj_set_pos(sd->box, lv_obj_get_style_x(label, LV_PART_MAIN), lv_obj_get_style_y(label, LV_PART_MAIN));
+    lv_obj_set_style_text_color(sd->box, lv_obj_get_style_text_color(label, LV_PART_MAIN), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_clear_flag(sd->box, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    for (uint8_t i = 0; i < digit_count; i++) {
+        sd->segments[i] = 0;
+        lv_obj_t *digit = lv_obj_create(sd->box);
+        lv_obj_remove_style_all(digit);
+        lv_obj_set_size(digit, digit_width, height);
+        lv_obj_set_pos(digit, (digit_width + spacing) * i, 0);
+        lv_obj_clear_flag(digit, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_event_cb(digit, segmentDrawEvent, LV_EVENT_DRAW_MAIN, &sd->segments[i]);
+        sd->digits[i] = digit;
+    }
+
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+}
+
+void segmentDigitsSetText(SegmentDigits *sd, const char *text) {
+    size_t len = strlen(text);
+    if (len > sd->digit_count) {
+        text += len - sd->digit_count;
+        len = sd->digit_count;
+    }
+    uint8_t blank = sd->digit_count - (uint8_t)len;
+
+    for (uint8_t i = 0; i < sd->digit_count; i++) {
+        uint8_t lit = (i < blank) ? 0 : segmentsFor(text[i - blank]);
+        if (sd->segments[i] != lit) {
+            sd->segments[i] = lit;
+            lv_obj_invalidate(sd->digits[i]);
+        }
+    }
+}
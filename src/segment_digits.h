@@ -0,0 +1,31 @@
+// Large seven-segment number drawn from filled rectangles
+//
+// For reading the bale count from the driver's seat in sunlight. Each digit
+// is one plain object whose draw callback fills its lit segments with the
+// text color, so no glyph bitmaps are stored and the digits can be any
+// height. Changing a digit only invalidates that digit's object.
+// Shows digits, '-' and blanks; any other character is drawn blank.
+
+#ifndef BALECOUNTER_SEGMENT_DIGITS_H
+#define BALECOUNTER_SEGMENT_DIGITS_H
+
+#include <lvgl.h>
+
+#define SEGMENT_MAX_DIGITS 8
+
+struct SegmentDigits {
+    lv_obj_t *box;                               // Fixed-size, unstyled container
+    lv_obj_t *digits[SEGMENT_MAX_DIGITS];        // One object per digit, left to right
+    uint8_t segments[SEGMENT_MAX_DIGITS];        // Lit segments per digit (bit 0 = a ... bit 6 = g)
+    uint8_t digit_count;
+};
+
+// Take over an existing label's parent, text color, alignment and position
+// with digit_count digits of the given height. The original label is hidden.
+void segmentDigitsReplace(SegmentDigits *sd, lv_obj_t *label, uint8_t digit_count, lv_coord_t height);
+
+// Show text right-aligned. Only digits whose segments changed are redrawn.
+// Text longer than the widget shows its last digit_count characters.
+void segmentDigitsSetText(SegmentDigits *sd, const char *text);
+
+#endif // BALECOUNTER_SEGMENT_DIGITS_H
@@ -0,0 +1,196 @@
+// Binary telemetry frames: fixed-layout events, CRC-16 and COBS framing - see telemetry.h
+
+#include "telemetry.h"
+#include <string.h>
+
+// CRC-16 of each byte value (polynomial 0x1021), for a byte per step
+static const uint16_t crc16_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+uint16_t crc16Ccitt(uint16_t crc, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len-- > 0) {
+        crc = (uint16_t)((crc << 8) ^ crc16_table[(crc >> 8) ^ *p++]);
+    }
+    return crc;
+}
+
+size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out) {
+    size_t code_pos = 0;   // Where the current block's length byte goes
+    size_t o = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; i++) {
+        if (in[i] != 0) {
+            out[o++] = in[i];
+            code++;
+        }
+        if (in[i] == 0 || code == 0xFF) {
+            out[code_pos] = code;
+            code_pos = o++;
+            code = 1;
+        }
+    }
+    out[code_pos] = code;
+    return o;
+}
+
+size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out, size_t out_size) {
+    size_t i = 0, o = 0;
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > len || o + code - 1 > out_size) {
+            return 0;
+        }
+        if (memchr(in + i, 0, code - 1) != NULL) {
+            return 0;
+        }
+        memcpy(out + o, in + i, code - 1);
+        i += code - 1;
+        o += code - 1;
+        // A block shorter than 254 bytes stands for a zero, except the last
+        if (code != 0xFF && i < len) {
+            if (o >= out_size) {
+                return 0;
+            }
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+static uint8_t *put16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t v) {
+    return put16(put16(p, (uint16_t)v), (uint16_t)(v >> 16));
+}
+
+static uint16_t get16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | ((uint32_t)get16(p + 2) << 16);
+}
+
+size_t telemetryPack(uint8_t *out, uint16_t seq, const TelemetryEvent *events, uint8_t count) {
+    uint8_t frame[TELEMETRY_FRAME_MAX];
+    uint8_t *p = frame;
+    *p++ = TELEMETRY_VERSION;
+    *p++ = count;
+    p = put16(p, seq);
+    for (uint8_t i = 0; i < count; i++) {
+        const TelemetryEvent *ev = &events[i];
+        *p++ = ev->type;
+        *p++ = ev->alerts;
+        p = put32(p, (uint32_t)ev->time_us);
+        p = put32(p, (uint32_t)(ev->time_us >> 32));
+        p = put32(p, ev->bale_count);
+        p = put32(p, ev->bale_count_year);
+        p = put16(p, ev->flake_count);
+        p = put16(p, ev->bales_in_session);
+        p = put16(p, ev->rate_x10);
+        p = put16(p, ev->loop_us);
+        p = put16(p, ev->loop_max_us);
+    }
+    p = put16(p, crc16Ccitt(0xFFFF, frame, p - frame));
+
+    out[0] = 0;
+    size_t n = 1 + cobsEncode(frame, p - frame, out + 1);
+    out[n++] = 0;
+    return n;
+}
+
+int telemetryParse(const uint8_t *frame, size_t len, uint16_t *seq, TelemetryEvent *events) {
+    if (len < TELEMETRY_HEADER_BYTES + 2 || frame[0] != TELEMETRY_VERSION) {
+        return -1;
+    }
+    uint8_t count = frame[1];
+    if (count == 0 || count > TELEMETRY_BATCH_MAX ||
+        len != TELEMETRY_HEADER_BYTES + (size_t)count * TELEMETRY_EVENT_BYTES + 2 ||
+        crc16Ccitt(0xFFFF, frame, len - 2) != get16(frame + len - 2)) {
+        return -1;
+    }
+    *seq = get16(frame + 2);
+    const uint8_t *p = frame + TELEMETRY_HEADER_BYTES;
+    for (uint8_t i = 0; i < count; i++, p += TELEMETRY_EVENT_BYTES) {
+        TelemetryEvent *ev = &events[i];
+        ev->type = p[0];
+        ev->alerts = p[1];
+        ev->time_us = get32(p + 2) | ((uint64_t)get32(p + 6) << 32);
+        ev->bale_count = get32(p + 10);
+        ev->bale_count_year = get32(p + 14);
+        ev->flake_count = get16(p + 18);
+        ev->bales_in_session = get16(p + 20);
+        ev->rate_x10 = get16(p + 22);
+        ev->loop_us = get16(p + 24);
+        ev->loop_max_us = get16(p + 26);
+    }
+    return count;
+}
+
+void telemetryQueueInit(TelemetryQueue *q) {
+    q->head.store(0);
+    q->tail.store(0);
+    q->dropped.store(0);
+}
+
+bool telemetryQueuePush(TelemetryQueue *q, const TelemetryEvent *ev) {
+    uint32_t head = q->head.load(std::memory_order_relaxed);
+    if (head - q->tail.load(std::memory_order_acquire) >= TELEMETRY_QUEUE_SIZE) {
+        q->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    q->events[head & (TELEMETRY_QUEUE_SIZE - 1)] = *ev;
+    q->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool telemetryQueuePop(TelemetryQueue *q, TelemetryEvent *out) {
+    uint32_t tail = q->tail.load(std::memory_order_relaxed);
+    if (tail == q->head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    *out = q->events[tail & (TELEMETRY_QUEUE_SIZE - 1)];
+    q->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+uint32_t telemetryQueueCount(const TelemetryQueue *q) {
+    return q->head.load(std::memory_order_acquire) - q->tail.load(std::memory_order_relaxed);
+}
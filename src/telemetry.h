@@ -0,0 +1,93 @@
+// Binary telemetry frames: fixed-layout events, CRC-16 and COBS framing
+//
+// With telemetry on ("telemetry on" on the console), the serial task sends
+// the count events as binary frames instead of log text. Each event is
+// TELEMETRY_EVENT_BYTES, little endian:
+//     type u8, alerts u8, time_us u64, bale_count u32, bale_count_year u32,
+//     flake_count u16, bales_in_session u16, rate_x10 u16, loop_us u16,
+//     loop_max_us u16
+// A frame holds 1 to TELEMETRY_BATCH_MAX events:
+//     version u8, count u8, seq u16, events, crc u16
+// The CRC is CRC-16/CCITT-FALSE of everything before it. The frame is then
+// COBS encoded, so it has no zero bytes, and sent between two zero bytes.
+// A reader that starts mid-stream, or sees a log line between frames,
+// loses at most one frame, and a gap in seq shows frames that were lost.
+//
+// The sensor task queues events (single producer, the serial task pops),
+// so a slow UART drops and counts events instead of stalling the counting.
+
+#ifndef BALECOUNTER_TELEMETRY_H
+#define BALECOUNTER_TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_EVENT_BYTES 28
+#define TELEMETRY_HEADER_BYTES 4
+#define TELEMETRY_BATCH_MAX 8
+#define TELEMETRY_FRAME_MAX (TELEMETRY_HEADER_BYTES + TELEMETRY_BATCH_MAX * TELEMETRY_EVENT_BYTES + 2)
+// COBS adds a byte per 254, plus the zero before and after the frame
+#define TELEMETRY_PACKED_MAX (TELEMETRY_FRAME_MAX + TELEMETRY_FRAME_MAX / 254 + 3)
+#define TELEMETRY_QUEUE_SIZE 32   // Events, power of two
+
+enum TelemetryType {
+    TELEM_STATUS = 1,   // Periodic, with the sensor loop timing
+    TELEM_BALE = 2,
+    TELEM_FLAKE = 3,
+    TELEM_RESET = 4     // After a reset button or console reset
+};
+
+struct TelemetryEvent {
+    uint8_t type;
+    uint8_t alerts;              // Active anomaly alerts (bit mask, low 8 bits)
+    uint64_t time_us;            // Since boot
+    uint32_t bale_count;
+    uint32_t bale_count_year;
+    uint16_t flake_count;
+    uint16_t bales_in_session;
+    uint16_t rate_x10;           // Bales per hour x 10
+    uint16_t loop_us;            // Last sensor task loop
+    uint16_t loop_max_us;        // Worst sensor task loop since the last status event
+};
+
+// CRC-16/CCITT-FALSE: start with crc = 0xFFFF
+uint16_t crc16Ccitt(uint16_t crc, const void *data, size_t len);
+
+// COBS encode len bytes (out needs len + len / 254 + 1). Returns the length.
+size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out);
+
+// COBS decode one frame, without its zero delimiter. Returns the decoded
+// length, or 0 if the data isn't valid COBS or doesn't fit in out_size.
+size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out, size_t out_size);
+
+// Build the frame for count events (1 to TELEMETRY_BATCH_MAX), COBS encode
+// it and add the zero delimiters. out needs TELEMETRY_PACKED_MAX bytes.
+// Returns the bytes to send.
+size_t telemetryPack(uint8_t *out, uint16_t seq, const TelemetryEvent *events, uint8_t count);
+
+// Check a decoded frame (version, length and CRC) and read its events.
+// Returns the number of events, or -1 if the frame is bad.
+int telemetryParse(const uint8_t *frame, size_t len, uint16_t *seq, TelemetryEvent *events);
+
+// Events from the sensor task to the serial task
+struct TelemetryQueue {
+    TelemetryEvent events[TELEMETRY_QUEUE_SIZE];
+    std::atomic<uint32_t> head;       // Next write (producer)
+    std::atomic<uint32_t> tail;       // Next read (consumer)
+    std::atomic<uint32_t> dropped;    // Events lost because the queue was full
+};
+
+void telemetryQueueInit(TelemetryQueue *q);
+
+// Add an event (one producer task). False and a drop if full.
+bool telemetryQueuePush(TelemetryQueue *q, const TelemetryEvent *ev);
+
+// Take the oldest event (one consumer task). False if empty.
+bool telemetryQueuePop(TelemetryQueue *q, TelemetryEvent *out);
+
+// Events waiting
+uint32_t telemetryQueueCount(const TelemetryQueue *q);
+
+#endif // BALECOUNTER_TELEMETRY_H
@@ -0,0 +1,103 @@
+// Touch sample filtering and 3-point affine calibration - see touch_filter.h
+
+#include "touch_filter.h"
+#include <math.h>
+
+static int16_t median3(int16_t a, int16_t b, int16_t c) {
+    if (a > b) { int16_t t = a; a = b; b = t; }
+    if (b > c) { b = c; }
+    return (a > b) ? a : b;
+}
+
+void touchFilterReset(TouchFilter *tf) {
+    tf->count = 0;
+}
+
+void touchFilterAdd(TouchFilter *tf, int16_t raw_x, int16_t raw_y, int16_t *out_x, int16_t *out_y) {
+    if (tf->count == 0) {
+        // Fill the history so the first point is used as-is
+        for (int i = 0; i < 3; i++) {
+            tf->hist_x[i] = raw_x;
+            tf->hist_y[i] = raw_y;
+        }
+        tf->x = raw_x;
+        tf->y = raw_y;
+    } else {
+        tf->hist_x[0] = tf->hist_x[1];
+        tf->hist_x[1] = tf->hist_x[2];
+        tf->hist_x[2] = raw_x;
+        tf->hist_y[0] = tf->hist_y[1];
+        tf->hist_y[1] = tf->hist_y[2];
+        tf->hist_y[2] = raw_y;
+        int16_t mx = median3(tf->hist_x[0], tf->hist_x[1], tf->hist_x[2]);
+        int16_t my = median3(tf->hist_y[0], tf->hist_y[1], tf->hist_y[2]);
+        tf->x += TOUCH_IIR_WEIGHT * (mx - tf->x);
+        tf->y += TOUCH_IIR_WEIGHT * (my - tf->y);
+    }
+    if (tf->count < 3) {
+        tf->count++;
+    }
+    *out_x = (int16_t)lroundf(tf->x);
+    *out_y = (int16_t)lroundf(tf->y);
+}
+
+void touchCalDefault(TouchCal *cal, int16_t width, int16_t height) {
+    // Same as map(raw_x, 200, 3700, 1, width) and map(raw_y, 240, 3800, 1, height)
+    cal->a = (width - 1) / 3500.0f;
+    cal->b = 0.0f;
+    cal->c = 1.0f - 200.0f * cal->a;
+    cal->d = 0.0f;
+    cal->e = (height - 1) / 3560.0f;
+    cal->f = 1.0f - 240.0f * cal->e;
+}
+
+bool touchCalSolve(TouchCal *cal, const int16_t screen[3][2], const int16_t raw[3][2]) {
+    float x0 = raw[0][0], y0 = raw[0][1];
+    float x1 = raw[1][0], y1 = raw[1][1];
+    float x2 = raw[2][0], y2 = raw[2][1];
+    float det = x0 * (y1 - y2) - y0 * (x1 - x2) + (x1 * y2 - x2 * y1);
+    // Raw units are ~12 bit, so a real triangle gives a determinant in the millions
+    if (fabsf(det) < 1000.0f) {
+        return false;
+    }
+
+    // Cramer's rule for [x y 1] * [a b c]^T = screen, once per screen axis
+    float coef[2][3];
+    for (int axis = 0; axis < 2; axis++) {
+        float s0 = screen[0][axis], s1 = screen[1][axis], s2 = screen[2][axis];
+        coef[axis][0] = (s0 * (y1 - y2) - y0 * (s1 - s2) + (s1 * y2 - s2 * y1)) / det;
+        coef[axis][1] = (x0 * (s1 - s2) - s0 * (x1 - x2) + (x1 * s2 - x2 * s1)) / det;
+        coef[axis][2] = (x0 * (y1 * s2 - y2 * s1) - y0 * (x1 * s2 - x2 * s1) + s0 * (x1 * y2 - x2 * y1)) / det;
+    }
+    cal->a = coef[0][0];
+    cal->b = coef[0][1];
+    cal->c = coef[0][2];
+    cal->d = coef[1][0];
+    cal->e = coef[1][1];
+    cal->f = coef[1][2];
+    return true;
+}
+
+void touchCalApply(const TouchCal *cal, int16_t raw_x, int16_t raw_y, int16_t width, int16_t height,
+                   int16_t *x, int16_t *y) {
+    float sx = cal->a * raw_x + cal->b * raw_y + cal->c;
+    float sy = cal->d * raw_x + cal->e * raw_y + cal->f;
+    if (sx < 0.0f) sx = 0.0f;
+    if (sx > width - 1) sx = width - 1;
+    if (sy < 0.0f) sy = 0.0f;
+    if (sy > height - 1) sy = height - 1;
+    *x = (int16_t)lroundf(sx);
+    *y = (int16_t)lroundf(sy);
+}
+
+bool touchCalValid(const TouchCal *cal) {
+    const float *v = &cal->a;
+    for (int i = 0; i < 6; i++) {
+        if (isnan(v[i]) || isinf(v[i])) {
+            return false;
+        }
+    }
+    // The raw-to-screen scale must not be degenerate
+    float det = cal->a * cal->e - cal->b * cal->d;
+    return fabsf(det) > 1e-6f;
+}
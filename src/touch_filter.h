@@ -0,0 +1,50 @@
+// Touch sample filtering and 3-point affine calibration
+//
+// Raw XPT2046 samples are noisy, so each sample goes through a median of the
+// last 3 (drops single spikes) and then an IIR low-pass. The filtered raw
+// point is mapped to screen pixels with an affine matrix solved from three
+// touched targets, which also corrects rotation and skew of the panel.
+
+#ifndef BALECOUNTER_TOUCH_FILTER_H
+#define BALECOUNTER_TOUCH_FILTER_H
+
+#include <stdint.h>
+
+// Weight of the newest (median) sample in the smoothed point (0..1)
+#define TOUCH_IIR_WEIGHT 0.5f
+
+struct TouchFilter {
+    int16_t hist_x[3];    // Last raw samples for the median
+    int16_t hist_y[3];
+    uint8_t count;        // Samples since the pen went down (saturates at 3)
+    float x;              // Smoothed raw point
+    float y;
+};
+
+// Screen x = a*raw_x + b*raw_y + c,  screen y = d*raw_x + e*raw_y + f
+struct TouchCal {
+    float a, b, c;
+    float d, e, f;
+};
+
+// Forget the history (call when the pen is lifted)
+void touchFilterReset(TouchFilter *tf);
+
+// Add a raw sample and get the filtered raw point
+void touchFilterAdd(TouchFilter *tf, int16_t raw_x, int16_t raw_y, int16_t *out_x, int16_t *out_y);
+
+// The fixed mapping used before calibration (raw 200..3700 x 240..3800)
+void touchCalDefault(TouchCal *cal, int16_t width, int16_t height);
+
+// Solve the matrix from three screen targets and the raw points touched on them.
+// Returns false (cal unchanged) if the points are too close to a line.
+bool touchCalSolve(TouchCal *cal, const int16_t screen[3][2], const int16_t raw[3][2]);
+
+// Map a raw point to the screen, clamped to width x height
+void touchCalApply(const TouchCal *cal, int16_t raw_x, int16_t raw_y, int16_t width, int16_t height,
+                   int16_t *x, int16_t *y);
+
+// Sanity check for a matrix loaded from storage
+bool touchCalValid(const TouchCal *cal);
+
+#endif // BALECOUNTER_TOUCH_FILTER_H
@@ -14,11 +14,11 @@ lv_obj_t * ui____initial_actions0;
 // IMAGES AND IMAGE SETS
 
 ///////////////////// TEST LVGL SETTINGS ////////////////////
-#if LV_COLOR_DEPTH != 16
+#if LV_COLOR_DEPTH != 16 && !(defined(UI_RENDER_8BIT) && LV_COLOR_DEPTH == 8)
     #error "LV_COLOR_DEPTH should be 16bit to match SquareLine Studio's settings"
 #endif
-#if LV_COLOR_16_SWAP !=0
-    #error "LV_COLOR_16_SWAP should be 0 to match SquareLine Studio's settings"
+#if LV_COLOR_16_SWAP !=1
+    #error "LV_COLOR_16_SWAP should be 1 to match the byte-swapped image data and DMA flush (see lv_conf.h)"
 #endif
 
 ///////////////////// ANIMATIONS ////////////////////
@@ -1,5 +1,4 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
+// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj
 // LVGL version: 8.3.6
 // Project name: BaleCounter
 
@@ -36,12 +35,14 @@ extern lv_obj_t * ui_FlakeCountNum1;
 extern lv_obj_t * ui_BaleCountHour;
 extern void ui_event_SettingsImgButton(lv_event_t * e);
 extern lv_obj_t * ui_SettingsImgButton;
+// Created on open and deleted on close (NULL while closed)
+extern void ui_SettingsPopup_create(void);
+extern void ui_SettingsPopup_destroy(void);
 extern lv_obj_t * ui_SettingsPopupPanel;
 extern lv_obj_t * ui_TabView1;
 extern lv_obj_t * ui_ResetCountsPage;
 extern void ui_event_FlakeCountResetBtn(lv_event_t * e);
 extern lv_obj_t * ui_FlakeCountResetBtn;
-extern void ui_event_FlakeCountButtonText(lv_event_t * e);
 extern lv_obj_t * ui_FlakeCountButtonText;
 extern void ui_event_BaleCountResetBtn(lv_event_t * e);
 extern lv_obj_t * ui_BaleCountResetBtn;
@@ -85,4 +86,3 @@ extern lv_obj_t * uiCYD_CloseImgButton;
 #endif
 
 #endif
-
@@ -0,0 +1,79 @@
+// Builds LVGL objects from the const tables written by tools/ui_gen.py - see ui_builder.h
+
+#include "ui_builder.h"
+
+static lv_obj_t * ui_build_create(const ui_obj_desc_t * d)
+{
+    lv_obj_t * parent = d->parent ? *d->parent : NULL;
+    lv_obj_t * obj;
+
+    switch(d->type) {
+        case UI_TYPE_SCREEN:
+            return lv_obj_create(NULL);
+        case UI_TYPE_CONTAINER:
+            obj = lv_obj_create(parent);
+            lv_obj_remove_style_all(obj);
+            return obj;
+        case UI_TYPE_LABEL:
+            obj = lv_label_create(parent);
+            lv_label_set_text_static(obj, d->text);
+            return obj;
+        case UI_TYPE_IMG:
+            obj = lv_img_create(parent);
+            lv_img_set_src(obj, d->src);
+            return obj;
+        case UI_TYPE_IMGBTN:
+            obj = lv_imgbtn_create(parent);
+            lv_imgbtn_set_src(obj, LV_IMGBTN_STATE_RELEASED, NULL, d->src, NULL);
+            if(d->src_pressed) lv_imgbtn_set_src(obj, LV_IMGBTN_STATE_PRESSED, NULL, d->src_pressed, NULL);
+            return obj;
+        case UI_TYPE_BTN:
+            return lv_btn_create(parent);
+        case UI_TYPE_TABVIEW:
+            return lv_tabview_create(parent, d->tab_dir, d->tab_size);
+        case UI_TYPE_TABPAGE:
+            return lv_tabview_add_tab(parent, d->text);
+        case UI_TYPE_PANEL:
+        default:
+            return lv_obj_create(parent);
+    }
+}
+
+void ui_build(const ui_obj_desc_t * objs, uint16_t obj_count,
+              const ui_style_desc_t * styles, uint16_t style_count)
+{
+    for(uint16_t i = 0; i < obj_count; i++) {
+        const ui_obj_desc_t * d = &objs[i];
+        lv_obj_t * obj = ui_build_create(d);
+
+        if(d->w || d->h) {
+            lv_obj_set_width(obj, d->w);
+            lv_obj_set_height(obj, d->h);
+        }
+        if(d->x || d->y) {
+            lv_obj_set_x(obj, d->x);
+            lv_obj_set_y(obj, d->y);
+        }
+        if(d->align != LV_ALIGN_DEFAULT) lv_obj_set_align(obj, d->align);
+        if(d->flags_add) lv_obj_add_flag(obj, d->flags_add);
+        if(d->flags_clear) lv_obj_clear_flag(obj, d->flags_clear);
+        if(d->event_cb) lv_obj_add_event_cb(obj, d->event_cb, LV_EVENT_ALL, NULL);
+
+        *d->obj = obj;
+        if(d->alias) *d->alias = obj;
+    }
+
+    for(uint16_t i = 0; i < style_count; i++) {
+        const ui_style_desc_t * s = &styles[i];
+        lv_obj_t * obj = s->tab_btns ? lv_tabview_get_tab_btns(*s->obj) : *s->obj;
+        lv_obj_add_style(obj, s->style, s->selector);
+    }
+}
+
+void ui_build_clear(const ui_obj_desc_t * objs, uint16_t obj_count)
+{
+    for(uint16_t i = 0; i < obj_count; i++) {
+        *objs[i].obj = NULL;
+        if(objs[i].alias) *objs[i].alias = NULL;
+    }
+}
@@ -0,0 +1,75 @@
+// Builds LVGL objects from the const tables written by tools/ui_gen.py
+//
+// Each screen (or on-demand part of one) is a table of objects in creation
+// order, parents first, plus a table of the shared styles each object uses.
+// The tables live in flash; ui_build() walks them and stores every object in
+// its ui_* handle, and its uiCYD_* alias if it has one.
+
+#ifndef _UI_BUILDER_H
+#define _UI_BUILDER_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    UI_TYPE_SCREEN,
+    UI_TYPE_PANEL,      // lv_obj with the theme's styles
+    UI_TYPE_CONTAINER,  // lv_obj with all styles removed
+    UI_TYPE_LABEL,
+    UI_TYPE_IMG,
+    UI_TYPE_IMGBTN,
+    UI_TYPE_BTN,
+    UI_TYPE_TABVIEW,
+    UI_TYPE_TABPAGE,
+} ui_obj_type_t;
+
+typedef struct {
+    lv_obj_t ** obj;             // ui_* handle
+    lv_obj_t ** alias;           // uiCYD_* handle, or NULL
+    lv_obj_t ** parent;          // NULL for a screen
+    const char * text;           // Label text or tab title (not copied)
+    const void * src;            // Image, or the released image of an image button
+    const void * src_pressed;    // Pressed image of an image button, or NULL
+    lv_event_cb_t event_cb;      // Added for LV_EVENT_ALL, or NULL
+    uint32_t flags_add;
+    uint32_t flags_clear;
+    lv_coord_t x, y;             // Not set if both are 0
+    lv_coord_t w, h;             // Not set if both are 0, may be LV_SIZE_CONTENT
+    uint8_t type;                // ui_obj_type_t
+    uint8_t align;               // Not set if LV_ALIGN_DEFAULT
+    uint8_t tab_dir;             // Tabview button position (lv_dir_t)
+    uint8_t tab_size;            // Tabview button height
+} ui_obj_desc_t;
+
+typedef struct {
+    lv_obj_t ** obj;
+    lv_style_t * style;
+    lv_style_selector_t selector;
+    bool tab_btns;               // Add to the tabview's buttons instead of the tabview
+} ui_style_desc_t;
+
+#define UI_TABLE_SIZE(table) (sizeof(table) / sizeof((table)[0]))
+
+// Image source of a table row: the array compiled into the app, or with
+// UI_ASSETS_PARTITION the same image in the assets partition (see asset_fs.h)
+#ifdef UI_ASSETS_PARTITION
+#define UI_IMG(symbol, file) ("A:" file)
+#else
+#define UI_IMG(symbol, file) (&symbol)
+#endif
+
+// Create the objects of a table, then add their styles
+void ui_build(const ui_obj_desc_t * objs, uint16_t obj_count,
+              const ui_style_desc_t * styles, uint16_t style_count);
+
+// Set the handles and aliases of a table to NULL (after its objects are deleted)
+void ui_build_clear(const ui_obj_desc_t * objs, uint16_t obj_count);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
@@ -6,22 +6,35 @@
 #include "ui.h"
 
 // Functions are defined in main.cpp with C linkage
-void resetFlakeCount();
-void resetBaleCount();
-void resetBaleCountYear();
-void resetBalesPerHourSession();
+// The resets run in the sensor task, these only post the request
+void requestResetFlakeCount();
+void requestResetBaleCount();
+void requestResetBaleCountYear();
+// Builds or deletes the settings popup with the pages added in main.cpp
+void toggleSettingsPopup();
+void closeSettingsPopup();
 
 void handleResetFlakeCountBtnClick(lv_event_t * e)
 {
-	resetFlakeCount();
+	requestResetFlakeCount();
 }
 
 void handleResetBaleCountBtnClick(lv_event_t * e)
 {
-	resetBaleCount();
+	requestResetBaleCount();
 }
 
 void handleResetBaleYearCountBtnClick(lv_event_t * e)
 {
-	resetBaleCountYear();
+	requestResetBaleCountYear();
+}
+
+void handleSettingsBtnClick(lv_event_t * e)
+{
+	toggleSettingsPopup();
+}
+
+void handleSettingsCloseBtnClick(lv_event_t * e)
+{
+	closeSettingsPopup();
 }
@@ -13,6 +13,8 @@ extern "C" {
 void handleResetFlakeCountBtnClick(lv_event_t * e);
 void handleResetBaleCountBtnClick(lv_event_t * e);
 void handleResetBaleYearCountBtnClick(lv_event_t * e);
+void handleSettingsBtnClick(lv_event_t * e);
+void handleSettingsCloseBtnClick(lv_event_t * e);
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -1,69 +1,123 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
+// This file was generated by tools/img_convert.py from a SquareLine Studio asset
 // LVGL version: 8.3.6
 // Project name: BaleCounter
 
 #include "ui.h"
 
+// With UI_ASSETS_PARTITION the image is read from the assets partition instead
+// (tools/pack_assets.py), so it is left out of the app
+#ifndef UI_ASSETS_PARTITION
+
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-// IMAGE DATA: assets/hay flake_better_60tall.png
+// IMAGE DATA: assets/hay flake_better_60tall.png (alpha pre-blended onto 0x15171A, RGB332 for the 8-bit render mode)
+#if LV_COLOR_DEPTH == 8
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_flake_better_60tall_png_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x72,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x96,0x96,0x96,0x96,0x96,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x92,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x92,0x4D,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x8D,0x91,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8D,0x8D,0x8D,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0xD5,0xD5,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x00,0x00,0x00,0x6D,0x6D,0x6D,0x00,0x00,0x00,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x90,0x90,0x90,0x90,0x90,0x8C,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x91,0x91,0x91,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0xB5,0xB5,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xB5,0xB5,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0x91,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x91,0x91,0x91,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0xB5,0xB5,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xB5,0xB5,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0x91,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x91,0x91,0x91,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x91,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x48,0x24,0x24,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x24,0x24,0x48,0x48,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x48,0x24,0x24,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x24,0x24,0x48,0x48,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD9,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD9,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD9,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0x91,0x91,0x91,0x68,0x68,0x68,0x68,0x48,0x48,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x48,0x48,0x68,0x68,0x68,0x68,0x6C,0x6C,0xF9,0xF9,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0xD5,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB1,0xB1,0xB1,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0xD9,0xD9,0xD9,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB1,0xB1,0xB1,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0xD9,0xD9,0xD9,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD5,0xD5,0xD5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x68,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD5,0xD5,0xD5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x68,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF9,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xD9,0xD9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xD9,0xD9,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD9,0xD9,0xD9,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x68,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0xB1,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xD9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6D,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x24,0x24,0x24,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6D,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x24,0x24,0x24,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6D,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x24,0x24,0x24,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB1,0xB1,0xB1,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6D,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB1,0xB1,0xB1,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6D,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB5,0xB5,0xB5,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x91,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0xF9,0x00,0x00,0x00,0xB6,0xB6,0xB6,0x00,0x00,0x00,0xF9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x24,0x24,0x24,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+#else
+// IMAGE DATA: assets/hay flake_better_60tall.png (alpha pre-blended onto 0x15171A)
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_flake_better_60tall_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xBF,0x77,0x9D,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0x98,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0x02,0x77,0x9D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0x4D,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0x2F,0x77,0x9D,0xCD,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0x80,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xD0,0x77,0x9D,0x7F,0x77,0x9D,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x77,0x9D,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x4F,0x00,0x00,0x4F,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x38,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x4F,0x00,0x00,0x01,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x4F,0x00,0x00,0x4F,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x4F,0x00,0x00,0x01,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2E,0xD6,0x92,0x2E,0xD6,0x92,0x50,0xFF,0x88,0x50,0xFF,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x25,0x50,0xFF,0x25,0xA1,0x18,0xEB,0xA1,0x18,0xEB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x80,0x00,0x00,0x80,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE8,0x83,0xFF,0xE8,0x83,0xFF,0xE8,0x83,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x0B,0x50,0xFF,0x0B,0xAC,0xC5,0xFF,0xAC,0xC5,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x29,0x8C,0xFF,0x29,0x8C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x82,0x10,0xFF,0x2D,0x63,0xFF,0x2D,0x63,0xFF,0x2D,0x63,0xFF,0x82,0x10,0xFF,0x82,0x10,0xFF,0x82,0x10,0xFF,0x29,0x8C,0xFF,0x29,0x8C,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x47,0x94,0xFF,0x47,0x94,0xFF,0x47,0x94,0xFF,0x47,0x94,0xFF,0x47,0x94,0xFF,0xC6,0x83,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC4,0x00,0x00,0xC4,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x0D,0x50,0xFF,0x0D,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0xA9,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x0D,0x50,0xFF,0x0D,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0xA9,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAA,0x9C,0xFF,0xAA,0x9C,0xFF,0xAA,0x9C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x28,0x50,0xFF,0x28,0x50,0xFF,0xF3,0x50,0xFF,0xF3,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x6E,0xDE,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x2D,0xD6,0xFF,0x2D,0xD6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x88,0x9C,0xFF,0x00,0x00,0xFF,0x00,0x00,0x84,0x00,0x00,0x84,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAA,0x9C,0xFF,0xAA,0x9C,0xFF,0xAA,0x9C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x28,0x50,0xFF,0x28,0x50,0xFF,0xF3,0x50,0xFF,0xF3,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x6E,0xDE,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x2D,0xD6,0xFF,0x2D,0xD6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x88,0x9C,0xFF,0x00,0x00,0xFF,0x00,0x00,0x84,0x00,0x00,0x84,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x9C,0xFF,0x6A,0x9C,0xFF,0x6A,0x9C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x31,0x50,0xFF,0x31,0x50,0xFF,0xDB,0x50,0xFF,0xDB,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xED,0xCD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x09,0x8C,0xFF,0x09,0x8C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x47,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7B,0x00,0x00,0x7B,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x31,0x50,0xFF,0x31,0x50,0xFF,0xDB,0x50,0xFF,0xDB,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xEF,0xEE,0xFF,0x85,0x52,0xFF,0xC4,0x39,0xFF,0xC4,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xC4,0x39,0xFF,0xC4,0x39,0xFF,0x45,0x4A,0xFF,0x45,0x4A,0xFF,0x0D,0xCE,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0x9E,0x00,0x00,0x9E,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x31,0x50,0xFF,0x31,0x50,0xFF,0xDB,0x50,0xFF,0xDB,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xEF,0xEE,0xFF,0x85,0x52,0xFF,0xC4,0x39,0xFF,0xC4,0x39,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xC4,0x39,0xFF,0xC4,0x39,0xFF,0x45,0x4A,0xFF,0x45,0x4A,0xFF,0x0D,0xCE,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0x9E,0x00,0x00,0x9E,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x3F,0x50,0xFF,0x3F,0x50,0xFF,0xF3,0x50,0xFF,0xF3,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x4B,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC6,0x00,0x00,0xC6,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x3F,0x50,0xFF,0x3F,0x50,0xFF,0xF3,0x50,0xFF,0xF3,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x4B,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC6,0x00,0x00,0xC6,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0F,0xEF,0xFF,0x0F,0xEF,0xFF,0x0F,0xEF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4E,0x50,0xFF,0x4E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2D,0xF7,0xFF,0x2D,0xF7,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xCC,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xD5,0x00,0x00,0xD5,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0F,0xEF,0xFF,0x0F,0xEF,0xFF,0x0F,0xEF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4E,0x50,0xFF,0x4E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2D,0xF7,0xFF,0x2D,0xF7,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xCC,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xD5,0x00,0x00,0xD5,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2D,0xD6,0xFF,0x2D,0xD6,0xFF,0x2D,0xD6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4C,0x50,0xFF,0x4C,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x29,0x8C,0xFF,0x29,0x8C,0xFF,0x29,0x8C,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xA6,0x5A,0xFF,0xA6,0x5A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xA6,0x5A,0xFF,0xA6,0x5A,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0x47,0x73,0xFF,0x47,0x73,0xFF,0xEF,0xEE,0xFF,0xEF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0A,0xD6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xBD,0x00,0x00,0xBD,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x97,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x48,0x50,0xFF,0x48,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x81,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xED,0xCD,0xFF,0xED,0xCD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0x97,0x00,0x00,0x97,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEB,0xA4,0xFF,0xEB,0xA4,0xFF,0xEB,0xA4,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4C,0x50,0xFF,0x4C,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x4E,0xDE,0xFF,0x4E,0xDE,0xFF,0x4E,0xDE,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0B,0xAD,0xFF,0x0B,0xAD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x0B,0xAD,0xFF,0x0B,0xAD,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0D,0xCE,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8B,0x00,0x00,0x8B,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEB,0xA4,0xFF,0xEB,0xA4,0xFF,0xEB,0xA4,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4C,0x50,0xFF,0x4C,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x4E,0xDE,0xFF,0x4E,0xDE,0xFF,0x4E,0xDE,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0B,0xAD,0xFF,0x0B,0xAD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x0B,0xAD,0xFF,0x0B,0xAD,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0D,0xCE,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8B,0x00,0x00,0x8B,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAC,0xC5,0xFF,0xAC,0xC5,0xFF,0xAC,0xC5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x56,0x50,0xFF,0x56,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x8A,0xC5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0xA9,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAC,0xC5,0xFF,0xAC,0xC5,0xFF,0xAC,0xC5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x56,0x50,0xFF,0x56,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x8A,0xC5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0xA9,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8E,0xE6,0xFF,0x8E,0xE6,0xFF,0x8E,0xE6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x4C,0x50,0xFF,0x4C,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0F,0xF7,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0xEF,0xEE,0xFF,0xEF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2C,0xF7,0xFF,0x2C,0xF7,0xFF,0x2C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x6B,0xE6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC7,0x00,0x00,0xC7,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x6E,0xDE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x54,0x50,0xFF,0x54,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2E,0xD6,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAA,0xA4,0xFF,0xAA,0xA4,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2C,0xF7,0xFF,0x2C,0xF7,0xFF,0x2C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x2B,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xBF,0x00,0x00,0xBF,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x6E,0x50,0xFF,0x6E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xAF,0xE6,0xFF,0xC4,0x39,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0xA3,0x31,0xFF,0xA3,0x31,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA1,0x00,0x00,0xA1,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x6E,0x50,0xFF,0x6E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xAF,0xE6,0xFF,0xC4,0x39,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0xA3,0x31,0xFF,0xA3,0x31,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA1,0x00,0x00,0xA1,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x6E,0x50,0xFF,0x6E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xAF,0xE6,0xFF,0xC4,0x39,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0xA3,0x31,0xFF,0xA3,0x31,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA1,0x00,0x00,0xA1,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEB,0xAC,0xFF,0xEB,0xAC,0xFF,0xEB,0xAC,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x6E,0x50,0xFF,0x6E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8A,0x00,0x00,0x8A,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEB,0xAC,0xFF,0xEB,0xAC,0xFF,0xEB,0xAC,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x6E,0x50,0xFF,0x6E,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8A,0x00,0x00,0x8A,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0x01,0x50,0xFF,0x80,0x50,0xFF,0x80,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xE4,0x18,0xFF,0xCF,0xEE,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA5,0x00,0x00,0xA5,
-    0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0xF3,0x00,0x00,0xFF,0x00,0x00,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x22,0x29,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x31,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x31,0x02,0x63,0x31,0x03,0x63,0x31,0x92,0x63,0x31,0x92,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x04,0x21,0xFF,0x04,0x21,0xFF,0x04,0x21,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x20,0x00,0xFF,0x63,0x29,0xFF,0x63,0x29,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x62,0x31,0xFF,0x62,0x31,0xFF,0x62,0x31,0xFF,0x62,0x31,0xFF,0x62,0x31,0xFF,0x22,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF3,0x00,0x00,0xF3,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x69,0x00,0x00,0x69,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x6B,0x00,0x00,0x6B,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x69,0x00,0x00,0x69,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x6B,0x00,0x00,0x6B,
-    
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x7C,0x32,0x39,0xE8,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x5B,0x0D,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x63,0x8F,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xC3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x3A,0x29,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x52,0xCC,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x42,0x6A,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x29,0x87,0x84,0x93,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5B,0x0D,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x84,0x93,0x5B,0x0D,0x5B,0x0D,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x9D,0x77,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x08,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x10,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x08,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x10,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xE9,0x83,0xE9,0x8C,0x2A,0x8C,0x2A,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x31,0xA5,0x31,0xA5,0x18,0xA1,0x18,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0x83,0xE8,0x83,0xE8,0x83,0xE8,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x19,0x03,0x19,0x03,0xC5,0xAC,0xC5,0xAC,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x8C,0x29,0x8C,0x29,0x00,0x00,0x00,0x00,0x10,0x82,0x63,0x2D,0x63,0x2D,0x63,0x2D,0x10,0x82,0x10,0x82,0x10,0x82,0x8C,0x29,0x8C,0x29,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x47,0x94,0x47,0x94,0x47,0x94,0x47,0x94,0x47,0x83,0xC6,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x21,0x03,0x21,0x03,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x00,0x41,0x00,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x21,0x03,0x21,0x03,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x00,0x41,0x00,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x9C,0xAA,0x9C,0xAA,0x9C,0xAA,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x39,0xC5,0x39,0xC5,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xDE,0x6E,0xBD,0x8C,0xBD,0x8C,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xBD,0x8C,0xBD,0x8C,0xD6,0x2D,0xD6,0x2D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x9C,0x88,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x9C,0xAA,0x9C,0xAA,0x9C,0xAA,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x39,0xC5,0x39,0xC5,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xDE,0x6E,0xBD,0x8C,0xBD,0x8C,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xBD,0x8C,0xBD,0x8C,0xD6,0x2D,0xD6,0x2D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x9C,0x88,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x61,0x00,0x00,0x00,0x00,0x9C,0x6A,0x9C,0x6A,0x9C,0x6A,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x41,0xE5,0x41,0xE5,0xDE,0x4E,0xDE,0x4E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xCD,0xED,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x09,0x8C,0x09,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x94,0x47,0x00,0x00,0x08,0x61,0x08,0x61,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xB5,0x2B,0xB5,0x2B,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x41,0xE5,0x41,0xE5,0xDE,0x4E,0xDE,0x4E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xEF,0x52,0x85,0x39,0xC4,0x39,0xC4,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x39,0xC4,0x39,0xC4,0x4A,0x45,0x4A,0x45,0xCE,0x0D,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xB5,0x09,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xB5,0x2B,0xB5,0x2B,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x41,0xE5,0x41,0xE5,0xDE,0x4E,0xDE,0x4E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xEF,0x52,0x85,0x39,0xC4,0x39,0xC4,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x39,0xC4,0x39,0xC4,0x4A,0x45,0x4A,0x45,0xCE,0x0D,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xB5,0x09,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xDE,0x6E,0xDE,0x6E,0xDE,0x6E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x4A,0x46,0x4A,0x46,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xDE,0x4B,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xDE,0x6E,0xDE,0x6E,0xDE,0x6E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x4A,0x46,0x4A,0x46,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xDE,0x4B,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xEF,0x0F,0xEF,0x0F,0xEF,0x0F,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2D,0xF7,0x2D,0xF7,0x2D,0xF7,0x0C,0xF7,0x0C,0xEE,0xCC,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xEF,0x0F,0xEF,0x0F,0xEF,0x0F,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2D,0xF7,0x2D,0xF7,0x2D,0xF7,0x0C,0xF7,0x0C,0xEE,0xCC,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xD6,0x2D,0xD6,0x2D,0xD6,0x2D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0x8C,0x29,0x8C,0x29,0x8C,0x29,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x5A,0xA6,0x5A,0xA6,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x5A,0xA6,0x5A,0xA6,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x73,0x47,0x73,0x47,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xD6,0x0A,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xB5,0x2B,0xB5,0x2B,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x52,0x87,0x52,0x87,0xFF,0x50,0xFF,0x50,0x10,0x81,0x10,0x81,0x10,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0xED,0xCD,0xED,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xB5,0x09,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xA4,0xEB,0xA4,0xEB,0xA4,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0xDE,0x4E,0xDE,0x4E,0xDE,0x4E,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xAD,0x0B,0xAD,0x0B,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xAD,0x0B,0xAD,0x0B,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xCE,0x0D,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xA4,0xEB,0xA4,0xEB,0xA4,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0xDE,0x4E,0xDE,0x4E,0xDE,0x4E,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xAD,0x0B,0xAD,0x0B,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xAD,0x0B,0xAD,0x0B,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xCE,0x0D,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x00,0x00,0xC5,0xAC,0xC5,0xAC,0xC5,0xAC,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x62,0xE7,0x62,0xE7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xC5,0x8A,0x00,0x00,0x00,0x41,0x00,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x00,0x00,0xC5,0xAC,0xC5,0xAC,0xC5,0xAC,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x62,0xE7,0x62,0xE7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xC5,0x8A,0x00,0x00,0x00,0x41,0x00,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xE6,0x8E,0xE6,0x8E,0xE6,0x8E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x5A,0xA7,0x5A,0xA7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0F,0xDE,0x6E,0xDE,0x6E,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xDE,0x6E,0xDE,0x6E,0xEE,0xEF,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2C,0xF7,0x2C,0xF7,0x2C,0xF7,0x0C,0xF7,0x0C,0xE6,0x6B,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0xDE,0x6E,0xDE,0x6E,0xDE,0x6E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x62,0xE7,0x62,0xE7,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xD6,0x2E,0x08,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xAA,0xA4,0xAA,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2C,0xF7,0x2C,0xF7,0x2C,0xF7,0x0C,0xF7,0x0C,0xDE,0x2B,0x00,0x00,0x00,0x20,0x00,0x20,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x73,0x88,0x73,0x88,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xE6,0xAF,0x39,0xC4,0x29,0x63,0x29,0x63,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x29,0x63,0x29,0x63,0x31,0xA3,0x31,0xA3,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x73,0x88,0x73,0x88,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xE6,0xAF,0x39,0xC4,0x29,0x63,0x29,0x63,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x29,0x63,0x29,0x63,0x31,0xA3,0x31,0xA3,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x73,0x88,0x73,0x88,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xE6,0xAF,0x39,0xC4,0x29,0x63,0x29,0x63,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x29,0x63,0x29,0x63,0x31,0xA3,0x31,0xA3,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xAC,0xEB,0xAC,0xEB,0xAC,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x73,0x88,0x73,0x88,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0xAC,0xEB,0xAC,0xEB,0xAC,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x73,0x88,0x73,0x88,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x08,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x00,0x00,0xBD,0x8C,0xBD,0x8C,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x84,0x09,0x84,0x09,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0xEE,0xCF,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x18,0xE4,0x18,0xE4,0xEE,0xCF,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x00,0x41,0x00,0x41,
+    0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x22,0x29,0x22,0x29,0x22,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x21,0x23,0x21,0x23,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x29,0x63,0x29,0x63,0x00,0x00,0x00,0x00,0x00,0x20,0x21,0x04,0x21,0x04,0x21,0x04,0x00,0x20,0x00,0x20,0x00,0x20,0x29,0x63,0x29,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x62,0x31,0x62,0x31,0x62,0x31,0x62,0x31,0x62,0x29,0x22,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x61,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x08,0x61,
+    0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x61,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x08,0x61,
 };
+#endif
 const lv_img_dsc_t ui_img_hay_flake_better_60tall_png = {
     .header.always_zero = 0,
     .header.w = 64,
     .header.h = 45,
     .data_size = sizeof(ui_img_hay_flake_better_60tall_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_hay_flake_better_60tall_png_data
 };
 
+#endif // UI_ASSETS_PARTITION
@@ -1,88 +1,161 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
+// This file was generated by tools/img_convert.py from a SquareLine Studio asset
 // LVGL version: 8.3.6
 // Project name: BaleCounter
 
 #include "ui.h"
 
+// With UI_ASSETS_PARTITION the image is read from the assets partition instead
+// (tools/pack_assets.py), so it is left out of the app
+#ifndef UI_ASSETS_PARTITION
+
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-// IMAGE DATA: assets/hay.png
+// IMAGE DATA: assets/hay.png (alpha pre-blended onto 0x15171A, RGB332 for the 8-bit render mode)
+#if LV_COLOR_DEPTH == 8
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_png_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xB5,0xFE,0xFE,0xD5,0x91,0x91,0x91,0x91,0x91,0x91,0x00,0x00,0x6D,0x6D,0x00,0x00,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x90,0x90,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0xB5,0x00,0x00,0xB6,0xB6,0x00,0x00,0xB5,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD5,0x00,0x00,0x00,0x00,0xB6,0xB6,0x00,0x00,0x00,0x00,0x91,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x48,0x24,0x00,0x00,0xB6,0xB6,0x00,0x00,0x24,0x48,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0x91,0x68,0x68,0x68,0x48,0x00,0x00,0xB6,0xB6,0x00,0x00,0x48,0x68,0x68,0x68,0x6C,0xF9,0xFE,0xFE,0xFD,0xFD,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0xFE,0xFE,0xFD,0xFD,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0xB5,0xB5,0xB5,0xB5,0x00,0x00,0xB6,0xB6,0x00,0x00,0xB5,0xB5,0xB5,0xB5,0xD9,0xFE,0xFE,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xD9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xD9,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xD9,0x00,0x00,0x00,0x00,0xB6,0xB6,0x00,0x00,0x00,0x00,0xB1,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x24,0x24,0x00,0x00,0xB6,0xB6,0x00,0x00,0x24,0x24,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF9,0x00,0x00,0xB6,0xB6,0x00,0x00,0xF9,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x24,0x24,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xD4,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x20,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x90,0x00,0x49,0x96,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x24,0x00,0x92,0x96,0x49,0x00,0x90,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x6C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD4,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xD4,0x6C,0x48,0x00,0x49,0xB6,0x92,0x00,0x00,0x6C,0x8C,0xF8,0xF8,0xF8,0xF8,0xF8,0xD4,0x00,0x48,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xB1,0x6C,0x00,0x00,0x92,0xB6,0x49,0x00,0x48,0x6C,0xB5,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xD8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0x00,0x00,0x49,0xB6,0x92,0x00,0x00,0x00,0x00,0xD4,0xF8,0xF8,0xF8,0xF8,0xB4,0x00,0x48,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x00,0x00,0x00,0x00,0x92,0xB6,0x49,0x00,0x00,0x00,0x24,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x68,0x00,0x49,0xB6,0x92,0x00,0x24,0xB0,0xB0,0xF8,0xF8,0xF8,0xF8,0xF8,0x8C,0x00,0x6C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xD5,0xB1,0x24,0x00,0x92,0xB6,0x49,0x00,0x6C,0xB1,0xD9,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x24,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x24,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xB6,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xF8,0xF8,0x8C,0x00,0x6C,0xFD,0xFD,0xFD,0xFD,0xFD,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xB6,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xD4,0x24,0x20,0x20,0x20,0x00,0x00,0x49,0xB6,0x92,0x00,0x00,0x20,0x20,0x20,0x20,0x48,0xF8,0xF8,0xB0,0x00,0x68,0xFD,0xFD,0xFD,0xFD,0xFD,0x8C,0x20,0x20,0x20,0x20,0x00,0x00,0x92,0xB6,0x49,0x00,0x00,0x20,0x20,0x20,0x24,0xB5,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x6C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x8C,0x00,0x8C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x90,0x68,0x00,0x49,0xB6,0x92,0x00,0x20,0x8C,0xB0,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xD5,0x90,0x20,0x00,0x92,0xB6,0x49,0x00,0x68,0x90,0xD9,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x24,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x6C,0x00,0x00,0x00,0x49,0xB6,0x92,0x00,0x00,0x00,0x00,0xD4,0xF8,0xF8,0xF8,0xF8,0x8C,0x00,0x8C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x00,0x00,0x00,0x00,0x92,0xB6,0x49,0x00,0x00,0x00,0x44,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xD4,0x8C,0x48,0x00,0x49,0xB6,0x92,0x00,0x00,0x8C,0x90,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x6C,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xB5,0x8C,0x00,0x00,0x92,0xB6,0x49,0x00,0x48,0x8C,0xD5,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x49,0xB6,0x92,0x00,0x24,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xB0,0x00,0x68,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x24,0x00,0x92,0xB6,0x49,0x00,0xB1,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xF9,0xF9,0xF9,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0x8C,0x00,0x25,0x92,0x6E,0x00,0x24,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0x6C,0x00,0x68,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0x24,0x00,0x6E,0x92,0x25,0x00,0x8C,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD5,0xD4,0xD4,0xD4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x75,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x75,0x00,0x00,
+    0x00,0x00,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x00,0x00,
+    0x00,0x00,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x00,0x00,
+    0x00,0x00,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x00,0x00,
+    0x00,0x00,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x00,0x00,
+    0x00,0x00,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+#else
+// IMAGE DATA: assets/hay.png (alpha pre-blended onto 0x15171A)
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x4F,0x00,0x00,0x77,0x00,0x00,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x4F,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2E,0xD6,0x92,0x50,0xFF,0x88,0xA1,0x18,0xEB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x00,0x00,0xFF,0xE8,0x83,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xAC,0xC5,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x29,0x8C,0xFF,0x00,0x00,0xFF,0x82,0x10,0xFF,0x2D,0x63,0xFF,0x2D,0x63,0xFF,0x82,0x10,0xFF,0x00,0x00,0xFF,0x29,0x8C,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x49,0x94,0xFF,0x47,0x94,0xFF,0x47,0x94,0xFF,0xC6,0x83,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x00,0xFF,0xAA,0x9C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x6E,0xDE,0xFF,0x8C,0xBD,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x2D,0xD6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2F,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x88,0x9C,0xFF,0x00,0x00,0xFF,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x00,0x00,0xFF,0x6A,0x9C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xED,0xCD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x09,0x8C,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2F,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x47,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x00,0x00,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xEF,0xEE,0xFF,0x85,0x52,0xFF,0xC4,0x39,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xC4,0x39,0xFF,0x45,0x4A,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x4B,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0x00,0x00,0xFF,0x0F,0xEF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2D,0xF7,0xFF,0x0C,0xF7,0xFF,0xCC,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0x00,0xFF,0x2D,0xD6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x29,0x8C,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xA6,0x5A,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xA6,0x5A,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0xE6,0x62,0xFF,0x47,0x73,0xFF,0xEF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0A,0xD6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x97,0x00,0x00,0xFF,0x2B,0xB5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x30,0xF7,0xFF,0x81,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xED,0xCD,0xFF,0x50,0xFF,0xFF,0x30,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xB5,0xFF,0x00,0x00,0xFF,0x00,0x00,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0xEB,0xA4,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x4E,0xDE,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0B,0xAD,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x0B,0xAD,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x4C,0xB5,0xFF,0x0D,0xCE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2F,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x00,0x00,0xFF,0xAC,0xC5,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x8A,0xC5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x00,0x00,0xFF,0x8E,0xE6,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x0F,0xF7,0xFF,0x6E,0xDE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0xEF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2C,0xF7,0xFF,0x0C,0xF7,0xFF,0x6B,0xE6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,0x00,0xFF,0x6E,0xDE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2E,0xD6,0xFF,0x60,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAA,0xA4,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2C,0xF7,0xFF,0x0C,0xF7,0xFF,0x2B,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xAF,0xE6,0xFF,0xC4,0x39,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0x63,0x29,0xFF,0xA3,0x31,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x30,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0x00,0xFF,0xEB,0xAC,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x2F,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x00,0x00,0xFF,0x8C,0xBD,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0xCF,0xEE,0xFF,0x00,0x00,0xFF,0xE4,0x18,0xFF,0x57,0xA5,0xFF,0x57,0xA5,0xFF,0xE4,0x18,0xFF,0x00,0x00,0xFF,0xCF,0xEE,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x50,0xFF,0xFF,0x30,0xFF,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x69,0xBD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0xBD,0x00,0x00,0xB9,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x6C,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xF3,0x00,0x00,0xFF,0x22,0x29,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x29,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0x04,0x21,0xFF,0x04,0x21,0xFF,0x20,0x00,0xFF,0x00,0x00,0xFF,0x63,0x29,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x63,0x31,0xFF,0x62,0x31,0xFF,0x62,0x31,0xFF,0x22,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF3,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xCC,0x00,0x00,0xBD,0x00,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0xEE,0x00,0x00,0xFF,0x40,0x08,0xFD,0x85,0xCD,0xE2,0x86,0xF6,0xDD,0x22,0x4A,0xF3,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xED,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0xFE,0xE0,0x20,0xFF,0x66,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x23,0x9C,0xFF,0x00,0x00,0xFF,0x49,0x42,0xFF,0x15,0x95,0xFF,0x93,0x8C,0xFF,0x00,0x00,0xFF,0x61,0x31,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x25,0xE6,0xFF,0x23,0x73,0xFF,0x00,0x00,0xFF,0xE6,0x8B,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0x82,0x31,0xFF,0x00,0x00,0xFF,0x93,0x8C,0xFF,0x15,0x95,0xFF,0x49,0x42,0xFF,0x00,0x00,0xFF,0x67,0x9C,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0xAB,0xE6,0xFF,0x89,0xE6,0xFF,0x68,0xE6,0xFF,0x68,0xE6,0xFF,0xE1,0x20,0xFF,0x00,0x00,0xFE,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x00,0x00,0xFF,0x66,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x05,0x6B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xC8,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0x00,0xFF,0xE5,0xDD,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xC5,0xD5,0xFF,0x43,0x7B,0xFF,0x01,0x4A,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0xA0,0x18,0xFF,0x02,0x73,0xFF,0xA3,0x8B,0xFF,0x66,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x45,0xC5,0xFF,0x00,0x00,0xFF,0x64,0x52,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xC8,0xAC,0xFF,0x45,0x73,0xFF,0xC1,0x18,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x23,0x4A,0xFF,0x46,0x73,0xFF,0x69,0xBD,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0x27,0xDE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x00,0x00,0xFF,0x05,0xDE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x63,0x7B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x65,0xC5,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x04,0xBD,0xFF,0x00,0x00,0xFF,0x84,0x5A,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x81,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC3,0x39,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0x48,0xE6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0xF5,0x60,0x08,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x25,0xE6,0xFF,0x64,0xA4,0xFF,0xE2,0x6A,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x01,0x21,0xFF,0x64,0xA4,0xFF,0xE4,0xB4,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xE3,0x93,0xFF,0x00,0x00,0xFF,0x86,0x7B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xAA,0xC5,0xFF,0xA8,0xA4,0xFF,0x01,0x21,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x25,0x6B,0xFF,0xA8,0xA4,0xFF,0x4B,0xDE,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0x60,0x08,0xFF,0x00,0x00,0xF6,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0xFF,0x61,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x02,0x73,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0A,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0x81,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0x17,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0xFF,0x61,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x02,0x6B,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0A,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0x81,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0xF5,0x80,0x10,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xA5,0xD5,0xFF,0x80,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xE3,0x93,0xFF,0x00,0x00,0xFF,0xA6,0x7B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x66,0x7B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0x88,0x9C,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0x80,0x10,0xFF,0x00,0x00,0xF6,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x00,0x00,0xFF,0x46,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xE5,0xDD,0xFF,0x41,0x31,0xFF,0xE0,0x20,0xFF,0xE0,0x20,0xFF,0xE0,0x20,0xFF,0x80,0x10,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x20,0x08,0xFF,0xE0,0x20,0xFF,0xE0,0x20,0xFF,0xE0,0x20,0xFF,0xE0,0x20,0xFF,0x62,0x5A,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xC4,0xB4,0xFF,0x00,0x00,0xFF,0xC5,0x62,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE6,0x8B,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0x20,0x08,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA1,0x10,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0xE1,0x20,0xFF,0x01,0x21,0xFF,0x09,0xB5,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xA8,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0x00,0x00,0xFF,0x66,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x84,0xAC,0xFF,0x00,0x00,0xFF,0x05,0x6B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xC8,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0xFA,0xA0,0x18,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xC3,0x8B,0xFF,0x00,0x00,0xFF,0xE7,0x8B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0xC1,0x18,0xFF,0x00,0x00,0xFA,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0xFF,0x41,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x25,0xE6,0xFF,0x23,0x9C,0xFF,0xA2,0x62,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0xE0,0x20,0xFF,0xE3,0x93,0xFF,0x84,0xA4,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x23,0x73,0xFF,0x00,0x00,0xFF,0x88,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x89,0xC5,0xFF,0x47,0x94,0xFF,0xE1,0x20,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xC5,0x62,0xFF,0x47,0x94,0xFF,0x0A,0xD6,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0A,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0x61,0x31,0xFF,0x00,0x00,0xFF,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0xFA,0xC0,0x18,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x63,0x7B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x65,0xCD,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xC3,0x8B,0xFF,0x00,0x00,0xFF,0xE7,0x8B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x81,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE3,0x41,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x09,0xF7,0xFF,0xE8,0xF6,0xFF,0xE8,0xF6,0xFF,0xC1,0x18,0xFF,0x00,0x00,0xFA,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0x00,0x00,0xFF,0x86,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xE5,0xDD,0xFF,0x83,0x83,0xFF,0x42,0x52,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0xC0,0x18,0xFF,0x83,0x83,0xFF,0x23,0x9C,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x84,0xAC,0xFF,0x00,0x00,0xFF,0x05,0x6B,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x08,0xAD,0xFF,0xC6,0x83,0xFF,0xE1,0x18,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0x84,0x5A,0xFF,0xC6,0x83,0xFF,0xCA,0xCD,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xC8,0xF6,0xFF,0x00,0x00,0xFF,0x00,0x00,0xDD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x00,0x00,0xFF,0x66,0xEE,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x64,0xA4,0xFF,0x00,0x00,0xFF,0x6A,0x4A,0xFF,0x57,0xA5,0xFF,0xD4,0x94,0xFF,0x00,0x00,0xFF,0x81,0x31,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0x86,0xF6,0xFF,0xA4,0xAC,0xFF,0x00,0x00,0xFF,0xE5,0x62,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xA2,0x39,0xFF,0x00,0x00,0xFF,0xD4,0x94,0xFF,0x57,0xA5,0xFF,0x6A,0x4A,0xFF,0x00,0x00,0xFF,0xA8,0xA4,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0x0C,0xF7,0xFF,0xE9,0xF6,0xFF,0xE8,0xF6,0xFF,0xA8,0xEE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0xF7,0x60,0x08,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x83,0x83,0xFF,0x00,0x00,0xFF,0xE8,0x39,0xFF,0x52,0x84,0xFF,0xD0,0x73,0xFF,0x00,0x00,0xFF,0x21,0x29,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x45,0xC5,0xFF,0x03,0x73,0xFF,0x00,0x00,0xFF,0xE5,0x62,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0x42,0x29,0xFF,0x00,0x00,0xFF,0xD0,0x73,0xFF,0x52,0x84,0xFF,0xE8,0x39,0xFF,0x00,0x00,0xFF,0xC6,0x83,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0xAA,0xC5,0xFF,0x87,0xC5,0xFF,0x87,0xC5,0xFF,0x87,0xC5,0xFF,0x60,0x08,0xFF,0x00,0x00,0xF8,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x00,0x00,0xB2,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFE,0x00,0x00,0xB0,0x00,0x00,0x10,
-    0x00,0x00,0x9F,0x00,0x00,0xFF,0xC2,0x08,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0x84,0x19,0xFF,0xC2,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0x9D,
-    0x00,0x00,0xED,0x40,0x00,0xFF,0xCF,0x6D,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0xCF,0x6D,0xFF,0x40,0x00,0xFF,0x00,0x00,0xEC,
-    0x00,0x00,0xFF,0xC2,0x08,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0xC2,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0xC2,0x08,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0xC2,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0xC2,0x08,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0xC2,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0xC2,0x08,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0x0F,0x6E,0xFF,0xC2,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x61,0x08,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0xA9,0x43,0xFF,0x61,0x08,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xF3,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF3,
-    0x00,0x00,0x46,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x3F,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x08,0x61,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xE9,0x8C,0x2A,0x18,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x83,0xE8,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xC5,0xAC,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x8C,0x29,0x00,0x00,0x10,0x82,0x63,0x2D,0x63,0x2D,0x10,0x82,0x00,0x00,0x8C,0x29,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x49,0x94,0x47,0x94,0x47,0x83,0xC6,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x9C,0xAA,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xDE,0x6E,0xBD,0x8C,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xBD,0x8C,0xD6,0x2D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x2F,0xF7,0x0C,0xF7,0x0C,0x9C,0x88,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x61,0x00,0x00,0x9C,0x6A,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xCD,0xED,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x09,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2F,0xF7,0x0C,0xF7,0x0C,0x94,0x47,0x00,0x00,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xEF,0x52,0x85,0x39,0xC4,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x39,0xC4,0x4A,0x45,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xB5,0x09,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xDE,0x6E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xDE,0x4B,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xEF,0x0F,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2D,0xF7,0x0C,0xEE,0xCC,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xD6,0x2D,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0x8C,0x29,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x5A,0xA6,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x5A,0xA6,0x62,0xE6,0x62,0xE6,0x62,0xE6,0x73,0x47,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xD6,0x0A,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0xB5,0x2B,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x30,0x10,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0xED,0xFF,0x50,0xFF,0x30,0xF7,0x0C,0xF7,0x0C,0xB5,0x09,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0xA4,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xDE,0x4E,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xAD,0x0B,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xAD,0x0B,0xB5,0x4C,0xB5,0x4C,0xB5,0x4C,0xCE,0x0D,0xFF,0x50,0xFF,0x50,0xFF,0x2F,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0xC5,0xAC,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0C,0xF7,0x0C,0xC5,0x8A,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xE6,0x8E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x0F,0xDE,0x6E,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xDE,0x6E,0xEE,0xEF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2C,0xF7,0x0C,0xE6,0x6B,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xDE,0x6E,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xD6,0x2E,0x08,0x60,0x00,0x00,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xAA,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xF7,0x2C,0xF7,0x0C,0xDE,0x2B,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xE6,0xAF,0x39,0xC4,0x29,0x63,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0x29,0x63,0x31,0xA3,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x30,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0xAC,0xEB,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x2F,0xF7,0x0C,0xF7,0x0C,0xA4,0xC8,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0xBD,0x8C,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xEE,0xCF,0x00,0x00,0x18,0xE4,0xA5,0x57,0xA5,0x57,0x18,0xE4,0x00,0x00,0xEE,0xCF,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x30,0xF7,0x0C,0xF7,0x0C,0xBD,0x69,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x20,0x00,0x20,0x10,0xA3,0x10,0xA3,0x08,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x29,0x22,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x29,0x63,0x00,0x00,0x00,0x20,0x21,0x04,0x21,0x04,0x00,0x20,0x00,0x00,0x29,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x63,0x31,0x62,0x31,0x62,0x29,0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0x08,0x40,0xB4,0xE5,0xD5,0xC5,0x4A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x20,0xE0,0xEE,0x66,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0x9C,0x23,0x00,0x00,0x42,0x49,0x95,0x15,0x8C,0x93,0x00,0x00,0x31,0x61,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0xE6,0x25,0x73,0x23,0x00,0x00,0x8B,0xE6,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0x31,0x82,0x00,0x00,0x8C,0x93,0x95,0x15,0x42,0x49,0x00,0x00,0x9C,0x67,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0xAB,0xE6,0x89,0xE6,0x68,0xE6,0x68,0x20,0xE1,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0xEE,0x66,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x6B,0x05,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xEE,0xC8,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xDD,0xE5,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xD5,0xC5,0x7B,0x43,0x4A,0x01,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x18,0xA0,0x73,0x02,0x8B,0xA3,0xEE,0x66,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xC5,0x45,0x00,0x00,0x52,0x64,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xAC,0xC8,0x73,0x45,0x18,0xC1,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x4A,0x23,0x73,0x46,0xBD,0x69,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xDE,0x27,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xDE,0x05,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x7B,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x65,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xBD,0x04,0x00,0x00,0x5A,0x84,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x10,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC3,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xE6,0x48,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x08,0x60,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xE6,0x25,0xA4,0x64,0x6A,0xE2,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x21,0x01,0xA4,0x64,0xB4,0xE4,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x93,0xE3,0x00,0x00,0x7B,0x86,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xC5,0xAA,0xA4,0xA8,0x21,0x01,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x6B,0x25,0xA4,0xA8,0xDE,0x4B,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x09,0xF6,0xE8,0xF6,0xE8,0x08,0x60,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x31,0x61,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x73,0x02,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0A,0xF6,0xE8,0xF6,0xE8,0x31,0x81,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA2,0x00,0x00,0x31,0x61,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x6B,0x02,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0A,0xF6,0xE8,0xF6,0xE8,0x31,0x81,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x10,0x80,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xD5,0xA5,0x10,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0x93,0xE3,0x00,0x00,0x7B,0xA6,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x7B,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x9C,0x88,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xF6,0xE8,0x10,0x80,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xEE,0x46,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xDD,0xE5,0x31,0x41,0x20,0xE0,0x20,0xE0,0x20,0xE0,0x10,0x80,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x08,0x20,0x20,0xE0,0x20,0xE0,0x20,0xE0,0x20,0xE0,0x5A,0x62,0xF6,0x86,0xF6,0x86,0xB4,0xC4,0x00,0x00,0x62,0xC5,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x8B,0xE6,0x20,0xE1,0x20,0xE1,0x20,0xE1,0x20,0xE1,0x08,0x20,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x10,0xA1,0x20,0xE1,0x20,0xE1,0x20,0xE1,0x21,0x01,0xB5,0x09,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xEE,0xA8,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0xEE,0x66,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xAC,0x84,0x00,0x00,0x6B,0x05,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xEE,0xC8,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x18,0xA0,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x8B,0xC3,0x00,0x00,0x8B,0xE7,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x09,0xF6,0xE8,0xF6,0xE8,0x18,0xC1,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x31,0x41,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xE6,0x25,0x9C,0x23,0x62,0xA2,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x20,0xE0,0x93,0xE3,0xA4,0x84,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x73,0x23,0x00,0x00,0xA4,0x88,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xC5,0x89,0x94,0x47,0x20,0xE1,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x62,0xC5,0x94,0x47,0xD6,0x0A,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0A,0xF6,0xE8,0xF6,0xE8,0x31,0x61,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x18,0xC0,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x7B,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x65,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0x8B,0xC3,0x00,0x00,0x8B,0xE7,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x10,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE3,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x09,0xF6,0xE8,0xF6,0xE8,0x18,0xC1,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0xEE,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xDD,0xE5,0x83,0x83,0x52,0x42,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x18,0xC0,0x83,0x83,0x9C,0x23,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xAC,0x84,0x00,0x00,0x6B,0x05,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xAD,0x08,0x83,0xC6,0x18,0xE1,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0x5A,0x84,0x83,0xC6,0xCD,0xCA,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xF6,0xC8,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0xEE,0x66,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xA4,0x64,0x00,0x00,0x4A,0x6A,0xA5,0x57,0x94,0xD4,0x00,0x00,0x31,0x81,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xF6,0x86,0xAC,0xA4,0x00,0x00,0x62,0xE5,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0x39,0xA2,0x00,0x00,0x94,0xD4,0xA5,0x57,0x4A,0x6A,0x00,0x00,0xA4,0xA8,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF7,0x0C,0xF6,0xE9,0xF6,0xE8,0xEE,0xA8,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x08,0x60,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0x83,0x83,0x00,0x00,0x39,0xE8,0x84,0x52,0x73,0xD0,0x00,0x00,0x29,0x21,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0xC5,0x45,0x73,0x03,0x00,0x00,0x62,0xE5,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x29,0x42,0x00,0x00,0x73,0xD0,0x84,0x52,0x39,0xE8,0x00,0x00,0x83,0xC6,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0x87,0xC5,0x87,0xC5,0x87,0x08,0x60,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0xA3,
+    0x08,0x41,0x00,0x00,0x08,0xC2,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x19,0x84,0x08,0xC2,0x00,0x00,0x08,0x41,
+    0x00,0x00,0x00,0x40,0x6D,0xCF,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6D,0xCF,0x00,0x40,0x00,0x00,
+    0x00,0x00,0x08,0xC2,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x08,0xC2,0x00,0x00,
+    0x00,0x00,0x08,0xC2,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x08,0xC2,0x00,0x00,
+    0x00,0x00,0x08,0xC2,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x08,0xC2,0x00,0x00,
+    0x00,0x00,0x08,0xC2,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x6E,0x0F,0x08,0xC2,0x00,0x00,
+    0x00,0x00,0x08,0x61,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x43,0xA9,0x08,0x61,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x82,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x10,0x82,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
 };
+#endif
 const lv_img_dsc_t ui_img_hay_png = {
     .header.always_zero = 0,
     .header.w = 64,
     .header.h = 64,
     .data_size = sizeof(ui_img_hay_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_hay_png_data
 };
 
+#endif // UI_ASSETS_PARTITION
@@ -1,88 +1,161 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
+// This file was generated by tools/img_convert.py from a SquareLine Studio asset
 // LVGL version: 8.3.6
 // Project name: BaleCounter
 
 #include "ui.h"
 
+// With UI_ASSETS_PARTITION the image is read from the assets partition instead
+// (tools/pack_assets.py), so it is left out of the app
+#ifndef UI_ASSETS_PARTITION
+
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-// IMAGE DATA: assets/hay_time.png
+// IMAGE DATA: assets/hay_time.png (alpha pre-blended onto 0x15171A, RGB332 for the 8-bit render mode)
+#if LV_COLOR_DEPTH == 8
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_time_png_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4D,0x75,0x75,0x75,0x75,0x75,0x4D,0x00,0x28,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x28,0x00,0x4D,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x04,0x00,0x51,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x71,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x76,0x76,0x76,0x76,0x76,0x76,0x71,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x4D,0x00,0x29,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x28,0x00,0x4D,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x04,0x00,0x00,0x51,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x75,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x71,0x00,0x00,0x00,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x4D,0x28,0x75,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x75,0x4D,0x28,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x71,0x29,0x29,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xFF,0xFF,0xFF,0x24,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x6D,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x92,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x49,0xFF,0xFF,0xFF,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x92,0x92,0x24,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x6E,0x92,0x49,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x6D,0x92,0x6D,0x00,0x49,0xFF,0xFF,0xFF,0x6D,0x00,0x49,0x92,0x6D,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x6D,0x6D,0x24,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x6D,0x6D,0x49,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x49,0x6D,0x49,0x00,0x49,0xFF,0xFF,0xFF,0x6D,0x00,0x49,0x6D,0x6D,0x00,0x00,0xDB,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x49,0xFF,0xFF,0xFF,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x24,0x24,0x24,0x24,0x24,0xDB,0xFF,0xFF,0xFF,0x6D,0x24,0x24,0x24,0x24,0x24,0xB6,0xFF,0xFF,0xFF,0x92,0x24,0x24,0x24,0x24,0x24,0x92,0xFF,0xFF,0xFF,0xB6,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x24,0x00,0x00,0x00,0x00,0x8D,0xD1,0xD1,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x72,0x00,0x00,0x00,0x00,0x00,0xAD,0xD1,0xD1,0xD1,0xD1,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x69,0xD1,0xD1,0xD1,0xD1,0xD1,0x24,0x69,0xD1,0xD1,0xD1,0xD1,0xD1,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x92,0x92,0x92,0x92,0x92,0xFF,0xFF,0xFF,0xFF,0xB6,0x92,0x92,0x92,0x92,0x92,0xDB,0xFF,0xFF,0xFF,0xDB,0x92,0x92,0x92,0x92,0x92,0x6D,0x00,0x00,0x8D,0xD1,0xB1,0xD1,0xD1,0xD1,0xB1,0x00,0x44,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xD1,0x24,0x00,0xB1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0x8D,0x24,0xB1,0xD1,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x49,0x49,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x24,0x49,0x24,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x24,0x49,0x24,0x00,0x00,0x8D,0xD1,0xD1,0x8D,0x48,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0x69,0x00,0x8D,0xD1,0xD1,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x92,0x92,0x24,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x6E,0x92,0x49,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x6D,0x8E,0x24,0x00,0x00,0x69,0x8D,0x8D,0x8D,0xAD,0xAD,0xAD,0xB1,0xB1,0xB1,0xB1,0xB1,0xB1,0xAD,0xAD,0x8D,0x8D,0x8D,0x8D,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x49,0x49,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x49,0x49,0x24,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x8C,0x6C,0x68,0x68,0x48,0x44,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x44,0x48,0x68,0x68,0x6C,0x8C,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x92,0x92,0x92,0x92,0x92,0xFF,0xFF,0xFF,0xFF,0xB6,0x92,0x92,0x92,0x92,0x92,0xDB,0xFF,0xFF,0xFF,0xDB,0x92,0x92,0x24,0x00,0xD0,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x24,0x00,0xD0,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x8C,0xB0,0xB0,0xD0,0xD4,0xD4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF8,0xF8,0xF4,0xF4,0xF4,0xF4,0xF4,0xD4,0xD4,0xD0,0xB0,0xB0,0x8C,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x24,0x24,0x24,0x24,0x29,0xDB,0xFF,0xFF,0xFF,0x6D,0x24,0x24,0x24,0x24,0x24,0xB6,0xFF,0xFF,0xFF,0x92,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0x44,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x6D,0x6D,0x24,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x6D,0x6D,0x45,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x49,0x6D,0x24,0x00,0x68,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x92,0x92,0x24,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x6E,0x92,0x49,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x6D,0x92,0x24,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0x49,0x00,0x00,0x00,0x00,0x00,0xB1,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xB1,0x6C,0x68,0x8C,0xD5,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xFF,0xFF,0xFF,0x24,0x00,0x00,0x00,0x00,0x00,0x92,0xFF,0xFF,0xFF,0x4D,0x00,0x00,0x00,0x00,0x00,0xB1,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xD5,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0xDB,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDB,0xDB,0x24,0x00,0x91,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x44,0x00,0x00,0x48,0x71,0x91,0x48,0x00,0x00,0x68,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0x68,0x00,0x24,0x96,0x95,0x95,0x76,0x24,0x00,0x44,0xF5,0xF9,0xF9,0xF9,0xF9,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x00,0x68,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x96,0x91,0x00,0x00,0x95,0x00,0x20,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x49,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0x49,0x00,0x48,0xF9,0xF9,0xF9,0xF9,0xB1,0x00,0x4D,0x95,0x00,0x00,0x91,0x91,0x00,0x68,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xF9,0xF9,0xF9,0xF9,0xB0,0x00,0x48,0x00,0x00,0x95,0x76,0x6D,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x49,0x25,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x24,0xF9,0xF9,0xF9,0xF9,0xD5,0x00,0x00,0x00,0x6D,0x76,0x95,0x00,0x00,0xF5,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0x92,0x00,0x20,0xF9,0xF9,0xF9,0xF9,0xF9,0x44,0x00,0x00,0x48,0x48,0x00,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x49,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x6D,0x00,0x00,0xF9,0xF9,0xF9,0xF9,0xF9,0x44,0x00,0x00,0x00,0x00,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xF9,0xF9,0xF9,0xF9,0x00,0x00,0xD5,0xB1,0xB1,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xF9,0xF9,0xF9,0xF9,0xF9,0xB0,0xB1,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x24,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF5,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+#else
+// IMAGE DATA: assets/hay_time.png (alpha pre-blended onto 0x15171A)
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_hay_time_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x52,0x00,0x00,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x00,0x00,0x52,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x3C,0x00,0x00,0x4D,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x00,0x00,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA0,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9B,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFB,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0xC4,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xEF,0x00,0x00,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0xFB,0x00,0x00,0xFB,0x00,0x00,0xAF,0x00,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x00,0xFF,0x00,0x00,0xF1,0x00,0x00,0xAF,0x00,0x00,0xFB,0x00,0x00,0xFB,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x00,0xFF,0x00,0x00,0xE0,0x00,0x00,0xBB,0x00,0x00,0xFF,0x00,0x00,0xE8,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x00,0x00,0xFF,0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,0x6F,0x00,0x00,0xFF,0x00,0x00,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x00,0x00,0xFF,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0xA4,0x00,0x00,0xFF,0x00,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0x00,0xFF,0x00,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0xD9,0x00,0x00,0xFF,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x00,0xFF,0x00,0x00,0x9C,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x00,0xFF,0x00,0x00,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x97,0x00,0x00,0xFF,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x96,0x00,0x00,0xFF,0x00,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x00,0x00,0xFF,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0xCB,0x00,0x00,0xFF,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0xAE,0x00,0x00,0xD9,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xEA,0x00,0x00,0xFF,0x00,0x00,0xF2,0x00,0x00,0xDD,0x00,0x00,0xEA,0x00,0x00,0xFF,0x00,0x00,0xF2,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xF1,0x00,0x00,0xFF,0x00,0x00,0xEB,0x00,0x00,0xDD,0x00,0x00,0xF1,0x00,0x00,0xFF,0x00,0x00,0xEB,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xF8,0x00,0x00,0xFF,0x00,0x00,0xE4,0x00,0x00,0xDD,0x00,0x00,0xF8,0x00,0x00,0xFF,0x00,0x00,0xE4,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xDD,0x00,0x00,0xD4,0x00,0x00,0xA2,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x00,0xFD,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF4,0x00,0x00,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x00,0x00,0xFF,0xCB,0x53,0xBF,0xB1,0x7D,0xDF,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0x0C,0x5C,0xC0,0x00,0x00,0xFF,0x87,0x32,0xC6,0xB1,0x7D,0xE3,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xA8,0x3A,0xC5,0x00,0x00,0xFF,0x0C,0x54,0xBF,0xB1,0x7D,0xE3,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0x23,0x19,0xDA,0x00,0x00,0xFF,0x0F,0x6D,0xC8,0xB1,0x7D,0xE3,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0xB1,0x7D,0xE2,0x91,0x75,0xDB,0x87,0x32,0xC6,0x00,0x00,0xFF,0x00,0x00,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0xFF,0xA2,0x08,0xE7,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x50,0x75,0xCF,0x00,0x00,0xFF,0x64,0x19,0xE2,0x90,0x6D,0xF7,0x90,0x6D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x2C,0x5C,0xC0,0x00,0x00,0xFF,0x09,0x3B,0xD7,0x90,0x6D,0xFB,0x90,0x6D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x87,0x32,0xC6,0x00,0x00,0xFF,0x6D,0x54,0xD8,0x90,0x6D,0xFD,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xED,0x00,0x00,0xFF,0x00,0x00,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x03,0x11,0xDD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x44,0x19,0xD7,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEE,0x64,0xE0,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xE8,0x61,0x08,0xEF,0x00,0x00,0xFF,0x00,0x00,0xFE,0x70,0x6D,0xF1,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x70,0x75,0xD0,0x00,0x00,0xFD,0x00,0x00,0xFF,0x61,0x08,0xF6,0x70,0x6D,0xFD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x03,0x11,0xDD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xEF,0x4D,0x54,0xDA,0x46,0x2A,0xDE,0x70,0x6D,0xEF,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x91,0x75,0xE5,0xCB,0x4B,0xD9,0x67,0x32,0xDE,0x70,0x6D,0xFA,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x50,0x6D,0xDE,0x29,0x43,0xD9,0xE8,0x3A,0xDB,0x90,0x6D,0xFE,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x03,0x11,0xDD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xB1,0x75,0xFF,0x90,0x6D,0xFF,0xB0,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xB0,0x75,0xFF,0x90,0x6D,0xFF,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0x90,0x75,0xFF,0x90,0x6D,0xFF,0xB1,0x75,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x03,0x11,0xDD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x03,0x11,0xDD,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFF,0xD1,0x7D,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x41,0x00,0xF2,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x87,0x32,0xC6,0x67,0x32,0xC7,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0xE3,0x18,0xE7,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x79,0xCE,0xC6,0x59,0xCE,0xC5,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF4,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x7D,0xEF,0xEB,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF9,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x7D,0xEF,0xE6,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFC,0x5D,0xE7,0xE3,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xEF,0xE4,0x7E,0xEF,0xFD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xE5,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x7E,0xEF,0xFA,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF8,0xA2,0x10,0xEB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFD,0xDB,0xDE,0xCF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x08,0x42,0xD2,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD7,0xB5,0xC1,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xEF,0x7B,0xC2,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x10,0x84,0xC1,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x96,0xB5,0xC0,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x49,0x42,0xD0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x00,0x00,0xFC,0x82,0x10,0xE1,0x82,0x10,0xE1,0x20,0x00,0xF3,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0x82,0x10,0xE3,0x82,0x10,0xE1,0x41,0x08,0xED,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0x61,0x08,0xE8,0x82,0x10,0xE1,0x61,0x08,0xE8,0x00,0x00,0xFF,0x8A,0x52,0xCD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x30,0x84,0xC1,0x00,0x00,0xFF,0x41,0x08,0xEC,0x82,0x10,0xE1,0x82,0x10,0xE3,0x00,0x00,0xFF,0xC3,0x18,0xE8,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x61,0x08,0xEC,0x11,0x8C,0xFF,0x11,0x8C,0xFF,0x08,0x42,0xC2,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xF1,0x8B,0xEC,0x11,0x8C,0xFF,0xEC,0x62,0xC1,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0xAF,0x7B,0xCF,0x11,0x8C,0xFF,0xAF,0x7B,0xCD,0x00,0x00,0xFF,0x8A,0x52,0xCD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x30,0x84,0xC1,0x00,0x00,0xFF,0x0D,0x6B,0xC1,0x11,0x8C,0xFF,0xF1,0x8B,0xE9,0x00,0x00,0xFF,0xC3,0x18,0xE8,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x41,0x08,0xEF,0xD0,0x83,0xDD,0xD0,0x83,0xDD,0xA7,0x39,0xC9,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xAF,0x7B,0xD2,0xD0,0x83,0xDD,0x6A,0x52,0xC2,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0x2D,0x6B,0xC5,0xD0,0x83,0xDD,0x2D,0x6B,0xC4,0x00,0x00,0xFF,0x8A,0x52,0xCD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x30,0x84,0xC1,0x00,0x00,0xFF,0x8A,0x52,0xC1,0xD0,0x83,0xDD,0xAF,0x7B,0xD0,0x00,0x00,0xFF,0xA2,0x10,0xEC,0x5D,0xE7,0xE3,0x7E,0xEF,0xFA,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xED,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xC3,0x10,0xEA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8A,0x52,0xCC,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x30,0x84,0xC1,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x82,0x10,0xED,0xD3,0x9C,0xBF,0x7E,0xEF,0xF7,0x7E,0xEF,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFD,0x4D,0x6B,0xC5,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0x28,0x42,0xD1,0x5D,0xE7,0xE0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xB2,0x94,0xBF,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xE7,0x39,0xD4,0xFB,0xDE,0xCF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xF8,0xBD,0xC2,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0x18,0xC6,0xC3,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xDB,0xD6,0xCD,0xA6,0x31,0xD7,0x04,0x21,0xE2,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x10,0xEC,0x81,0x18,0xE6,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE8,0x39,0xD3,0x5D,0xEF,0xE4,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xBB,0xD6,0xCC,0x28,0x42,0xD1,0x20,0x00,0xFA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x61,0x10,0xEE,0x2C,0xB4,0xC8,0xCE,0xCC,0xFE,0xCE,0xCC,0xFF,0x8D,0xC4,0xD3,0xA2,0x18,0xE2,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFD,0x00,0x00,0x63,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x14,0xA5,0xBF,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0xFC,0x20,0x00,0xF7,0x20,0x08,0xF4,0x6D,0xBC,0xD0,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xAE,0xCC,0xE2,0x81,0x18,0xE7,0x20,0x00,0xF9,0x20,0x00,0xF9,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xA8,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x59,0xCE,0xC6,0x00,0x00,0xFF,0x00,0x00,0xFB,0x6A,0x93,0xC0,0xCE,0xCC,0xF5,0xCE,0xCC,0xFE,0xCE,0xCC,0xF9,0xCE,0xCC,0xFF,0xCE,0xCC,0xF7,0xA5,0x49,0xCB,0x4A,0x8B,0xBF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFD,0xCE,0xCC,0xFB,0xCE,0xCC,0xFB,0xEC,0xAB,0xC5,0x40,0x08,0xF2,0x00,0x00,0xFF,0x00,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xBA,0xD6,0xC9,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0xD7,0xB5,0xC1,0x7E,0xEF,0xF8,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x1C,0xDF,0xD3,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x96,0xAD,0xC0,0x7D,0xEF,0xED,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x5D,0xE7,0xDE,0x55,0xAD,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x75,0xAD,0xC0,0x72,0x8C,0xC0,0x20,0x00,0xFA,0x00,0x00,0xFF,0xCB,0xA3,0xC2,0xCE,0xCC,0xEF,0xAE,0xCC,0xDF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xAE,0xCC,0xED,0x20,0x08,0xF4,0xC5,0x49,0xC9,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0x6D,0xC4,0xD1,0x00,0x00,0xFC,0x00,0x00,0xFF,0x00,0x00,0xAB,0x00,0x00,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF2,0x00,0x00,0xFD,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x39,0xC6,0xC4,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xE3,0x18,0xE5,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB3,0x94,0xBF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xAA,0x52,0xCB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFC,0xA8,0x72,0xC1,0xCE,0xCC,0xFF,0x84,0x41,0xCE,0x00,0x00,0xFA,0xAE,0xCC,0xEA,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xAE,0xCC,0xEE,0xCE,0xCC,0xF8,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0x4D,0xBC,0xCD,0x64,0x39,0xD1,0xAE,0xCC,0xDD,0xCE,0xCC,0xFF,0x8B,0x9B,0xC0,0x40,0x08,0xF2,0x00,0x00,0xFF,0x00,0x00,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x20,0x00,0xF5,0x6A,0x52,0xBF,0x6A,0x52,0xBF,0xC3,0x18,0xD8,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0x29,0x4A,0xBF,0x6A,0x52,0xBF,0x45,0x29,0xCD,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0xC7,0x39,0xC5,0x8A,0x52,0xC0,0xC7,0x39,0xC6,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2D,0xB4,0xC9,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCB,0xA3,0xC2,0x67,0x62,0xC3,0xCE,0xCC,0xFA,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0x6A,0x93,0xC0,0x00,0x00,0xFF,0x2D,0xB4,0xCA,0xCE,0xCC,0xFF,0xCE,0xCC,0xFF,0xAE,0xCC,0xDD,0x00,0x00,0xFA,0x00,0x00,0xFA,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x61,0x08,0xEC,0x11,0x8C,0xFF,0x11,0x8C,0xFF,0x08,0x42,0xC2,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xF1,0x8B,0xEC,0x11,0x8C,0xFF,0xEC,0x62,0xC1,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0xAF,0x7B,0xCF,0xF1,0x8B,0xEF,0x29,0x4A,0xC1,0x00,0x00,0xFF,0x00,0x00,0xFB,0xAB,0x9B,0xC1,0xEC,0xAB,0xC2,0x0C,0xB4,0xC6,0x4D,0xBC,0xCD,0x6D,0xC4,0xD1,0x8E,0xC4,0xD6,0x8E,0xC4,0xD6,0x8E,0xC4,0xD9,0xAE,0xCC,0xE2,0xAE,0xCC,0xE2,0xAE,0xCC,0xE2,0xAE,0xCC,0xE2,0x8E,0xC4,0xDB,0x8E,0xC4,0xD6,0x8D,0xC4,0xD6,0x0C,0xB4,0xC6,0x4D,0xBC,0xCD,0x2C,0xB4,0xC7,0x0C,0xAC,0xC4,0xCB,0xA3,0xC2,0x81,0x10,0xE8,0x00,0x00,0xFF,0x00,0x00,0x96,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x20,0x00,0xF5,0x8B,0x5A,0xC3,0x8B,0x5A,0xC3,0xE3,0x18,0xD9,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0x6A,0x52,0xC3,0x8B,0x5A,0xC3,0x45,0x29,0xCE,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0xC7,0x39,0xC5,0xC3,0x18,0xDB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xE6,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF1,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x38,0xC6,0xC4,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xE3,0x18,0xE5,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB2,0x94,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xAA,0x52,0xCB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE4,0xA3,0xBF,0xE4,0xA3,0xBF,0x64,0x93,0xC1,0x03,0x7B,0xC3,0xA3,0x6A,0xC6,0x02,0x52,0xCD,0xA1,0x41,0xD3,0x61,0x39,0xD6,0x61,0x39,0xD6,0x61,0x39,0xD6,0xE1,0x28,0xE1,0xE1,0x20,0xE2,0xE1,0x20,0xE2,0xE1,0x20,0xE2,0x41,0x31,0xD9,0x61,0x39,0xD6,0x61,0x39,0xD6,0x61,0x39,0xD5,0x02,0x52,0xCD,0x62,0x62,0xC8,0xE3,0x7A,0xC4,0x43,0x8B,0xC1,0xC4,0x9B,0xC0,0x45,0xB4,0xBF,0x40,0x08,0xF4,0x00,0x00,0xFF,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x9A,0xCE,0xC7,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0xB6,0xB5,0xC0,0x7E,0xEF,0xF6,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xFB,0xDE,0xD0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x75,0xAD,0xC0,0x7D,0xEF,0xEB,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x5D,0xE7,0xDC,0x55,0xA5,0xC0,0x55,0xA5,0xC0,0x45,0x21,0xDF,0x00,0x00,0xFF,0xA6,0xED,0xD0,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xEE,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x08,0x42,0xD3,0x00,0x00,0xFF,0xA6,0xED,0xCF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xED,0x00,0x00,0xFF,0x00,0x00,0xEF,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x61,0x08,0xF2,0x00,0x00,0xFF,0x45,0xB4,0xBF,0x05,0xD5,0xC4,0x46,0xE5,0xC9,0x86,0xED,0xCF,0xC6,0xF5,0xD6,0xE6,0xFD,0xE0,0x07,0xFE,0xE5,0x06,0xFE,0xEF,0x06,0xFE,0xEF,0x06,0xFE,0xEF,0x07,0xFE,0xF9,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xF8,0x06,0xFE,0xEF,0x06,0xFE,0xEF,0x06,0xFE,0xEF,0x07,0xFE,0xE5,0xE6,0xFD,0xE1,0xC6,0xF5,0xD6,0xA6,0xED,0xCF,0x66,0xE5,0xC9,0x25,0xD5,0xC5,0xC5,0xC4,0xC1,0x40,0x08,0xF4,0x00,0x00,0xFF,0x00,0x00,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xCB,0x5A,0xCA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xDB,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFE,0x8E,0x73,0xC4,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0x49,0x4A,0xCF,0x5D,0xE7,0xE2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xF4,0x9C,0xBF,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0xC7,0x39,0xD6,0x08,0x42,0xD3,0xFC,0xDE,0xD1,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x38,0xC6,0xC3,0xE7,0x39,0xD5,0xC7,0x39,0xD6,0x65,0x29,0xDD,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xE1,0xA1,0x18,0xCB,0x60,0x10,0xD0,0x40,0x08,0xD6,0x20,0x00,0xE1,0x00,0x00,0xE8,0x00,0x00,0xEF,0x00,0x00,0xEF,0x00,0x00,0xEF,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFB,0x00,0x00,0xEF,0x00,0x00,0xEF,0x00,0x00,0xEF,0x00,0x00,0xE8,0x20,0x00,0xE0,0x40,0x08,0xD6,0x60,0x10,0xD0,0xA1,0x18,0xCF,0x80,0x10,0xDF,0x00,0x00,0xFF,0x00,0x00,0xBF,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xED,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x18,0xBE,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xC3,0x10,0xEA,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x71,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x69,0x4A,0xCE,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x44,0x5A,0xBF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0x07,0xA4,0xED,0x00,0x00,0xFF,0x00,0x00,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x41,0x08,0xEF,0xD0,0x83,0xD5,0xD0,0x83,0xD5,0x86,0x31,0xC8,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xAF,0x7B,0xCC,0xD0,0x83,0xD5,0x6A,0x52,0xBF,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0x2D,0x6B,0xC2,0xD0,0x83,0xD6,0x25,0x29,0xD0,0x00,0x00,0xFF,0xA6,0x8B,0xC6,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xE9,0xCC,0xF8,0x00,0x00,0xFF,0x00,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x61,0x08,0xEC,0x11,0x8C,0xFF,0x11,0x8C,0xFF,0x08,0x42,0xC2,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xF1,0x8B,0xEC,0x11,0x8C,0xFF,0xEC,0x62,0xC1,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0xAF,0x7B,0xCF,0x11,0x8C,0xFF,0x25,0x29,0xD1,0x00,0x00,0xFF,0xA8,0xB4,0xD1,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8A,0xE5,0xFD,0x00,0x00,0xFF,0x00,0x00,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7D,0xEF,0xEC,0x00,0x00,0xFF,0x00,0x00,0xFC,0xA3,0x18,0xE2,0xA3,0x18,0xE2,0x41,0x08,0xF3,0x00,0x00,0xFF,0xF8,0xBD,0xC2,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xA2,0x10,0xEB,0x00,0x00,0xFF,0xA2,0x10,0xE4,0xA3,0x18,0xE2,0x61,0x08,0xEE,0x00,0x00,0xFF,0x51,0x8C,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x49,0x4A,0xCF,0x00,0x00,0xFF,0x61,0x08,0xE8,0x82,0x10,0xE2,0x20,0x00,0xF8,0x00,0x00,0xFF,0xE9,0xC4,0xD6,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x0B,0xEE,0xFF,0x28,0xA4,0xFF,0x05,0x7B,0xFF,0xC5,0x6A,0xFF,0xA7,0x8B,0xFF,0x4A,0xD5,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xCA,0xED,0xFE,0x00,0x00,0xFF,0x00,0x00,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF7,0x82,0x10,0xED,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFE,0xDB,0xD6,0xCD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xE7,0x39,0xD4,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB6,0xB5,0xC0,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0xAF,0x73,0xC3,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x09,0xCD,0xD9,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4C,0xFE,0xFF,0x26,0x7B,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA3,0x41,0xFF,0x8A,0xDD,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x0B,0xF6,0xFE,0x00,0x00,0xFF,0x00,0x00,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF1,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x7D,0xEF,0xE8,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xF6,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xEF,0xE4,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFB,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0x5D,0xE7,0xE2,0xA6,0x31,0xD9,0x00,0x00,0xFF,0xA9,0xBC,0xD2,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4C,0xFE,0xFF,0xA3,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC7,0x52,0xFF,0x8C,0x7C,0xFF,0xCC,0x84,0xFF,0xA6,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE5,0x72,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xAA,0xE5,0xFD,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x65,0x29,0xDD,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x8A,0x52,0xCB,0x00,0x00,0xFF,0x07,0xA4,0xCA,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xE5,0x72,0xFF,0x00,0x00,0xFF,0x22,0x21,0xFF,0xB0,0x8D,0xFF,0x8F,0x8D,0xFF,0x6E,0x8D,0xFF,0xD1,0x7D,0xFF,0xC4,0x31,0xFF,0x00,0x00,0xFF,0xE3,0x49,0xFF,0xEB,0xED,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x49,0xD5,0xFB,0x00,0x00,0xFF,0x00,0x00,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0xA2,0x10,0xEC,0x7E,0xEF,0xFC,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x7E,0xEF,0xFF,0x4D,0x6B,0xC5,0x00,0x00,0xFF,0x66,0x83,0xC4,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xEB,0xED,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0xB0,0x8D,0xFF,0xED,0x84,0xFF,0x00,0x00,0xFF,0x40,0x00,0xFF,0x8F,0x8D,0xFF,0x00,0x00,0xFF,0xE1,0x20,0xFF,0x6C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0xC9,0xC4,0xF7,0x00,0x00,0xFF,0x00,0x00,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6E,0x6B,0xC4,0xBB,0xD6,0xCB,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xDB,0xD6,0xCD,0xCB,0x52,0xCA,0x00,0x00,0xFF,0xC5,0x6A,0xC0,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x28,0xA4,0xFF,0x00,0x00,0xFF,0x48,0x5B,0xFF,0x0D,0x85,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCD,0x84,0xFF,0xCD,0x84,0xFF,0x00,0x00,0xFF,0xC5,0x6A,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0x68,0xB4,0xF2,0x00,0x00,0xFF,0x00,0x00,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x24,0x52,0xBF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x07,0xA4,0xFF,0x00,0x00,0xFF,0x66,0x42,0xFF,0x40,0x08,0xFF,0x00,0x00,0xFF,0x0D,0x85,0xFF,0xD1,0x7D,0xFF,0x48,0x63,0xFF,0x00,0x00,0xFF,0xE7,0x9B,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0xE7,0x9B,0xEC,0x00,0x00,0xFF,0x00,0x00,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0xFF,0xA2,0x10,0xE8,0xAE,0x73,0xC1,0x29,0x42,0xCC,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x28,0x42,0xCD,0x25,0x21,0xDC,0x00,0x00,0xFF,0x62,0x39,0xC1,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x09,0xC5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x73,0xFF,0xD1,0x7D,0xFF,0x6F,0x8D,0xFF,0x20,0x00,0xFF,0x20,0x08,0xFF,0xEB,0xED,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4C,0xFE,0xFF,0x46,0x83,0xE4,0x00,0x00,0xFF,0x00,0x00,0x9B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0xFF,0x82,0x10,0xED,0x9A,0xD6,0xFA,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x9A,0xD6,0xFF,0x96,0xB5,0xC5,0x00,0x00,0xFF,0xE1,0x20,0xC6,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xA3,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC7,0x52,0xFF,0x86,0x4A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x66,0x83,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4B,0xFE,0xFF,0xA4,0x6A,0xDF,0x00,0x00,0xFF,0x00,0x00,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x00,0x00,0xFF,0xCB,0x5A,0xC6,0xD7,0xBD,0xC9,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0xF8,0xBD,0xCD,0x72,0x8C,0xBF,0x00,0x00,0xFF,0xC1,0x20,0xC9,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xA3,0x41,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x86,0x8B,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4C,0xFE,0xFF,0x64,0x62,0xDE,0x00,0x00,0xFF,0x00,0x00,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0xF0,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC1,0x20,0xC8,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0x00,0x00,0xFF,0x40,0x08,0xFF,0x4A,0xCD,0xFF,0x68,0xAC,0xFF,0xC9,0xBC,0xFF,0x2B,0xF6,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4B,0xFE,0xFF,0x84,0x62,0xDE,0x00,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x00,0x00,0x83,0x00,0x00,0xB3,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xBB,0x00,0x00,0xE2,0x00,0x00,0xFF,0xC3,0x41,0xC0,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x07,0xA4,0xFF,0xA8,0xB4,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0x66,0x8B,0xE7,0x00,0x00,0xFF,0x00,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0xDE,0x00,0x00,0xFF,0x07,0x9C,0xCA,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x6C,0xFE,0xFF,0x29,0xD5,0xF9,0x00,0x00,0xFC,0x00,0x00,0xF6,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x00,0x00,0xFF,0x40,0x08,0xD6,0x6C,0xFE,0xFE,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x4B,0xFE,0xFF,0xA3,0x41,0xD9,0x00,0x00,0xFF,0x00,0x00,0xCF,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x00,0x00,0xFF,0x4A,0xCD,0xDB,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0x8C,0xFE,0xFF,0xCA,0xED,0xFD,0x00,0x00,0xF4,0x00,0x00,0xFF,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x00,0x00,0xFF,0x60,0x10,0xD3,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x42,0x31,0xC2,0x62,0x39,0xC6,0x01,0x29,0xD9,0x00,0x00,0xFF,0x00,0x00,0xEF,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0xEB,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF6,0x00,0x00,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x4F,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x66,0x00,0x00,0x56,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x08,0x82,0x10,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x08,0x82,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x08,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x62,0x00,0x00,0x00,0x41,0x10,0xA3,0x08,0x61,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x08,0x61,0x10,0xA3,0x00,0x41,0x00,0x00,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x10,0x82,0x10,0xA3,0x00,0x00,0x00,0x00,0x10,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x62,0x00,0x00,0x08,0x41,0x10,0xA3,0x08,0x62,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x41,0x00,0x00,0x08,0x61,0x10,0xA3,0x08,0x41,0x00,0x00,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x10,0x82,0x10,0xA3,0x00,0x20,0x00,0x00,0x10,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x82,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0x43,0x09,0x6D,0x0F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x43,0x4A,0x00,0x00,0x2A,0x06,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x32,0x27,0x00,0x00,0x43,0x29,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x19,0x23,0x00,0x00,0x5C,0x2D,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6D,0x2F,0x6C,0xEF,0x2A,0x26,0x00,0x00,0x00,0x21,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA2,0x00,0x00,0x08,0xA2,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x64,0x6D,0x00,0x00,0x19,0x64,0x6D,0x50,0x6D,0x90,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x43,0x4A,0x00,0x00,0x32,0xA8,0x6D,0x70,0x6D,0x90,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x2A,0x06,0x00,0x00,0x4B,0xCB,0x6D,0x70,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0x70,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x11,0x03,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x19,0x43,0x00,0x00,0x00,0x00,0x5C,0x6D,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0x50,0x08,0x61,0x00,0x00,0x00,0x00,0x65,0x2F,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x64,0x8E,0x00,0x00,0x00,0x00,0x08,0x61,0x6D,0x70,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x11,0x03,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0x70,0x4B,0xCB,0x2A,0x06,0x65,0x0F,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x6D,0x0F,0x43,0x4A,0x2A,0x26,0x6D,0x70,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x64,0xCE,0x3A,0xC8,0x32,0xA8,0x6D,0x70,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x11,0x03,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0xB1,0x6D,0x90,0x75,0xB0,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0xB0,0x6D,0x90,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x75,0x90,0x6D,0x90,0x75,0xB1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x11,0x03,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x11,0x03,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xD1,0x7D,0xB1,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x08,0x61,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x2A,0x06,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x18,0xE3,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x14,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x3C,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xDE,0xFB,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x5D,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xD6,0xBB,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7D,0xD6,0xBA,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xD6,0xBA,0xEF,0x7D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xD6,0xBB,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xEF,0x5D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x5D,0x10,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xB7,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x39,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x63,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x4D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x8C,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x00,0x00,0x10,0x82,0x10,0x82,0x00,0x20,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x10,0x82,0x10,0x82,0x08,0x41,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x08,0x61,0x10,0x82,0x08,0x61,0x00,0x00,0x42,0x28,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x6B,0x4D,0x00,0x00,0x08,0x41,0x10,0x82,0x10,0x82,0x00,0x00,0x18,0xC3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x08,0x61,0x8C,0x11,0x8C,0x11,0x39,0xC7,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x7B,0xB0,0x8C,0x11,0x52,0x6A,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x6B,0x2D,0x8C,0x11,0x6B,0x0D,0x00,0x00,0x42,0x28,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x6B,0x4D,0x00,0x00,0x52,0x8A,0x8C,0x11,0x7B,0xAF,0x00,0x00,0x18,0xC3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x08,0x41,0x73,0x6E,0x73,0x6E,0x31,0x66,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x6B,0x2D,0x73,0x6E,0x42,0x08,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x5A,0xAB,0x73,0x6E,0x5A,0x8B,0x00,0x00,0x42,0x28,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x6B,0x4D,0x00,0x00,0x42,0x09,0x73,0x6E,0x6B,0x0D,0x00,0x00,0x10,0xA2,0xD6,0xBA,0xEF,0x5D,0xEF,0x7E,0xEF,0x7E,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x29,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x6B,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x82,0x73,0xCF,0xE7,0x3D,0xEF,0x5D,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7D,0x52,0xAB,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x39,0xE7,0xCE,0x7A,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x73,0xAF,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0xB5,0xD7,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x94,0xB3,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x9C,0xD3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xB5,0xB6,0x31,0x86,0x21,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x18,0x81,0x00,0x00,0x00,0x00,0x39,0xC7,0xD6,0xBA,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xAD,0x96,0x39,0xE7,0x00,0x20,0x00,0x00,0x00,0x00,0x10,0x61,0x93,0x6A,0xCC,0xAE,0xCC,0xCE,0xA3,0xCC,0x18,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x7C,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0xA3,0xAB,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xB4,0x2D,0x18,0x81,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xA5,0x14,0x00,0x00,0x00,0x00,0x72,0xC8,0xC4,0x8E,0xCC,0xAE,0xCC,0xAE,0xCC,0xCE,0xCC,0xAE,0x39,0x84,0x72,0xA8,0xCC,0xCE,0xCC,0xCE,0xCC,0xAE,0xCC,0xAE,0xCC,0xAE,0x8B,0x2A,0x08,0x40,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xAD,0x75,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x8C,0x92,0xE7,0x5D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xBD,0xF7,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x8C,0x51,0xDE,0xFC,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xCE,0x79,0x84,0x31,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x51,0x6B,0x8E,0x00,0x20,0x00,0x00,0x83,0x09,0xC4,0x8D,0xB4,0x2C,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xBC,0x6D,0x08,0x40,0x41,0x84,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xA3,0xCB,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xF4,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x18,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xAF,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x4A,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0x27,0xCC,0xCE,0x39,0x44,0x00,0x00,0xBC,0x6D,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xC4,0x6D,0xCC,0xAE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0x9B,0x8B,0x31,0x44,0xB4,0x0C,0xCC,0xCE,0x7A,0xC9,0x08,0x40,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x00,0x20,0x42,0x08,0x42,0x08,0x18,0xC3,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x39,0xC7,0x42,0x08,0x21,0x25,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x31,0x86,0x42,0x08,0x31,0x86,0x00,0x00,0x00,0x00,0x93,0x6A,0xCC,0xCE,0xCC,0xCE,0x83,0x09,0x52,0x06,0xCC,0xAE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0xCC,0xCE,0x72,0xC8,0x00,0x00,0x93,0x8B,0xCC,0xCE,0xCC,0xCE,0xB4,0x0C,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x08,0x61,0x8C,0x11,0x8C,0x11,0x39,0xC7,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x7B,0xB0,0x8C,0x11,0x52,0x6A,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x6B,0x0D,0x83,0xD0,0x39,0xC7,0x00,0x00,0x00,0x00,0x7A,0xE9,0x83,0x29,0x8B,0x4A,0x9B,0x8B,0xA3,0xCB,0xAB,0xEC,0xAB,0xEC,0xAC,0x0C,0xB4,0x2D,0xB4,0x2D,0xB4,0x2D,0xB4,0x2D,0xAC,0x0C,0xAB,0xEC,0xA3,0xEC,0x8B,0x4A,0x9B,0x8B,0x93,0x6A,0x8B,0x4A,0x83,0x09,0x10,0x81,0x00,0x00,0x08,0x41,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x00,0x20,0x4A,0x29,0x4A,0x29,0x18,0xE3,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x42,0x08,0x4A,0x29,0x29,0x25,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x31,0x86,0x18,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDF,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xF3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x18,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xAE,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x24,0x7B,0x04,0x72,0xC3,0x62,0x83,0x5A,0x23,0x49,0xC2,0x39,0x62,0x31,0x41,0x31,0x41,0x31,0x41,0x20,0xE1,0x20,0xE1,0x20,0xE1,0x20,0xE1,0x31,0x21,0x31,0x41,0x31,0x41,0x31,0x41,0x49,0xC2,0x52,0x03,0x62,0x63,0x6A,0xA3,0x7B,0x04,0x8B,0x64,0x08,0x40,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xA5,0x35,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x8C,0x71,0xE7,0x3D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xB5,0xD7,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x51,0xDE,0xFB,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xCE,0x59,0x84,0x30,0x84,0x30,0x21,0x24,0x00,0x00,0xC4,0xC5,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xED,0xA6,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x39,0xC7,0x00,0x00,0xC4,0xA5,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xED,0xA6,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x08,0x61,0x00,0x00,0x8B,0x64,0xAC,0x05,0xB4,0x65,0xC4,0xA5,0xCD,0x06,0xDD,0x46,0xE5,0x86,0xED,0xA6,0xED,0xA6,0xED,0xA6,0xFD,0xE6,0xFE,0x07,0xFE,0x07,0xFD,0xE6,0xED,0xA6,0xED,0xA6,0xED,0xA6,0xE5,0x86,0xDD,0x46,0xCD,0x06,0xC4,0xA5,0xB4,0x65,0xAC,0x25,0x9B,0xC5,0x08,0x40,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x4A,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x5A,0xEB,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x3A,0x08,0xCE,0x9A,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x7B,0xEF,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x39,0xC7,0xBD,0xD7,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x9C,0xD3,0x31,0xA6,0x31,0xA6,0x29,0x45,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0xA1,0x10,0x81,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x81,0x18,0xA1,0x10,0x81,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xD3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x8E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xE4,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0x93,0xC7,0x00,0x00,0x00,0x21,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x08,0x41,0x73,0x4E,0x73,0x4E,0x31,0x66,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x63,0x0D,0x73,0x4E,0x41,0xE8,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x52,0x8B,0x73,0x4E,0x21,0x24,0x00,0x00,0x72,0xE6,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xC4,0xC9,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x08,0x61,0x8C,0x11,0x8C,0x11,0x39,0xC7,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x7B,0xB0,0x8C,0x11,0x52,0x6A,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x6B,0x0D,0x8C,0x11,0x21,0x04,0x00,0x00,0x9B,0xE7,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xE5,0x8A,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDE,0xFB,0x00,0x00,0x00,0x00,0x18,0xA3,0x18,0xA3,0x08,0x41,0x00,0x00,0x94,0xB3,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x10,0xA2,0x00,0x00,0x10,0xA2,0x18,0xA3,0x08,0x61,0x00,0x00,0x6B,0x6E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x08,0x00,0x00,0x08,0x61,0x10,0x82,0x00,0x20,0x00,0x00,0xA4,0x28,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xEE,0x0B,0xA4,0x28,0x7B,0x05,0x6A,0xC5,0x8B,0xA7,0xD5,0x4A,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xED,0xCA,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x3D,0x10,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xB6,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x31,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x71,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x5B,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x68,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4C,0x7B,0x26,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xA3,0xDD,0x8A,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xF5,0xEB,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xDF,0x1C,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xD6,0xDB,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xE7,0x3D,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0xD6,0xBA,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7D,0xCE,0x9A,0xCE,0x9A,0xCE,0x9A,0x29,0x86,0x00,0x00,0x9C,0x08,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4C,0x41,0xA3,0x00,0x00,0x00,0x00,0x52,0xC7,0x7C,0x8C,0x84,0xCC,0x4A,0xA6,0x00,0x00,0x00,0x00,0x72,0xE5,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xE5,0xAA,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x29,0x45,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x42,0x28,0x00,0x00,0x83,0x66,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0x72,0xE5,0x00,0x00,0x21,0x22,0x8D,0xB0,0x8D,0x8F,0x8D,0x6E,0x7D,0xD1,0x31,0xC4,0x00,0x00,0x49,0xE3,0xED,0xEB,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xD5,0x29,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x10,0xA2,0xEF,0x7D,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0x52,0xAB,0x00,0x00,0x6A,0xC5,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xED,0xEB,0x00,0x00,0x00,0x40,0x8D,0xB0,0x84,0xED,0x00,0x00,0x00,0x40,0x8D,0x8F,0x00,0x00,0x20,0xE1,0xFE,0x6C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0xBC,0xA8,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x00,0x00,0x5A,0xCB,0xAD,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0x4A,0x49,0x00,0x00,0x52,0x44,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xA4,0x28,0x00,0x00,0x5B,0x48,0x85,0x0D,0x00,0x00,0x00,0x00,0x84,0xCD,0x84,0xCD,0x00,0x00,0x6A,0xC5,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0xAC,0x27,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xC3,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xA4,0x07,0x00,0x00,0x42,0x66,0x08,0x40,0x00,0x00,0x85,0x0D,0x7D,0xD1,0x63,0x48,0x00,0x00,0x9B,0xE7,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0x93,0xA7,0x00,0x00,0x00,0x21,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x10,0xA2,0x5A,0xEC,0x39,0xE8,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x21,0x24,0x00,0x00,0x31,0x42,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xC5,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xEA,0x7D,0xD1,0x8D,0x6F,0x00,0x20,0x08,0x20,0xED,0xEB,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4C,0x72,0xE5,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x10,0x82,0xCE,0x7A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0x8C,0x72,0x00,0x00,0x20,0xE2,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0x41,0xA3,0x00,0x00,0x00,0x00,0x52,0xC7,0x4A,0x86,0x00,0x00,0x00,0x00,0x83,0x66,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4B,0x5A,0x64,0x00,0x00,0x08,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x4A,0x49,0x94,0xB3,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0xF4,0x73,0x8E,0x00,0x00,0x18,0xC2,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0x41,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x8B,0x86,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4C,0x5A,0x24,0x00,0x00,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC2,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0x00,0x00,0x08,0x40,0xCD,0x4A,0xAC,0x68,0xBC,0xC9,0xF6,0x2B,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4B,0x5A,0x44,0x00,0x00,0x08,0x61,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x08,0x41,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x39,0x83,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xA4,0x07,0xB4,0xA8,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0x83,0x26,0x00,0x00,0x00,0x41,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0x83,0x46,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x6C,0xCD,0x09,0x00,0x00,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x41,0x00,0x00,0x08,0x61,0xFE,0x6C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x4B,0x39,0x83,0x00,0x00,0x00,0x20,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x00,0x00,0x00,0xB4,0xA9,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xFE,0x8C,0xED,0xAA,0x00,0x00,0x00,0x00,0x10,0xA2,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x00,0x20,0x00,0x00,0x10,0x61,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x29,0x22,0x31,0x42,0x21,0x02,0x00,0x00,0x00,0x00,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0x82,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
 };
+#endif
 const lv_img_dsc_t ui_img_hay_time_png = {
     .header.always_zero = 0,
     .header.w = 64,
     .header.h = 64,
     .data_size = sizeof(ui_img_hay_time_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_hay_time_png_data
 };
 
+#endif // UI_ASSETS_PARTITION
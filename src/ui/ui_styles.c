@@ -0,0 +1,63 @@
+// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj
+
+#include "ui_styles.h"
+
+lv_style_t ui_style_1;
+lv_style_t ui_style_2;
+lv_style_t ui_style_3;
+lv_style_t ui_style_4;
+lv_style_t ui_style_5;
+lv_style_t ui_style_6;
+lv_style_t ui_style_7;
+lv_style_t ui_style_8;
+lv_style_t ui_style_9;
+
+void ui_styles_init(void)
+{
+    static bool initialized = false;
+    if(initialized) return;
+    initialized = true;
+
+    lv_style_init(&ui_style_1);
+    lv_style_set_text_font(&ui_style_1, &lv_font_montserrat_18);
+
+    lv_style_init(&ui_style_2);
+    lv_style_set_text_font(&ui_style_2, &lv_font_montserrat_20);
+
+    lv_style_init(&ui_style_3);
+    lv_style_set_text_align(&ui_style_3, LV_TEXT_ALIGN_LEFT);
+    lv_style_set_text_font(&ui_style_3, &lv_font_montserrat_18);
+
+    lv_style_init(&ui_style_4);
+    lv_style_set_img_recolor(&ui_style_4, lv_color_hex(0xFFEA83));
+    lv_style_set_img_recolor_opa(&ui_style_4, 0);
+
+    lv_style_init(&ui_style_5);
+    lv_style_set_bg_color(&ui_style_5, lv_color_hex(0xFFFFFF));
+    lv_style_set_bg_opa(&ui_style_5, 0);
+    lv_style_set_text_color(&ui_style_5, lv_color_hex(0x6AC27B));
+    lv_style_set_text_opa(&ui_style_5, 255);
+
+    lv_style_init(&ui_style_6);
+    lv_style_set_text_color(&ui_style_6, lv_color_hex(0x6AC27B));
+    lv_style_set_text_opa(&ui_style_6, 255);
+
+    lv_style_init(&ui_style_7);
+    lv_style_set_bg_color(&ui_style_7, lv_color_hex(0x6AC27B));
+    lv_style_set_bg_opa(&ui_style_7, 30);
+    lv_style_set_border_color(&ui_style_7, lv_color_hex(0x6AC27B));
+    lv_style_set_border_opa(&ui_style_7, 255);
+    lv_style_set_text_color(&ui_style_7, lv_color_hex(0x6AC27B));
+    lv_style_set_text_opa(&ui_style_7, 255);
+
+    lv_style_init(&ui_style_8);
+    lv_style_set_bg_color(&ui_style_8, lv_color_hex(0x6AC27B));
+    lv_style_set_bg_opa(&ui_style_8, 255);
+    lv_style_set_text_color(&ui_style_8, lv_color_hex(0x000000));
+    lv_style_set_text_opa(&ui_style_8, 255);
+
+    lv_style_init(&ui_style_9);
+    lv_style_set_text_align(&ui_style_9, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_text_color(&ui_style_9, lv_color_hex(0x000000));
+    lv_style_set_text_opa(&ui_style_9, 255);
+}
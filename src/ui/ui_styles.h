@@ -0,0 +1,30 @@
+// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj
+// Static styles shared by every object with the same style properties
+
+#ifndef _UI_STYLES_H
+#define _UI_STYLES_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern lv_style_t ui_style_1;
+extern lv_style_t ui_style_2;
+extern lv_style_t ui_style_3;
+extern lv_style_t ui_style_4;
+extern lv_style_t ui_style_5;
+extern lv_style_t ui_style_6;
+extern lv_style_t ui_style_7;
+extern lv_style_t ui_style_8;
+extern lv_style_t ui_style_9;
+
+// Set up the styles (called by ui_Main_screen_init before any object uses them)
+void ui_styles_init(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
@@ -0,0 +1,30 @@
+// Displayed text of the main screen labels with per-field dirty bits - see view_model.h
+
+#include "view_model.h"
+#include <string.h>
+
+void viewInit(ViewModel *vm) {
+    memset(vm, 0, sizeof(*vm));
+}
+
+bool viewSetText(ViewModel *vm, ViewField field, const char *text) {
+    char *shown = vm->text[field];
+    if (strncmp(shown, text, VIEW_TEXT_MAX - 1) == 0) {
+        vm->unchanged++;
+        return false;
+    }
+    strncpy(shown, text, VIEW_TEXT_MAX - 1);
+    shown[VIEW_TEXT_MAX - 1] = '\0';
+    vm->dirty |= 1UL << field;
+    return true;
+}
+
+uint32_t viewTakeDirty(ViewModel *vm) {
+    uint32_t dirty = vm->dirty;
+    vm->dirty = 0;
+    return dirty;
+}
+
+const char *viewText(const ViewModel *vm, ViewField field) {
+    return vm->text[field];
+}
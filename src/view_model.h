@@ -0,0 +1,48 @@
+// Displayed text of the main screen labels with per-field dirty bits
+//
+// The UI task formats every value into the model, but a field only turns
+// dirty when its text actually changes. Once per frame the dirty fields are
+// copied to their labels, so a burst of counts between two frames costs one
+// label update and unchanged labels are never invalidated.
+// The labels display the text buffers directly (lv_label_set_text_static),
+// so a ViewModel must outlive its labels - keep it in static storage.
+
+#ifndef BALECOUNTER_VIEW_MODEL_H
+#define BALECOUNTER_VIEW_MODEL_H
+
+#include <stdint.h>
+
+// Longest field text plus its terminator. The callers format into
+// buffers of this size, so nothing is cut ("123 left 12:34" in VIEW_FORECAST).
+#define VIEW_TEXT_MAX 32
+
+enum ViewField {
+    VIEW_BALE_COUNT,
+    VIEW_BALE_COUNT_YEAR,
+    VIEW_FLAKE_COUNT,
+    VIEW_FLAKE_PREV1,
+    VIEW_FLAKE_PREV2,
+    VIEW_BALES_PER_HOUR,
+    VIEW_FORECAST,
+    VIEW_JOB_TARGET,
+    VIEW_FIELD_COUNT
+};
+
+struct ViewModel {
+    char text[VIEW_FIELD_COUNT][VIEW_TEXT_MAX];  // Text each label should show
+    uint32_t dirty;                              // Bit per field changed since the last apply
+    uint32_t unchanged;                          // Sets skipped because the text was the same
+};
+
+// Start with empty text so the first value of every field is applied
+void viewInit(ViewModel *vm);
+
+// Store a field's text. Marks it dirty only if it differs. Returns true if changed.
+bool viewSetText(ViewModel *vm, ViewField field, const char *text);
+
+// Return the dirty bits and clear them (once per frame)
+uint32_t viewTakeDirty(ViewModel *vm);
+
+const char *viewText(const ViewModel *vm, ViewField field);
+
+#endif // BALECOUNTER_VIEW_MODEL_H
@@ -0,0 +1,52 @@
+// Row bookkeeping for a list that only has objects for the visible rows - see virtual_list.h
+
+#include "virtual_list.h"
+
+void vlistInit(VirtualList *vl, uint16_t row_h, uint16_t view_h) {
+    vl->row_h = row_h;
+    vl->view_h = view_h;
+    uint32_t slots = (view_h + row_h - 1) / row_h + 1;
+    vl->slots = slots > VLIST_MAX_SLOTS ? VLIST_MAX_SLOTS : (uint8_t)slots;
+    vl->count = 0;
+    vl->scroll_y = 0;
+    vlistInvalidate(vl);
+}
+
+void vlistInvalidate(VirtualList *vl) {
+    // Not a row a slot can show, so every slot differs on the next update
+    for (uint8_t i = 0; i < VLIST_MAX_SLOTS; i++) {
+        vl->slot_row[i] = VLIST_NO_ROW - 1;
+    }
+}
+
+int32_t vlistMaxScroll(const VirtualList *vl) {
+    int64_t content = (int64_t)vl->count * vl->row_h;
+    return content > vl->view_h ? (int32_t)(content - vl->view_h) : 0;
+}
+
+uint32_t vlistUpdate(VirtualList *vl, uint32_t count, int32_t scroll_y) {
+    vl->count = count;
+    int32_t max_scroll = vlistMaxScroll(vl);
+    if (scroll_y > max_scroll) scroll_y = max_scroll;
+    if (scroll_y < 0) scroll_y = 0;
+    vl->scroll_y = scroll_y;
+
+    uint32_t first = (uint32_t)scroll_y / vl->row_h;
+    uint32_t changed = 0;
+    for (uint8_t n = 0; n < vl->slots; n++) {
+        uint32_t row = first + n;
+        uint8_t slot = row % vl->slots;
+        if (row >= count) {
+            row = VLIST_NO_ROW;
+        }
+        if (vl->slot_row[slot] != row) {
+            vl->slot_row[slot] = row;
+            changed |= 1UL << slot;
+        }
+    }
+    return changed;
+}
+
+int32_t vlistSlotY(const VirtualList *vl, uint8_t slot) {
+    return (int32_t)((int64_t)vl->slot_row[slot] * vl->row_h - vl->scroll_y);
+}
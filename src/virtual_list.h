@@ -0,0 +1,42 @@
+// Row bookkeeping for a list that only has objects for the visible rows
+//
+// The list has a fixed number of slots, enough to cover the viewport plus a
+// partly visible row at the top and bottom. Row r is always shown by slot
+// r % slots, so scrolling by one row moves one slot from one end to the
+// other and only that slot needs new text. Memory and the cost of a scroll
+// step depend on the viewport height, not on the number of rows.
+
+#ifndef BALECOUNTER_VIRTUAL_LIST_H
+#define BALECOUNTER_VIRTUAL_LIST_H
+
+#include <stdint.h>
+
+#define VLIST_MAX_SLOTS 16
+#define VLIST_NO_ROW UINT32_MAX  // Slot is past the last row and hidden
+
+struct VirtualList {
+    uint32_t slot_row[VLIST_MAX_SLOTS];  // Row shown by each slot
+    uint32_t count;        // Rows in the list
+    int32_t scroll_y;      // Pixels scrolled from the top of row 0
+    uint16_t row_h;
+    uint16_t view_h;
+    uint8_t slots;
+};
+
+// Size the slots for the viewport. Starts empty, scrolled to the top.
+void vlistInit(VirtualList *vl, uint16_t row_h, uint16_t view_h);
+
+// Set the row count and scroll position (clamped to the rows). Returns a
+// bit per slot whose row changed and needs its text set.
+uint32_t vlistUpdate(VirtualList *vl, uint32_t count, int32_t scroll_y);
+
+// Forget the rows shown, so the next update sets every slot (rows changed)
+void vlistInvalidate(VirtualList *vl);
+
+// Largest scroll position for the current row count
+int32_t vlistMaxScroll(const VirtualList *vl);
+
+// Top of a slot's row relative to the top of the viewport (may be negative)
+int32_t vlistSlotY(const VirtualList *vl, uint8_t slot);
+
+#endif // BALECOUNTER_VIRTUAL_LIST_H
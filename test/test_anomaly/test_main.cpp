@@ -0,0 +1,181 @@
+// Host tests of the sensor anomaly detectors (src/anomaly.h), with injected faults
+
+#include <unity.h>
+#include "anomaly.h"
+
+static AnomalyDetector ad;
+static uint32_t now;
+
+// Normal baling: a flake every 2.5 s (ON for 400 ms), 12 flakes and one
+// bale edge (ON for 1 s) per bale
+static void runNormalBales(int bales) {
+    for (int b = 0; b < bales; b++) {
+        for (int f = 0; f < 12; f++) {
+            anomalyOnEdge(&ad, SENSOR_FLAKE, true, now);
+            anomalyOnFlake(&ad, now);
+            anomalyOnEdge(&ad, SENSOR_FLAKE, false, now + 400);
+            now += 2500;
+            anomalyTick(&ad, now);
+        }
+        anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+        anomalyOnBale(&ad, 12, now);
+        anomalyOnEdge(&ad, SENSOR_BALE, false, now + 1000);
+        now += 2000;
+        anomalyTick(&ad, now);
+    }
+}
+
+static bool isActive(AnomalyType type) {
+    return (ad.active & (1UL << type)) != 0;
+}
+
+void setUp(void) {
+    now = 1000;
+    anomalyInit(&ad, now);
+}
+
+void tearDown(void) {
+}
+
+static void test_normal_session_is_quiet(void) {
+    runNormalBales(50);
+    TEST_ASSERT_EQUAL_UINT32(0, ad.active);
+    TEST_ASSERT_EQUAL_UINT32(0, ad.total);
+}
+
+static void test_bale_sensor_stuck_on(void) {
+    runNormalBales(10);
+    anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+    for (int i = 0; i < 40; i++) {
+        now += 1000;
+        anomalyTick(&ad, now);
+    }
+    TEST_ASSERT_TRUE(isActive(ANOMALY_BALE_STUCK_ON));
+    TEST_ASSERT_EQUAL_UINT32(1, ad.counts[ANOMALY_BALE_STUCK_ON]);
+
+    // The next edge clears it
+    anomalyOnEdge(&ad, SENSOR_BALE, false, now);
+    TEST_ASSERT_FALSE(isActive(ANOMALY_BALE_STUCK_ON));
+}
+
+// A knocked bale sensor stays OFF while flakes keep coming
+static void test_bale_sensor_stuck_off(void) {
+    runNormalBales(10);
+    for (int f = 0; f < 150; f++) {
+        anomalyOnEdge(&ad, SENSOR_FLAKE, true, now);
+        anomalyOnFlake(&ad, now);
+        anomalyOnEdge(&ad, SENSOR_FLAKE, false, now + 400);
+        now += 2500;
+        anomalyTick(&ad, now);
+    }
+    TEST_ASSERT_TRUE(isActive(ANOMALY_FLAKES_NO_BALE));
+    TEST_ASSERT_TRUE(isActive(ANOMALY_BALE_STUCK_OFF));
+    TEST_ASSERT_FALSE(isActive(ANOMALY_FLAKE_STUCK_OFF));
+}
+
+// An idle baler (both sensors quiet) is not a stuck sensor
+static void test_idle_baler_is_quiet(void) {
+    runNormalBales(10);
+    for (int i = 0; i < 3600; i++) {
+        now += 1000;
+        anomalyTick(&ad, now);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ad.active);
+}
+
+static void test_flake_chatter(void) {
+    runNormalBales(5);
+    for (int i = 0; i < 30; i++) {
+        anomalyOnEdge(&ad, SENSOR_FLAKE, (i & 1) == 0, now);
+        now += 20;
+    }
+    TEST_ASSERT_TRUE(isActive(ANOMALY_FLAKE_CHATTER));
+    TEST_ASSERT_FALSE(isActive(ANOMALY_BALE_CHATTER));
+
+    // Clears after a quiet window
+    now += 3 * ANOMALY_CHATTER_WINDOW_MS;
+    anomalyTick(&ad, now);
+    TEST_ASSERT_FALSE(isActive(ANOMALY_FLAKE_CHATTER));
+}
+
+// A missed bale edge: one bale with double the flakes and interval
+static void test_missed_bale(void) {
+    runNormalBales(10);
+    for (int f = 0; f < 24; f++) {
+        anomalyOnEdge(&ad, SENSOR_FLAKE, true, now);
+        anomalyOnFlake(&ad, now);
+        anomalyOnEdge(&ad, SENSOR_FLAKE, false, now + 400);
+        now += 2500;
+    }
+    anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+    anomalyOnBale(&ad, 24, now);
+    TEST_ASSERT_TRUE(isActive(ANOMALY_BALE_INTERVAL));
+    TEST_ASSERT_TRUE(isActive(ANOMALY_FLAKES_PER_BALE));
+
+    // A normal bale clears both
+    anomalyOnEdge(&ad, SENSOR_BALE, false, now + 1000);
+    now += 2000;
+    runNormalBales(1);
+    TEST_ASSERT_FALSE(isActive(ANOMALY_BALE_INTERVAL));
+    TEST_ASSERT_FALSE(isActive(ANOMALY_FLAKES_PER_BALE));
+}
+
+// An acknowledged alert isn't raised or counted again while its condition
+// holds, and comes back once it has cleared and happens again
+static void test_acknowledge(void) {
+    runNormalBales(10);
+    anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+    now += 40000;
+    anomalyTick(&ad, now);
+    TEST_ASSERT_TRUE(isActive(ANOMALY_BALE_STUCK_ON));
+    uint32_t total = ad.total;
+
+    anomalyAcknowledge(&ad);
+    TEST_ASSERT_EQUAL_UINT32(0, ad.active);
+    for (int i = 0; i < 60; i++) {
+        now += 1000;
+        anomalyTick(&ad, now);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ad.active);
+    TEST_ASSERT_EQUAL_UINT32(total, ad.total);
+
+    // Sensor switches (condition clears), then sticks again
+    anomalyOnEdge(&ad, SENSOR_BALE, false, now);
+    now += 1000;
+    anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+    now += 200000;
+    anomalyTick(&ad, now);
+    TEST_ASSERT_TRUE(isActive(ANOMALY_BALE_STUCK_ON));
+    TEST_ASSERT_EQUAL_UINT32(total + 1, ad.total);
+    TEST_ASSERT_EQUAL_UINT32(2, ad.counts[ANOMALY_BALE_STUCK_ON]);
+}
+
+// Acknowledging one alert doesn't hide a different one
+static void test_acknowledge_is_per_alert(void) {
+    runNormalBales(10);
+    anomalyOnEdge(&ad, SENSOR_BALE, true, now);
+    now += 40000;
+    anomalyTick(&ad, now);
+    anomalyAcknowledge(&ad);
+
+    for (int i = 0; i < 30; i++) {
+        anomalyOnEdge(&ad, SENSOR_FLAKE, (i & 1) == 0, now);
+        now += 20;
+    }
+    TEST_ASSERT_EQUAL_UINT32(1UL << ANOMALY_FLAKE_CHATTER, ad.active);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_normal_session_is_quiet);
+    RUN_TEST(test_bale_sensor_stuck_on);
+    RUN_TEST(test_bale_sensor_stuck_off);
+    RUN_TEST(test_idle_baler_is_quiet);
+    RUN_TEST(test_flake_chatter);
+    RUN_TEST(test_missed_bale);
+    RUN_TEST(test_acknowledge);
+    RUN_TEST(test_acknowledge_is_per_alert);
+    return UNITY_END();
+}
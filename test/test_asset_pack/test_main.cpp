@@ -0,0 +1,246 @@
+// Host tests of the assets partition layout (src/asset_pack.h) and of the
+// icons tools/img_convert.py and tools/pack_assets.py write
+//
+// The tool test runs pack_assets.py from the project root (where pio test
+// runs the program) and checks every icon in the pack against the array
+// committed in src/ui, so stale arrays or a layout change on one side fail.
+
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "asset_pack.h"
+
+// lv_img_cf_t values (LVGL 8.3)
+#define CF_TRUE_COLOR 4
+#define CF_TRUE_COLOR_ALPHA 5
+#define CF_INDEXED_1BIT 7
+#define CF_INDEXED_4BIT 9
+
+static const char *const ICONS[] = {
+    "hay_flake_better_60tall", "hay", "hay_time", "balesperhour_102tall", "setting_white", "close_btn_white",
+};
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// Append a pack the way pack_assets.py lays it out: header, directory,
+// then each body at a 4-byte aligned offset
+static std::vector<uint8_t> makePack(const char *const *names, const std::string *bodies, int count) {
+    uint32_t data_start = sizeof(AssetPackHeader) + count * sizeof(AssetEntry);
+    std::vector<uint8_t> pack(data_start);
+    for (int i = 0; i < count; i++) {
+        pack.resize((pack.size() + 3) & ~3UL);
+        AssetEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        strncpy(entry.name, names[i], ASSET_NAME_MAX - 1);
+        entry.offset = pack.size();
+        entry.size = bodies[i].size();
+        memcpy(&pack[sizeof(AssetPackHeader) + i * sizeof(AssetEntry)], &entry, sizeof(entry));
+        pack.insert(pack.end(), bodies[i].begin(), bodies[i].end());
+    }
+    AssetPackHeader header = {ASSET_PACK_MAGIC, (uint16_t)count, 16, 0, (uint32_t)pack.size()};
+    memcpy(&pack[0], &header, sizeof(header));
+    return pack;
+}
+
+static AssetEntry *entryAt(std::vector<uint8_t> &pack, int i) {
+    return (AssetEntry *)&pack[sizeof(AssetPackHeader) + i * sizeof(AssetEntry)];
+}
+
+// The structs match pack_assets.py's "<IHBBI" and "<28sII"
+static void test_layout(void) {
+    TEST_ASSERT_EQUAL(12, sizeof(AssetPackHeader));
+    TEST_ASSERT_EQUAL(36, sizeof(AssetEntry));
+}
+
+static void test_open_and_find(void) {
+    const char *names[] = {"a.bin", "bb.bin"};
+    std::string bodies[] = {"hello", "world!!"};
+    std::vector<uint8_t> pack = makePack(names, bodies, 2);
+
+    AssetPack ap;
+    TEST_ASSERT_TRUE(assetPackOpen(&ap, pack.data(), pack.size()));
+    TEST_ASSERT_EQUAL(2, ap.count);
+    TEST_ASSERT_EQUAL(16, ap.color_depth);
+    const AssetEntry *e = assetPackFind(&ap, "bb.bin");
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL(0, e->offset % 4);
+    TEST_ASSERT_EQUAL(7, e->size);
+    TEST_ASSERT_EQUAL(0, memcmp(assetPackData(&ap, e), "world!!", 7));
+    TEST_ASSERT_NULL(assetPackFind(&ap, "b.bin"));
+}
+
+// A damaged or missing pack is refused, and leaves no entries to find
+static void test_rejects_damage(void) {
+    const char *names[] = {"a.bin"};
+    std::string bodies[] = {"hello"};
+    const std::vector<uint8_t> good = makePack(names, bodies, 1);
+    AssetPack ap;
+
+    std::vector<uint8_t> pack = good;
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), sizeof(AssetPackHeader) - 1));
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), pack.size() - 1));    // Truncated
+
+    std::vector<uint8_t> erased(good.size(), 0xFF);                         // Never written
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, erased.data(), erased.size()));
+    TEST_ASSERT_EQUAL(0, ap.count);
+
+    pack = good;
+    ((AssetPackHeader *)&pack[0])->count = 50;                              // Directory past the end
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), pack.size()));
+
+    pack = good;
+    entryAt(pack, 0)->offset = 4;                                           // Inside the directory
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), pack.size()));
+
+    pack = good;
+    entryAt(pack, 0)->size = 6;                                             // Past the end
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), pack.size()));
+
+    pack = good;
+    memset(entryAt(pack, 0)->name, 'x', ASSET_NAME_MAX);                    // No terminating zero
+    TEST_ASSERT_FALSE(assetPackOpen(&ap, pack.data(), pack.size()));
+    TEST_ASSERT_NULL(assetPackFind(&ap, "a.bin"));
+
+    pack = good;
+    TEST_ASSERT_TRUE(assetPackOpen(&ap, pack.data(), pack.size()));
+}
+
+static bool readFile(const char *path, std::string *out) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    out->clear();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        out->append(buf, n);
+    }
+    fclose(f);
+    return true;
+}
+
+// Write the assets partition image for a colour depth with the real tool
+static bool runPackAssets(int depth, std::string *pack) {
+    char command[128], path[64];
+    snprintf(path, sizeof(path), "/tmp/test_asset_pack_%d.bin", depth);
+    snprintf(command, sizeof(command), "python3 tools/pack_assets.py --depth %d --out %s > /dev/null", depth, path);
+    bool ok = system(command) == 0 && readFile(path, pack);
+    remove(path);
+    return ok;
+}
+
+struct ImageArray {
+    uint32_t w, h, cf;
+    std::vector<uint8_t> data8;    // The LV_COLOR_DEPTH == 8 array, or the only one
+    std::vector<uint8_t> data16;   // The other array, or the only one
+};
+
+static uint32_t fieldValue(const std::string &src, const char *field) {
+    size_t at = src.find(field);
+    return at == std::string::npos ? 0 : strtoul(src.c_str() + at + strlen(field), NULL, 0);
+}
+
+// Read the image arrays and header out of a src/ui/ui_img_*_png.c file
+static bool readImageArray(const char *name, ImageArray *img) {
+    char path[96];
+    snprintf(path, sizeof(path), "src/ui/ui_img_%s_png.c", name);
+    std::string src;
+    if (!readFile(path, &src)) {
+        return false;
+    }
+    std::vector<std::vector<uint8_t> > arrays;
+    for (size_t at = src.find("_data[] = {"); at != std::string::npos; at = src.find("_data[] = {", at)) {
+        size_t end = src.find("};", at);
+        std::vector<uint8_t> bytes;
+        for (size_t p = src.find("0x", at); p < end; p = src.find("0x", p + 2)) {
+            bytes.push_back((uint8_t)strtoul(src.c_str() + p, NULL, 16));
+        }
+        arrays.push_back(bytes);
+        at = end;
+    }
+    if (arrays.empty()) {
+        return false;
+    }
+    img->w = fieldValue(src, ".header.w = ");
+    img->h = fieldValue(src, ".header.h = ");
+    img->cf = src.find("LV_IMG_CF_TRUE_COLOR_ALPHA,") != std::string::npos ? CF_TRUE_COLOR_ALPHA
+            : src.find("LV_IMG_CF_TRUE_COLOR,") != std::string::npos   ? CF_TRUE_COLOR
+            : src.find("LV_IMG_CF_INDEXED_1BIT,") != std::string::npos ? CF_INDEXED_1BIT
+            : src.find("LV_IMG_CF_INDEXED_2BIT,") != std::string::npos ? CF_INDEXED_1BIT + 1
+                                                                       : CF_INDEXED_4BIT;
+    img->data8 = arrays.front();
+    img->data16 = arrays.back();
+    return true;
+}
+
+// Bytes of pixel data LVGL reads for an image
+static uint32_t expectedSize(uint32_t cf, uint32_t w, uint32_t h, int depth) {
+    if (cf == CF_TRUE_COLOR) {
+        return w * h * (depth / 8);
+    }
+    if (cf == CF_TRUE_COLOR_ALPHA) {
+        return w * h * (depth / 8 + 1);
+    }
+    uint32_t bits = 1U << (cf - CF_INDEXED_1BIT);
+    return 4 * (1U << bits) + h * ((w * bits + 7) / 8);
+}
+
+// The packs written by pack_assets.py open, hold every icon and match the arrays
+static void test_tool_pack_matches_arrays(void) {
+    for (int depth = 8; depth <= 16; depth += 8) {
+        std::string bytes;
+        if (!runPackAssets(depth, &bytes)) {
+            TEST_IGNORE_MESSAGE("python3 tools/pack_assets.py did not run (not in the project root?)");
+        }
+        AssetPack ap;
+        TEST_ASSERT_TRUE(assetPackOpen(&ap, (const uint8_t *)bytes.data(), bytes.size()));
+        TEST_ASSERT_EQUAL(depth, ap.color_depth);
+        TEST_ASSERT_EQUAL(sizeof(ICONS) / sizeof(ICONS[0]), ap.count);
+
+        for (size_t i = 0; i < sizeof(ICONS) / sizeof(ICONS[0]); i++) {
+            char name[ASSET_NAME_MAX];
+            snprintf(name, sizeof(name), "%s.bin", ICONS[i]);
+            const AssetEntry *e = assetPackFind(&ap, name);
+            TEST_ASSERT_NOT_NULL_MESSAGE(e, name);
+            TEST_ASSERT_EQUAL_MESSAGE(0, e->offset % 4, name);
+
+            // The LVGL .bin header: cf:5, always_zero:3, reserved:2, w:11, h:11
+            const uint8_t *body = assetPackData(&ap, e);
+            uint32_t header;
+            memcpy(&header, body, 4);
+            uint32_t cf = header & 0x1F, w = (header >> 10) & 0x7FF, h = (header >> 21) & 0x7FF;
+            TEST_ASSERT_EQUAL_MESSAGE(expectedSize(cf, w, h, depth) + 4, e->size, name);
+
+            ImageArray img;
+            TEST_ASSERT_TRUE_MESSAGE(readImageArray(ICONS[i], &img), name);
+            TEST_ASSERT_EQUAL_MESSAGE(img.cf, cf, name);
+            TEST_ASSERT_EQUAL_MESSAGE(img.w, w, name);
+            TEST_ASSERT_EQUAL_MESSAGE(img.h, h, name);
+            const std::vector<uint8_t> &data = depth == 8 ? img.data8 : img.data16;
+            TEST_ASSERT_EQUAL_MESSAGE(data.size(), e->size - 4, name);
+            TEST_ASSERT_EQUAL_MESSAGE(0, memcmp(data.data(), body + 4, data.size()), name);
+        }
+        char msg[64];
+        snprintf(msg, sizeof(msg), "%d-bit pack: %u bytes", depth, (unsigned)bytes.size());
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_layout);
+    RUN_TEST(test_open_and_find);
+    RUN_TEST(test_rejects_damage);
+    RUN_TEST(test_tool_pack_matches_arrays);
+    return UNITY_END();
+}
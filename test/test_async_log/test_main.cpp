@@ -0,0 +1,240 @@
+// Host tests of the log ring and the record formatter (src/async_log.h)
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "async_log.h"
+
+static LogRing ring;
+
+void setUp(void) {
+    logRingInit(&ring);
+}
+
+void tearDown(void) {
+}
+
+static bool push(uint32_t a, uint32_t b) {
+    LogValue args[2];
+    args[0].u = a;
+    args[1].u = b;
+    return logRingPush(&ring, LOG_LEVEL_INFO, "%u %u", args, 2, a);
+}
+
+// A full ring drops and counts the new record, and takes records again once read
+static void test_drops(void) {
+    for (uint32_t i = 0; i < LOG_RING_SIZE; i++) {
+        TEST_ASSERT_TRUE(push(i, 0));
+    }
+    TEST_ASSERT_FALSE(push(100, 0));
+    TEST_ASSERT_FALSE(push(101, 0));
+    TEST_ASSERT_FALSE(push(102, 0));
+    TEST_ASSERT_EQUAL_UINT32(3, ring.dropped.load());
+    TEST_ASSERT_EQUAL_UINT32(LOG_RING_SIZE, ring.written.load());
+
+    LogRecord rec;
+    TEST_ASSERT_TRUE(logRingPop(&ring, &rec));
+    TEST_ASSERT_EQUAL_UINT32(0, rec.args[0].u);
+    TEST_ASSERT_TRUE(push(200, 0));
+    TEST_ASSERT_FALSE(push(201, 0));
+    TEST_ASSERT_EQUAL_UINT32(4, ring.dropped.load());
+
+    uint32_t expect = 1;
+    while (logRingPop(&ring, &rec)) {
+        TEST_ASSERT_EQUAL_UINT32(expect, rec.args[0].u);
+        expect = (expect == LOG_RING_SIZE - 1) ? 200 : expect + 1;
+    }
+    TEST_ASSERT_EQUAL_UINT32(201, expect);
+}
+
+// Many laps of the ring, and positions that wrap past 2^32
+static void test_wraparound(void) {
+    const uint32_t base = 0xFFFFFFFFUL - 2 * LOG_RING_SIZE + 5;
+    ring.write_pos.store(base);
+    ring.read_pos = base;
+    for (uint32_t pos = base; pos != base + LOG_RING_SIZE; pos++) {
+        ring.slots[pos & (LOG_RING_SIZE - 1)].seq.store(pos);
+    }
+
+    LogRecord rec;
+    uint32_t next = 0;
+    for (uint32_t lap = 0; lap < 10; lap++) {
+        // Fill three quarters, so pushes and pops land on every slot
+        for (uint32_t i = 0; i < LOG_RING_SIZE * 3 / 4; i++) {
+            TEST_ASSERT_TRUE(push(next + i, lap));
+        }
+        for (uint32_t i = 0; i < LOG_RING_SIZE * 3 / 4; i++) {
+            TEST_ASSERT_TRUE(logRingPop(&ring, &rec));
+            TEST_ASSERT_EQUAL_UINT32(next + i, rec.args[0].u);
+            TEST_ASSERT_EQUAL_UINT32(lap, rec.args[1].u);
+        }
+        TEST_ASSERT_FALSE(logRingPop(&ring, &rec));
+        next += LOG_RING_SIZE * 3 / 4;
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(base, ring.read_pos);   // Wrapped
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped.load());
+
+    // Still full at exactly LOG_RING_SIZE after the wrap
+    for (uint32_t i = 0; i < LOG_RING_SIZE; i++) {
+        TEST_ASSERT_TRUE(push(i, 0));
+    }
+    TEST_ASSERT_FALSE(push(0, 0));
+}
+
+// Four producer threads and a reader: each thread's records come out once
+// and in order, or are counted as dropped
+static void test_producers(void) {
+    const uint32_t threads = 4;
+    const uint32_t per_thread = 50000;
+    std::vector<uint32_t> got(threads, 0);
+    std::vector<uint32_t> last(threads, 0);
+    std::atomic<uint32_t> running(threads);
+    bool in_order = true;
+
+    std::thread reader([&] {
+        LogRecord rec;
+        for (;;) {
+            bool done = running.load() == 0;
+            while (logRingPop(&ring, &rec)) {
+                uint32_t t = rec.args[0].u;
+                uint32_t seq = rec.args[1].u;
+                if (t >= threads || seq <= last[t]) {
+                    in_order = false;
+                    continue;
+                }
+                last[t] = seq;
+                got[t]++;
+            }
+            if (done) {
+                break;
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (uint32_t t = 0; t < threads; t++) {
+        writers.emplace_back([&, t] {
+            for (uint32_t i = 1; i <= per_thread; i++) {
+                if (!push(t, i)) {
+                    std::this_thread::yield();   // Give the reader a turn, like a busy UART
+                }
+            }
+            running--;
+        });
+    }
+    for (std::thread &w : writers) {
+        w.join();
+    }
+    reader.join();
+
+    uint32_t total = 0;
+    for (uint32_t t = 0; t < threads; t++) {
+        total += got[t];
+    }
+    TEST_ASSERT_TRUE(in_order);
+    TEST_ASSERT_EQUAL_UINT32(total, ring.written.load());
+    TEST_ASSERT_EQUAL_UINT32(threads * per_thread, total + ring.dropped.load());
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%lu records from %lu threads, %lu dropped", (unsigned long)total,
+             (unsigned long)threads, (unsigned long)ring.dropped.load());
+    TEST_MESSAGE(msg);
+}
+
+static LogRecord record(uint32_t time_ms, uint8_t level, const char *fmt) {
+    LogRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.time_ms = time_ms;
+    rec.level = level;
+    rec.fmt = fmt;
+    return rec;
+}
+
+// The conversions the firmware uses, with the time and level prefix
+static void test_format(void) {
+    char buf[LOG_LINE_MAX];
+    LogRecord rec = record(12345, LOG_LEVEL_INFO, "Bale %lu, rate %.2f bales/hour, %s");
+    rec.args[0].u = 4000000000UL;
+    rec.args[1].f = 41.256f;
+    rec.args[2].s = "bale";
+    rec.count = 3;
+    size_t n = logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("[    12.345] I Bale 4000000000, rate 41.26 bales/hour, bale\n", buf);
+    TEST_ASSERT_EQUAL(strlen(buf), n);
+
+    rec = record(0, LOG_LEVEL_WARN, "%d%% %5d|%-4x|%c %s");
+    rec.args[0].i = -7;
+    rec.args[1].i = 42;
+    rec.args[2].u = 0xAB;
+    rec.args[3].i = 'z';
+    rec.count = 4;
+    logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("[     0.000] W -7%    42|ab  |z %s\n", buf);
+
+    rec = record(1, LOG_LEVEL_ERROR, "null %s");
+    rec.args[0].s = NULL;
+    rec.count = 1;
+    logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("[     0.001] E null (null)\n", buf);
+}
+
+// A missing argument or an unknown conversion is shown as written
+static void test_format_missing_args(void) {
+    char buf[LOG_LINE_MAX];
+    LogRecord rec = record(2000, LOG_LEVEL_DEBUG, "a %d b %lu c %.1f %q");
+    rec.args[0].i = 5;
+    rec.count = 1;
+    logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("[     2.000] D a 5 b %u c %.1f %q\n", buf);
+
+    rec = record(2000, 9, "trailing %");
+    logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("[     2.000] ? trailing %\n", buf);
+}
+
+// A long line is cut to fit, and still ends in a newline
+static void test_format_truncation(void) {
+    char buf[LOG_LINE_MAX];
+    char big[300];
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = 0;
+    LogRecord rec = record(999999, LOG_LEVEL_INFO, "long %s end");
+    rec.args[0].s = big;
+    rec.count = 1;
+    size_t n = logFormat(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL(LOG_LINE_MAX - 1, n);
+    TEST_ASSERT_EQUAL(n, strlen(buf));
+    TEST_ASSERT_EQUAL_UINT8('\n', buf[n - 1]);
+    TEST_ASSERT_EQUAL_UINT8('x', buf[n - 2]);
+
+    // Cut inside the prefix, inside a number and inside plain text
+    static const size_t lens[] = {2, 5, 16, 20, 24};
+    rec = record(12345, LOG_LEVEL_INFO, "count %u of many");
+    rec.args[0].u = 1234567;
+    rec.count = 1;
+    const char *full = "[    12.345] I count 1234567 of many\n";
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        memset(buf, '#', sizeof(buf));
+        n = logFormat(&rec, buf, lens[i]);
+        TEST_ASSERT_EQUAL(lens[i] - 1, n);
+        TEST_ASSERT_EQUAL_UINT8('\n', buf[n - 1]);
+        TEST_ASSERT_EQUAL_UINT8(0, buf[n]);
+        TEST_ASSERT_EQUAL_UINT8('#', buf[lens[i]]);
+        TEST_ASSERT_EQUAL_INT(0, strncmp(full, buf, n - 1));
+    }
+    TEST_ASSERT_EQUAL(0, logFormat(&rec, buf, 1));
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_drops);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_producers);
+    RUN_TEST(test_format);
+    RUN_TEST(test_format_missing_args);
+    RUN_TEST(test_format_truncation);
+    return UNITY_END();
+}
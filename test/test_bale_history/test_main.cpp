@@ -0,0 +1,209 @@
+// Host tests of the bale records, the record cache and the queue from the
+// sensor task to the history writer (src/bale_history.h)
+
+#include <unity.h>
+#include <thread>
+#include <vector>
+#include "bale_history.h"
+
+static HistoryQueue hq;
+
+void setUp(void) {
+    historyQueueInit(&hq);
+}
+
+void tearDown(void) {
+}
+
+static void test_record_make(void) {
+    BaleRecord rec;
+    baleRecordMake(&rec, 100, -1, 12);
+    TEST_ASSERT_EQUAL_UINT16(BALE_INTERVAL_UNKNOWN, rec.interval_s);
+    baleRecordMake(&rec, 100, 100, 70000);
+    TEST_ASSERT_EQUAL_UINT16(1, rec.interval_s);           // Sub-second, not unknown
+    TEST_ASSERT_EQUAL_UINT16(0xFFFF, rec.flakes);
+    baleRecordMake(&rec, 100000, 0, -3);
+    TEST_ASSERT_EQUAL_UINT16(BALE_INTERVAL_MAX, rec.interval_s);
+    TEST_ASSERT_EQUAL_UINT16(0, rec.flakes);
+}
+
+static void test_record_format(void) {
+    BaleRecord rec;
+    char buf[16];
+    baleRecordMake(&rec, 3 * 3600 + 125, 3 * 3600 + 125 - 4000, 14);
+    baleRecordFormatTime(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("3:02", buf);
+    baleRecordFormatInterval(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("1:06:40", buf);
+    baleRecordMake(&rec, 200, 125, 14);
+    baleRecordFormatInterval(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("1:15", buf);
+    baleRecordMake(&rec, 200, -1, 14);
+    baleRecordFormatInterval(&rec, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("-", buf);
+}
+
+static uint32_t records_in_file = 50;
+
+static uint32_t loadRecords(void *ctx, uint32_t first, BaleRecord *out, uint32_t n) {
+    uint32_t *loads = (uint32_t *)ctx;
+    uint32_t got = 0;
+    for (uint32_t i = first; i < records_in_file && got < n; i++, got++) {
+        baleRecordMake(&out[got], i, -1, 0);
+    }
+    (*loads)++;
+    return got;
+}
+
+// A miss loads the window centred on it, a hit reads nothing
+static void test_cache(void) {
+    HistoryCache hc;
+    uint32_t loads = 0;
+    historyCacheInit(&hc, loadRecords, &loads);
+    BaleRecord rec;
+    TEST_ASSERT_TRUE(historyCacheGet(&hc, 40, &rec));
+    TEST_ASSERT_EQUAL_UINT32(40, rec.time_s);
+    TEST_ASSERT_EQUAL_UINT32(40 - HISTORY_CACHE_RECORDS / 2, hc.first);
+    TEST_ASSERT_TRUE(historyCacheGet(&hc, 30, &rec));
+    TEST_ASSERT_TRUE(historyCacheGet(&hc, 49, &rec));
+    TEST_ASSERT_EQUAL_UINT32(1, loads);
+    TEST_ASSERT_FALSE(historyCacheGet(&hc, 50, &rec));
+    TEST_ASSERT_TRUE(historyCacheGet(&hc, 0, &rec));
+    TEST_ASSERT_EQUAL_UINT32(0, rec.time_s);
+    TEST_ASSERT_EQUAL_UINT32(3, loads);
+    historyCacheInvalidate(&hc);
+    TEST_ASSERT_TRUE(historyCacheGet(&hc, 0, &rec));
+    TEST_ASSERT_EQUAL_UINT32(4, loads);
+}
+
+// The writer side as the serial task runs it, with a vector for the file
+struct Writer {
+    std::vector<BaleRecord> file;
+    uint32_t clears_done = 0;
+
+    void applyClears() {
+        uint32_t clears = hq.clears.load(std::memory_order_acquire);
+        if (clears != clears_done) {
+            file.clear();
+            clears_done = clears;
+        }
+    }
+
+    void drain() {
+        applyClears();
+        writeQueued();
+    }
+
+    void writeQueued() {
+        HistoryQueueEntry entry;
+        while (historyQueuePop(&hq, &entry)) {
+            if (entry.epoch != clears_done) {
+                applyClears();
+                if (entry.epoch != clears_done) {
+                    continue;
+                }
+            }
+            file.push_back(entry.rec);
+        }
+    }
+};
+
+static BaleRecord bale(uint32_t n) {
+    BaleRecord rec;
+    baleRecordMake(&rec, n, -1, 0);
+    return rec;
+}
+
+// Records come out in order; a full queue drops and counts the newest
+static void test_queue_order_and_drops(void) {
+    for (uint32_t i = 0; i < HISTORY_QUEUE_SIZE + 3; i++) {
+        BaleRecord rec = bale(i);
+        TEST_ASSERT_EQUAL(i < HISTORY_QUEUE_SIZE, historyQueuePush(&hq, &rec));
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, hq.dropped.load());
+    Writer w;
+    w.drain();
+    TEST_ASSERT_EQUAL(HISTORY_QUEUE_SIZE, w.file.size());
+    for (uint32_t i = 0; i < HISTORY_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, w.file[i].time_s);
+    }
+    BaleRecord out = bale(99);
+    TEST_ASSERT_TRUE(historyQueuePush(&hq, &out));   // Room again after the drain
+}
+
+// Bales queued before a clear are dropped, bales after it are written, even
+// when the clear lands while the writer is part way through the queue
+static void test_queue_clear(void) {
+    Writer w;
+    BaleRecord rec = bale(1);
+    historyQueuePush(&hq, &rec);
+    w.drain();
+    rec = bale(2);
+    historyQueuePush(&hq, &rec);
+    historyQueueClear(&hq);
+    rec = bale(3);
+    historyQueuePush(&hq, &rec);
+    w.drain();
+    TEST_ASSERT_EQUAL(1, w.file.size());
+    TEST_ASSERT_EQUAL_UINT32(3, w.file[0].time_s);
+
+    // Clear requested after the writer checked but before it popped
+    rec = bale(4);
+    historyQueuePush(&hq, &rec);
+    w.applyClears();
+    historyQueueClear(&hq);
+    historyQueueClear(&hq);
+    rec = bale(5);
+    historyQueuePush(&hq, &rec);
+    HistoryQueueEntry entry;
+    w.writeQueued();
+    TEST_ASSERT_EQUAL(1, w.file.size());
+    TEST_ASSERT_EQUAL_UINT32(5, w.file[0].time_s);
+    TEST_ASSERT_FALSE(historyQueuePop(&hq, &entry));
+}
+
+// One producer and one consumer thread: every record arrives once and in
+// order, or is counted as dropped
+static void test_queue_threads(void) {
+    const uint32_t total = 200000;
+    std::vector<uint32_t> got;
+    got.reserve(total);
+    std::thread consumer([&] {
+        HistoryQueueEntry entry;
+        for (;;) {
+            if (historyQueuePop(&hq, &entry)) {
+                if (entry.rec.time_s == UINT32_MAX) {
+                    break;
+                }
+                got.push_back(entry.rec.time_s);
+            }
+        }
+    });
+    for (uint32_t i = 0; i < total; i++) {
+        BaleRecord rec = bale(i);
+        historyQueuePush(&hq, &rec);
+    }
+    uint32_t dropped = hq.dropped.load();
+    BaleRecord end = bale(UINT32_MAX);
+    while (!historyQueuePush(&hq, &end)) {
+    }
+    consumer.join();
+
+    for (size_t i = 1; i < got.size(); i++) {
+        TEST_ASSERT_GREATER_THAN(got[i - 1], got[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(total, got.size() + dropped);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_record_make);
+    RUN_TEST(test_record_format);
+    RUN_TEST(test_cache);
+    RUN_TEST(test_queue_order_and_drops);
+    RUN_TEST(test_queue_clear);
+    RUN_TEST(test_queue_threads);
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+// Host tests of the console input and the history export (src/console.h),
+// and of tools/console.py against them
+//
+// The tool tests run console.py from the project root (where pio test runs
+// the program) on a pseudo-terminal. The test plays the unit on the other
+// end: it reads the commands with consoleInputFeed() and answers history
+// requests with chunks from historyChunkEncode(), like consoleHistory() in
+// main.cpp. Linux or macOS, like console.py.
+
+#include <unity.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "console.h"
+
+#define TOOL_TIMEOUT_MS 20000
+#define WALL_CLOCK 1700000000UL
+
+// The unit's side of the link
+struct Peer {
+    std::vector<BaleRecord> records;
+    int32_t corrupt_chunk;              // First record of a chunk to send once with a bad byte, or -1
+    std::vector<std::string> commands;  // As received
+};
+
+static Peer peer;
+static char work_dir[64];
+static std::string csv_path;
+
+void setUp(void) {
+    peer.records.clear();
+    peer.corrupt_chunk = -1;
+    peer.commands.clear();
+    strcpy(work_dir, "/tmp/balecounter_console_XXXXXX");
+    TEST_ASSERT_NOT_NULL(mkdtemp(work_dir));
+    csv_path = std::string(work_dir) + "/bales.csv";
+}
+
+void tearDown(void) {
+    std::string cmd = std::string("rm -rf ") + work_dir;
+    system(cmd.c_str());
+}
+
+// A bale every 75 s from start_s, 10 to 14 flakes each
+static void addBales(uint32_t n, uint32_t start_s) {
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t t = start_s + i * 75;
+        BaleRecord rec;
+        baleRecordMake(&rec, t, i > 0 ? (int64_t)t - 75 : -1, 10 + i % 5);
+        peer.records.push_back(rec);
+    }
+}
+
+static void writeAll(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        TEST_ASSERT_GREATER_THAN(0, n);
+        data += n;
+        len -= (size_t)n;
+    }
+}
+
+static void reply(int fd, const char *text) {
+    writeAll(fd, text, strlen(text));
+}
+
+// Answer one command the way runConsoleCommand() does
+static void answer(int fd, char *line) {
+    peer.commands.push_back(line);
+    char *argv[CONSOLE_MAX_ARGS];
+    int argc = consoleSplit(line, argv, CONSOLE_MAX_ARGS);
+    uint32_t value = 0;
+    char text[96];
+    uint32_t count = (uint32_t)peer.records.size();
+    uint32_t season_s = count > 0 ? peer.records.back().time_s + 30 : 0;
+
+    if (argc == 2 && strcmp(argv[0], "time") == 0 && consoleParseU32(argv[1], &value)) {
+        snprintf(text, sizeof(text), "@time %lu\n@ok\n", (unsigned long)value);
+        reply(fd, text);
+    } else if (argc <= 2 && strcmp(argv[0], "history") == 0) {
+        if (argc == 2 && !consoleParseU32(argv[1], &value)) {
+            reply(fd, "@err cursor must be a record number\n");
+            return;
+        }
+        if (value > count) {
+            snprintf(text, sizeof(text), "@err cursor past the last record (%lu)\n", (unsigned long)count);
+            reply(fd, text);
+            return;
+        }
+        // A log line the tool has to skip
+        reply(fd, "[    12.345] I Bale count incremented to: 57, yearly: 1204\n");
+        snprintf(text, sizeof(text), "@history %lu\n", (unsigned long)count);
+        reply(fd, text);
+        static char chunk[HISTORY_CHUNK_MAX];
+        for (uint32_t cursor = value; cursor < count;) {
+            uint32_t n = count - cursor;
+            if (n > HISTORY_CHUNK_RECORDS) n = HISTORY_CHUNK_RECORDS;
+            size_t len = historyChunkEncode(chunk, cursor, &peer.records[cursor], n);
+            if ((int32_t)cursor == peer.corrupt_chunk) {
+                chunk[len - 3] ^= 0x40;   // A flipped bit on the line
+                peer.corrupt_chunk = -1;
+            }
+            writeAll(fd, chunk, len);
+            cursor += n;
+        }
+        snprintf(text, sizeof(text), "@end %lu %lu %lu\n@ok\n", (unsigned long)count, (unsigned long)season_s,
+                 (unsigned long)(WALL_CLOCK + season_s));
+        reply(fd, text);
+    } else {
+        snprintf(text, sizeof(text), "@err unknown command %s, try help\n", argv[0]);
+        reply(fd, text);
+    }
+}
+
+// Run "python3 tools/console.py <pty> <args>" against the peer. Returns the
+// exit status; the tool's output goes to *out.
+static int runTool(const char *args, std::string *out) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, master);
+    TEST_ASSERT_EQUAL(0, grantpt(master));
+    TEST_ASSERT_EQUAL(0, unlockpt(master));
+    std::string out_path = std::string(work_dir) + "/out.txt";
+    std::string cmd = std::string("python3 tools/console.py ") + ptsname(master) + " " + args + " > " + out_path + " 2>&1";
+
+    pid_t pid = fork();
+    TEST_ASSERT_GREATER_OR_EQUAL(0, pid);
+    if (pid == 0) {
+        close(master);
+        execl("/bin/sh", "sh", "-c", cmd.c_str(), (char *)NULL);
+        _exit(127);
+    }
+
+    ConsoleInput in;
+    consoleInputInit(&in);
+    int status = -1;
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (;;) {
+        if (waitpid(pid, &status, WNOHANG) == pid) {
+            break;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000 > TOOL_TIMEOUT_MS) {
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            TEST_FAIL_MESSAGE("console.py did not finish");
+        }
+        struct pollfd pfd = {master, POLLIN, 0};
+        if (poll(&pfd, 1, 20) <= 0 || !(pfd.revents & POLLIN)) {
+            continue;
+        }
+        char buf[256];
+        ssize_t n = read(master, buf, sizeof(buf));
+        for (ssize_t i = 0; i < n; i++) {
+            if (consoleInputFeed(&in, buf[i])) {
+                answer(master, in.line);
+            }
+        }
+    }
+    close(master);
+
+    out->clear();
+    FILE *f = fopen(out_path.c_str(), "r");
+    TEST_ASSERT_NOT_NULL(f);
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        *out += line;
+    }
+    fclose(f);
+    std::string shown = *out;
+    while (!shown.empty() && shown[shown.size() - 1] == '\n') {
+        shown.erase(shown.size() - 1);
+    }
+    TEST_MESSAGE(shown.c_str());
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static std::string syncArgs() {
+    return "sync " + csv_path;
+}
+
+static std::vector<std::string> csvRows() {
+    std::vector<std::string> rows;
+    FILE *f = fopen(csv_path.c_str(), "r");
+    TEST_ASSERT_NOT_NULL(f);
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line[strcspn(line, "\r\n")] = 0;
+        rows.push_back(line);
+    }
+    fclose(f);
+    return rows;
+}
+
+// "bale,season_s,..." for the CSV row of the peer's record i
+static std::string rowStart(uint32_t bale, uint32_t i) {
+    char text[48];
+    snprintf(text, sizeof(text), "%lu,%lu,%u,", (unsigned long)bale, (unsigned long)peer.records[i].time_s,
+             (unsigned)peer.records[i].flakes);
+    return text;
+}
+
+static bool startsWith(const std::string &s, const std::string &prefix) {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+static void test_chunk_encode(void) {
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32Update(0, "123456789", 9));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32Update(crc32Update(0, "1234", 4), "56789", 5));
+
+    BaleRecord recs[2];
+    baleRecordMake(&recs[0], 100, -1, 12);
+    baleRecordMake(&recs[1], 175, 100, 13);
+    char buf[HISTORY_CHUNK_MAX];
+    size_t len = historyChunkEncode(buf, 7, recs, 2);
+    char header[HISTORY_CHUNK_HEADER_MAX];
+    snprintf(header, sizeof(header), "@chunk 7 2 %08lx\n", (unsigned long)crc32Update(0, recs, sizeof(recs)));
+    TEST_ASSERT_EQUAL(strlen(header) + sizeof(recs), len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(header, buf, strlen(header)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(recs, buf + strlen(header), sizeof(recs)));
+}
+
+// A first sync with a damaged chunk, then a sync that asks only for the new bales
+static void test_sync_retry_and_resume(void) {
+    std::string out;
+    addBales(150, 1000);
+    peer.corrupt_chunk = 64;
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_EQUAL(3, peer.commands.size());
+    TEST_ASSERT_TRUE(startsWith(peer.commands[0], "time "));
+    TEST_ASSERT_EQUAL_STRING("history 0", peer.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("history 64", peer.commands[2].c_str());   // From the bad chunk on
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("failed its CRC"));
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("150 new bales, 150 in the season"));
+
+    std::vector<std::string> rows = csvRows();
+    TEST_ASSERT_EQUAL(151, rows.size());
+    TEST_ASSERT_EQUAL_STRING("bale,season_s,flakes,interval_s,approx_time", rows[0].c_str());
+    for (uint32_t i = 0; i < 150; i++) {
+        TEST_ASSERT_TRUE(startsWith(rows[i + 1], rowStart(i + 1, i)));
+    }
+
+    // 30 more bales: the sync reads back the last one it has, then the new ones
+    peer.commands.clear();
+    addBales(30, peer.records.back().time_s + 600);
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_EQUAL(2, peer.commands.size());
+    TEST_ASSERT_EQUAL_STRING("history 149", peer.commands[1].c_str());
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("30 new bales, 180 in the season"));
+    rows = csvRows();
+    TEST_ASSERT_EQUAL(181, rows.size());
+    TEST_ASSERT_TRUE(startsWith(rows[151], rowStart(151, 150)));
+    TEST_ASSERT_TRUE(startsWith(rows[180], rowStart(180, 179)));
+
+    // Nothing new
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("0 new bales, 180 in the season"));
+    TEST_ASSERT_EQUAL(181, csvRows().size());
+}
+
+// A cleared history starts the sync again from the first bale, whether the
+// unit now has fewer bales than the cursor or as many but different ones
+static void test_sync_cleared(void) {
+    std::string out;
+    addBales(100, 1000);
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_EQUAL(101, csvRows().size());
+
+    peer.records.clear();
+    peer.commands.clear();
+    addBales(20, 50);
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_EQUAL(3, peer.commands.size());
+    TEST_ASSERT_EQUAL_STRING("history 99", peer.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("history 0", peer.commands[2].c_str());
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("was cleared"));
+    std::vector<std::string> rows = csvRows();
+    TEST_ASSERT_EQUAL(121, rows.size());
+    TEST_ASSERT_TRUE(startsWith(rows[101], rowStart(1, 0)));
+    TEST_ASSERT_TRUE(startsWith(rows[120], rowStart(20, 19)));
+
+    // Cleared and refilled past the cursor: the record at the cursor differs
+    peer.records.clear();
+    peer.commands.clear();
+    addBales(40, 2000);
+    TEST_ASSERT_EQUAL(0, runTool(syncArgs().c_str(), &out));
+    TEST_ASSERT_EQUAL_STRING("history 19", peer.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("history 0", peer.commands[2].c_str());
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("40 new bales, 40 in the season"));
+    TEST_ASSERT_EQUAL(161, csvRows().size());
+}
+
+// bench reads the whole history, a bad chunk included, and saves nothing
+static void test_bench(void) {
+    std::string out;
+    addBales(1000, 1000);
+    peer.corrupt_chunk = 640;
+    TEST_ASSERT_EQUAL(0, runTool("bench", &out));
+    TEST_ASSERT_EQUAL(2, peer.commands.size());
+    TEST_ASSERT_EQUAL_STRING("history 640", peer.commands[1].c_str());
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, out.find("1000 records"));
+    TEST_ASSERT_NULL(fopen(csv_path.c_str(), "r"));
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_chunk_encode);
+    RUN_TEST(test_sync_retry_and_resume);
+    RUN_TEST(test_sync_cleared);
+    RUN_TEST(test_bench);
+    return UNITY_END();
+}
@@ -0,0 +1,140 @@
+// Host tests of the bale target forecast (src/forecast.h)
+
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "forecast.h"
+
+static BaleForecast fc;
+
+void setUp(void) {
+    forecastInit(&fc, 100, 0);
+}
+
+void tearDown(void) {
+}
+
+// The first interval is taken as is, later ones are smoothed in
+static void test_smoothing(void) {
+    forecastOnBale(&fc, 1, 1000);
+    TEST_ASSERT_FALSE(fc.eta_valid);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, forecastBalesPerHour(&fc));
+
+    forecastOnBale(&fc, 2, 61000);
+    TEST_ASSERT_EQUAL_FLOAT(60000.0f, fc.smoothed_interval_ms);
+    TEST_ASSERT_EQUAL_FLOAT(60.0f, forecastBalesPerHour(&fc));
+
+    forecastOnBale(&fc, 3, 61000 + 90000);
+    TEST_ASSERT_EQUAL_FLOAT(60000.0f + FORECAST_SMOOTHING * 30000.0f, fc.smoothed_interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, fc.intervals_seen);
+}
+
+// Breaks longer than FORECAST_MAX_INTERVAL_MS don't change the rate
+static void test_break_skipped(void) {
+    forecastOnBale(&fc, 1, 0);
+    forecastOnBale(&fc, 2, 60000);
+    forecastOnBale(&fc, 3, 60000 + FORECAST_MAX_INTERVAL_MS + 1);
+    TEST_ASSERT_EQUAL_FLOAT(60000.0f, fc.smoothed_interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, fc.intervals_seen);
+    TEST_ASSERT_EQUAL_UINT32(97, fc.remaining);
+}
+
+// The ETA counts down between bales but never past the bale in progress
+static void test_eta_ticks(void) {
+    forecastOnBale(&fc, 98, 0);
+    forecastOnBale(&fc, 99, 60000);
+    TEST_ASSERT_TRUE(fc.eta_valid);
+    TEST_ASSERT_EQUAL_UINT32(60000, fc.eta_ms);
+
+    forecastTick(&fc, 60000 + 20000);
+    TEST_ASSERT_EQUAL_UINT32(40000, fc.eta_ms);
+
+    // Overdue: the ETA holds at 0 instead of wrapping
+    forecastTick(&fc, 60000 + 200000);
+    TEST_ASSERT_TRUE(fc.eta_valid);
+    TEST_ASSERT_EQUAL_UINT32(0, fc.eta_ms);
+}
+
+// Reaching the target, no target, and a new target keep the rate
+static void test_targets(void) {
+    forecastOnBale(&fc, 99, 0);
+    forecastOnBale(&fc, 100, 60000);
+    TEST_ASSERT_EQUAL_UINT32(0, fc.remaining);
+    TEST_ASSERT_TRUE(fc.eta_valid);
+    TEST_ASSERT_EQUAL_UINT32(0, fc.eta_ms);
+
+    forecastSetTarget(&fc, 0, 100, 60000);
+    TEST_ASSERT_FALSE(fc.eta_valid);
+
+    forecastSetTarget(&fc, 110, 100, 60000);
+    TEST_ASSERT_EQUAL_UINT32(10, fc.remaining);
+    TEST_ASSERT_EQUAL_UINT32(600000, fc.eta_ms);
+
+    forecastResetRate(&fc, 100);
+    TEST_ASSERT_FALSE(fc.eta_valid);
+    TEST_ASSERT_EQUAL_UINT32(110, fc.target);
+}
+
+// The millis() counter wraps after 49 days
+static void test_millis_wrap(void) {
+    forecastOnBale(&fc, 1, 0xFFFFFFFFUL - 29999);
+    forecastOnBale(&fc, 2, 30000);
+    TEST_ASSERT_EQUAL_FLOAT(60000.0f, fc.smoothed_interval_ms);
+}
+
+// Synthetic session: 90 s +-30 s between bales with a break at bale 40.
+// Halfway through, the ETA should be within 10% of the real finish.
+static void test_synthetic_session_accuracy(void) {
+    const uint32_t target = 80;
+    uint32_t times[target + 1];
+    uint32_t now = 0;
+    for (uint32_t i = 1; i <= target; i++) {
+        now += 90000 + (i * 7919) % 60001 - 30000;
+        if (i == 40) {
+            now += 20UL * 60UL * 1000UL;
+        }
+        times[i] = now;
+    }
+
+    forecastInit(&fc, target, 0);
+    uint32_t eta_at_half = 0;
+    for (uint32_t i = 1; i <= target; i++) {
+        forecastOnBale(&fc, i, times[i]);
+        if (i == 50) {
+            eta_at_half = fc.eta_ms;
+        }
+    }
+    float actual = (float)(times[target] - times[50]);
+    TEST_ASSERT_FLOAT_WITHIN(actual * 0.1f, actual, (float)eta_at_half);
+    TEST_ASSERT_EQUAL_UINT32(0, fc.remaining);
+}
+
+// Each update is O(1): time a long session of bales and ticks
+static void test_update_cost(void) {
+    const uint32_t n = 1000000;
+    forecastInit(&fc, n, 0);
+    clock_t start = clock();
+    for (uint32_t i = 1; i <= n; i++) {
+        forecastOnBale(&fc, i, i * 75000UL);
+        forecastTick(&fc, i * 75000UL + 5000);
+    }
+    double ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / n;
+    char msg[64];
+    snprintf(msg, sizeof(msg), "%.1f ns per bale and tick", ns);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_THAN(1000.0, ns);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_smoothing);
+    RUN_TEST(test_break_skipped);
+    RUN_TEST(test_eta_ticks);
+    RUN_TEST(test_targets);
+    RUN_TEST(test_millis_wrap);
+    RUN_TEST(test_synthetic_session_accuracy);
+    RUN_TEST(test_update_cost);
+    return UNITY_END();
+}
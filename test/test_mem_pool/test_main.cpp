@@ -0,0 +1,224 @@
+// Host tests of the LVGL pool allocator (src/mem_pool.h), with a soak of
+// random allocs, frees and reallocs checked by memPoolCheck()
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "mem_pool.h"
+
+#define POOL_BYTES (48U * 1024U)
+#define SOAK_OPS 200000
+#define SOAK_SLOTS 192
+#define SOAK_CHECK_EVERY 64
+
+static uint64_t arena[POOL_BYTES / sizeof(uint64_t) + 1];
+static MemPool pool;
+
+void setUp(void) {
+    memPoolInit(&pool, arena, POOL_BYTES);
+}
+
+void tearDown(void) {
+}
+
+static uint32_t rng_state;
+
+// xorshift32, so the soak is the same on every run
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static bool aligned8(const void *p) {
+    return ((uintptr_t)p & 7U) == 0;
+}
+
+// Every pointer is 8-byte aligned, whatever the sizes before it
+static void test_alignment(void) {
+    for (size_t size = 0; size < 100; size++) {
+        void *p = memPoolAlloc(&pool, size);
+        TEST_ASSERT_NOT_NULL(p);
+        TEST_ASSERT_TRUE(aligned8(p));
+    }
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+
+    // Also from an arena that doesn't start on an 8-byte boundary
+    memPoolInit(&pool, (uint8_t *)arena + 4, POOL_BYTES - 4);
+    void *a = memPoolAlloc(&pool, 3);
+    void *b = memPoolAlloc(&pool, 20);
+    TEST_ASSERT_TRUE(aligned8(a));
+    TEST_ASSERT_TRUE(aligned8(b));
+    b = memPoolRealloc(&pool, b, 300);
+    TEST_ASSERT_TRUE(aligned8(b));
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+}
+
+// Freed neighbours merge back into one block
+static void test_merge(void) {
+    MemPoolStats start, stats;
+    memPoolGetStats(&pool, &start);
+    TEST_ASSERT_EQUAL_UINT32(1, start.free_blocks);
+
+    void *p[8];
+    for (int i = 0; i < 8; i++) {
+        p[i] = memPoolAlloc(&pool, 40 + i * 8);
+    }
+    for (int i = 0; i < 8; i += 2) {
+        memPoolFree(&pool, p[i]);
+    }
+    memPoolGetStats(&pool, &stats);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.free_blocks);   // Four holes and the tail
+    for (int i = 1; i < 8; i += 2) {
+        memPoolFree(&pool, p[i]);
+    }
+    memPoolGetStats(&pool, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.free_blocks);
+    TEST_ASSERT_EQUAL_UINT32(start.largest_free, stats.largest_free);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.live_bytes);
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+}
+
+// A realloc grows into the free block after it, and moves with its data if it can't
+static void test_realloc(void) {
+    uint8_t *a = (uint8_t *)memPoolAlloc(&pool, 24);
+    memset(a, 0x5A, 24);
+    uint8_t *grown = (uint8_t *)memPoolRealloc(&pool, a, 200);
+    TEST_ASSERT_EQUAL_PTR(a, grown);
+
+    void *wall = memPoolAlloc(&pool, 8);
+    uint8_t *moved = (uint8_t *)memPoolRealloc(&pool, grown, 400);
+    TEST_ASSERT_NOT_EQUAL(grown, moved);
+    for (int i = 0; i < 24; i++) {
+        TEST_ASSERT_EQUAL_UINT8(0x5A, moved[i]);
+    }
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+    memPoolFree(&pool, wall);
+    memPoolFree(&pool, moved);
+    TEST_ASSERT_NULL(memPoolAlloc(&pool, POOL_BYTES));
+    TEST_ASSERT_EQUAL_UINT32(1, pool.failed);
+}
+
+// A write past the end of a block is found by the block walk
+static void test_check_finds_overrun(void) {
+    uint8_t *a = (uint8_t *)memPoolAlloc(&pool, 20);
+    memPoolAlloc(&pool, 20);
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+    memset(a, 0, 28);
+    TEST_ASSERT_FALSE(memPoolCheck(&pool));
+}
+
+struct SoakSlot {
+    uint8_t *ptr;
+    uint32_t size;
+    uint8_t fill;
+};
+
+static void fillSlot(SoakSlot *s) {
+    memset(s->ptr, s->fill, s->size);
+}
+
+static bool slotIntact(const SoakSlot *s, uint32_t bytes) {
+    for (uint32_t i = 0; i < bytes; i++) {
+        if (s->ptr[i] != s->fill) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// LVGL-like sizes: mostly small objects and styles, some labels and buffers
+static uint32_t soakSize(void) {
+    uint32_t r = rng() % 100;
+    if (r < 70) return 1 + rng() % 64;
+    if (r < 97) return 64 + rng() % 448;
+    return 512 + rng() % 1536;
+}
+
+// Random allocs, frees and reallocs with every block filled and checked, so
+// an overlap or a lost byte shows up. The pool walk runs every 64 steps.
+static void test_soak(void) {
+    static SoakSlot slots[SOAK_SLOTS];
+    memset(slots, 0, sizeof(slots));
+    rng_state = 0x2545F491;
+    uint32_t allocs = 0, frees = 0, reallocs = 0, failed = 0, max_frag = 0;
+
+    for (uint32_t op = 1; op <= SOAK_OPS; op++) {
+        SoakSlot *s = &slots[rng() % SOAK_SLOTS];
+        uint32_t action = rng() % 3;
+        if (s->ptr == NULL) {
+            s->size = soakSize();
+            s->ptr = (uint8_t *)memPoolAlloc(&pool, s->size);
+            if (s->ptr == NULL) {
+                failed++;
+                continue;
+            }
+            TEST_ASSERT_TRUE(aligned8(s->ptr));
+            s->fill = (uint8_t)op;
+            fillSlot(s);
+            allocs++;
+        } else if (action == 0) {
+            uint32_t size = soakSize();
+            uint8_t *p = (uint8_t *)memPoolRealloc(&pool, s->ptr, size);
+            if (p == NULL) {
+                failed++;   // The old block is kept
+                TEST_ASSERT_TRUE(slotIntact(s, s->size));
+                continue;
+            }
+            TEST_ASSERT_TRUE(aligned8(p));
+            s->ptr = p;
+            TEST_ASSERT_TRUE(slotIntact(s, size < s->size ? size : s->size));
+            s->size = size;
+            fillSlot(s);
+            reallocs++;
+        } else {
+            TEST_ASSERT_TRUE(slotIntact(s, s->size));
+            memPoolFree(&pool, s->ptr);
+            s->ptr = NULL;
+            frees++;
+        }
+        if (op % SOAK_CHECK_EVERY == 0) {
+            TEST_ASSERT_TRUE(memPoolCheck(&pool));
+            MemPoolStats stats;
+            memPoolGetStats(&pool, &stats);
+            if (stats.frag_pct > max_frag) max_frag = stats.frag_pct;
+        }
+    }
+
+    for (int i = 0; i < SOAK_SLOTS; i++) {
+        if (slots[i].ptr != NULL) {
+            TEST_ASSERT_TRUE(slotIntact(&slots[i], slots[i].size));
+            memPoolFree(&pool, slots[i].ptr);
+        }
+    }
+    MemPoolStats stats;
+    memPoolGetStats(&pool, &stats);
+    TEST_ASSERT_TRUE(memPoolCheck(&pool));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.live_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.free_blocks);
+    uint32_t class_live = 0;
+    for (int c = 0; c < MEM_POOL_CLASSES; c++) {
+        class_live += stats.classes[c].live;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, class_live);
+    TEST_ASSERT_EQUAL_UINT32(0, failed);   // The peak stays well under the pool
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%lu allocs, %lu frees, %lu reallocs, %lu failed, peak %lu bytes, worst frag %lu%%",
+             (unsigned long)allocs, (unsigned long)frees, (unsigned long)reallocs, (unsigned long)failed,
+             (unsigned long)stats.peak_bytes, (unsigned long)max_frag);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_alignment);
+    RUN_TEST(test_merge);
+    RUN_TEST(test_realloc);
+    RUN_TEST(test_check_finds_overrun);
+    RUN_TEST(test_soak);
+    return UNITY_END();
+}
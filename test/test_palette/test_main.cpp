@@ -0,0 +1,97 @@
+// Host tests of the RGB332 palette and the flush's expansion loop (src/palette.h)
+
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "palette.h"
+
+// One 8-bit draw buffer (1/5 of the 320x240 screen), as in main.cpp
+#define BUF_PX (320 * 240 / 5)
+#define BENCH_ROUNDS 200
+
+static uint16_t lut[PALETTE_SIZE];
+
+void setUp(void) {
+    paletteBuildLut(lut);
+}
+
+void tearDown(void) {
+}
+
+static uint16_t unswap(uint16_t v) {
+    return (uint16_t)((v >> 8) | (v << 8));
+}
+
+// Black, white and the primaries land on the exact RGB565 values
+static void test_primaries(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x0000, unswap(lut[0x00]));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, unswap(lut[0xFF]));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, unswap(lut[0xE0]));   // Red
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, unswap(lut[0x1C]));   // Green
+    TEST_ASSERT_EQUAL_HEX16(0x001F, unswap(lut[0x03]));   // Blue
+}
+
+// The table is in panel byte order: the high byte of RGB565 comes first in
+// memory, which LV_COLOR_16_SWAP does for the 16-bit buffers
+static void test_byte_swap(void) {
+    const uint8_t *bytes = (const uint8_t *)&lut[0xE0];
+    TEST_ASSERT_EQUAL_HEX8(0xF8, bytes[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, bytes[1]);
+    bytes = (const uint8_t *)&lut[0x03];
+    TEST_ASSERT_EQUAL_HEX8(0x00, bytes[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x1F, bytes[1]);
+}
+
+// Every code: each channel is the RGB332 level scaled down, never more than
+// one RGB565 step off the exact value
+static void test_every_code(void) {
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        uint16_t c = unswap(lut[i]);
+        int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        int r3 = (i >> 5) & 7, g3 = (i >> 2) & 7, b2 = i & 3;
+        TEST_ASSERT_EQUAL(r3 * 31 / 7, r);
+        TEST_ASSERT_EQUAL(g3 * 63 / 7, g);
+        TEST_ASSERT_EQUAL(b2 * 31 / 3, b);
+        TEST_ASSERT_LESS_THAN(1.0, r3 * 31.0 / 7 - r);
+        TEST_ASSERT_LESS_THAN(1.0, g3 * 63.0 / 7 - g);
+        TEST_ASSERT_LESS_THAN(1.0, b2 * 31.0 / 3 - b);
+    }
+}
+
+// The expansion of a whole draw buffer, and its cost per pixel
+static void test_expand(void) {
+    static uint8_t src[BUF_PX];
+    static uint16_t dst[BUF_PX];
+    for (uint32_t i = 0; i < BUF_PX; i++) {
+        src[i] = (uint8_t)(i * 37 + (i >> 7));
+    }
+    paletteExpand(dst, src, BUF_PX, lut);
+    for (uint32_t i = 0; i < BUF_PX; i++) {
+        TEST_ASSERT_EQUAL_HEX16(lut[src[i]], dst[i]);
+    }
+
+    uint32_t sum = 0;
+    clock_t start = clock();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        src[round] ^= 0x55;   // So the loop isn't hoisted out
+        paletteExpand(dst, src, BUF_PX, lut);
+        sum += dst[round];
+    }
+    double ns_per_px = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / ((double)BUF_PX * BENCH_ROUNDS);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%.2f ns/px, %.0f us per full 320x240 redraw on the host (check %lu)", ns_per_px,
+             ns_per_px * 320 * 240 / 1000, (unsigned long)(sum & 0xFF));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_primaries);
+    RUN_TEST(test_byte_swap);
+    RUN_TEST(test_every_code);
+    RUN_TEST(test_expand);
+    return UNITY_END();
+}
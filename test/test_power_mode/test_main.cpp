@@ -0,0 +1,96 @@
+// Host tests of the display power state machine (src/power_mode.h)
+
+#include <unity.h>
+#include "power_mode.h"
+
+static PowerState ps;
+
+void setUp(void) {
+    powerInit(&ps, 1000, POWER_IDLE_TIMEOUT_MS);
+}
+
+void tearDown(void) {
+}
+
+// No activity for the timeout turns the display off, once
+static void test_idle_after_timeout(void) {
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, ps.mode);
+    TEST_ASSERT_FALSE(powerTick(&ps, 1000 + POWER_IDLE_TIMEOUT_MS - 1));
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, ps.mode);
+    TEST_ASSERT_TRUE(powerTick(&ps, 1000 + POWER_IDLE_TIMEOUT_MS));
+    TEST_ASSERT_EQUAL(POWER_IDLE, ps.mode);
+    TEST_ASSERT_FALSE(powerTick(&ps, 1000 + 2 * POWER_IDLE_TIMEOUT_MS));
+}
+
+// A touch or bale restarts the timeout, and wakes the display only from idle
+static void test_activity(void) {
+    TEST_ASSERT_FALSE(powerOnActivity(&ps, 500000));
+    TEST_ASSERT_FALSE(powerTick(&ps, 1000 + POWER_IDLE_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(powerTick(&ps, 500000 + POWER_IDLE_TIMEOUT_MS));
+
+    TEST_ASSERT_TRUE(powerOnActivity(&ps, 900000));
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, ps.mode);
+    TEST_ASSERT_FALSE(powerOnActivity(&ps, 900000));
+    TEST_ASSERT_FALSE(powerTick(&ps, 900000 + POWER_IDLE_TIMEOUT_MS - 1));
+    TEST_ASSERT_TRUE(powerTick(&ps, 900000 + POWER_IDLE_TIMEOUT_MS));
+}
+
+// A timeout of 0 keeps the display on
+static void test_idle_disabled(void) {
+    powerInit(&ps, 0, 0);
+    TEST_ASSERT_FALSE(powerTick(&ps, 0xF0000000UL));
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, ps.mode);
+}
+
+// Only idle waits long enough to be worth it are slept
+static void test_can_sleep(void) {
+    TEST_ASSERT_FALSE(powerCanSleep(&ps, 1000));
+    powerTick(&ps, 1000 + POWER_IDLE_TIMEOUT_MS);
+    TEST_ASSERT_FALSE(powerCanSleep(&ps, POWER_MIN_SLEEP_MS - 1));
+    TEST_ASSERT_TRUE(powerCanSleep(&ps, POWER_MIN_SLEEP_MS));
+}
+
+// The timeout still works when millis() wraps
+static void test_millis_wrap(void) {
+    uint32_t start = 0xFFFFFF00UL;
+    powerInit(&ps, start, POWER_IDLE_TIMEOUT_MS);
+    TEST_ASSERT_FALSE(powerTick(&ps, 0x100));
+    TEST_ASSERT_TRUE(powerTick(&ps, start + (uint32_t)POWER_IDLE_TIMEOUT_MS));
+}
+
+// The duty-cycle counters split the time between the modes and restart
+static void test_stats(void) {
+    powerOnWakeup(&ps);
+    powerOnWakeup(&ps);
+    powerTick(&ps, 1000 + POWER_IDLE_TIMEOUT_MS);
+    powerOnWakeup(&ps);
+    powerOnSleep(&ps, 4000);
+    powerOnActivity(&ps, 1000 + POWER_IDLE_TIMEOUT_MS + 5000);
+
+    PowerStats stats;
+    powerTakeStats(&ps, 1000 + POWER_IDLE_TIMEOUT_MS + 6000, &stats);
+    TEST_ASSERT_EQUAL_UINT32(POWER_IDLE_TIMEOUT_MS + 1000, stats.mode_ms[POWER_ACTIVE]);
+    TEST_ASSERT_EQUAL_UINT32(5000, stats.mode_ms[POWER_IDLE]);
+    TEST_ASSERT_EQUAL_UINT32(4000, stats.sleep_ms[POWER_IDLE]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sleep_ms[POWER_ACTIVE]);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.wakeups[POWER_ACTIVE]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.wakeups[POWER_IDLE]);
+
+    powerTakeStats(&ps, 1000 + POWER_IDLE_TIMEOUT_MS + 7000, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1000, stats.mode_ms[POWER_ACTIVE]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mode_ms[POWER_IDLE]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.wakeups[POWER_ACTIVE]);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_after_timeout);
+    RUN_TEST(test_activity);
+    RUN_TEST(test_idle_disabled);
+    RUN_TEST(test_can_sleep);
+    RUN_TEST(test_millis_wrap);
+    RUN_TEST(test_stats);
+    return UNITY_END();
+}
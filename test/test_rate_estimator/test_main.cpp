@@ -0,0 +1,180 @@
+// Host evaluation of the fused bales per hour estimator (src/rate_estimator.h)
+//
+// Plays synthetic sessions through the fused estimator and through the old
+// bale-edge-only rate ((bales - 1) / elapsed), recomputed on every flake
+// and bale like calculateBalesPerHour(). Reports and checks when each first
+// comes within 10% of the true rate, when it stays within 10%, and its
+// mean error after the first 3 bales.
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include "rate_estimator.h"
+
+#define SETTLE_TOLERANCE 0.10f
+
+struct Session {
+    const char *name;
+    uint32_t flake_ms;        // Mean time between flakes
+    uint32_t jitter_pct;      // +- jitter on each flake gap
+    uint32_t flakes;          // Mean flakes per bale (+- 1)
+    uint32_t bales;
+    float seed_fpb;           // Flakes per bale from the saved counts (0 = none)
+};
+
+struct Result {
+    uint32_t first_ms;        // Time of the first estimate within tolerance
+    uint32_t settle_ms;       // Time from which the estimate stays within tolerance
+    float mean_error;         // Mean relative error after the first 3 bales
+};
+
+static uint32_t lcg_state;
+
+static uint32_t nextRandom(uint32_t range) {
+    lcg_state = lcg_state * 1664525UL + 1013904223UL;
+    return (lcg_state >> 8) % range;
+}
+
+// Play a session and score the fused and the bale-edge-only estimates
+static void playSession(const Session *s, Result *fused, Result *edge_only) {
+    RateEstimator re;
+    rateInit(&re, s->seed_fpb);
+    lcg_state = 12345;
+
+    float true_rate = 3600000.0f / ((float)s->flake_ms * s->flakes);
+    uint32_t now = 0, first_bale = 0, last_bale = 0, bales = 0;
+    uint32_t fused_first = 0, edge_first = 0;
+    uint32_t fused_settle = 0, edge_settle = 0;
+    float fused_err = 0.0f, edge_err = 0.0f;
+    uint32_t err_samples = 0;
+
+    for (uint32_t b = 0; b < s->bales; b++) {
+        uint32_t flakes = s->flakes - 1 + nextRandom(3);
+        for (uint32_t f = 0; f < flakes; f++) {
+            uint32_t jitter = s->flake_ms * s->jitter_pct / 100;
+            now += s->flake_ms - jitter + nextRandom(2 * jitter + 1);
+            rateOnFlake(&re, now);
+            bool bale_edge = (f == flakes - 1);
+            if (bale_edge) {
+                rateOnBale(&re, flakes);
+                if (bales == 0) {
+                    first_bale = now;
+                }
+                last_bale = now;
+                bales++;
+            }
+
+            float edge_rate = 0.0f;
+            uint32_t intervals = 0;
+            if (bales > 1 && last_bale > first_bale) {
+                intervals = bales - 1;
+                edge_rate = intervals / ((last_bale - first_bale) / 3600000.0f);
+            }
+            float fused_rate = rateFuse(&re, edge_rate, intervals);
+
+            float fe = fabsf(fused_rate - true_rate) / true_rate;
+            float ee = fabsf(edge_rate - true_rate) / true_rate;
+            if (fe > SETTLE_TOLERANCE) {
+                fused_settle = 0;
+            } else {
+                fused_first = fused_first ? fused_first : now;
+                fused_settle = fused_settle ? fused_settle : now;
+            }
+            if (ee > SETTLE_TOLERANCE) {
+                edge_settle = 0;
+            } else {
+                edge_first = edge_first ? edge_first : now;
+                edge_settle = edge_settle ? edge_settle : now;
+            }
+            if (b >= 3) {
+                fused_err += fe;
+                edge_err += ee;
+                err_samples++;
+            }
+        }
+    }
+    fused->first_ms = fused_first;
+    edge_only->first_ms = edge_first;
+    fused->settle_ms = fused_settle;
+    edge_only->settle_ms = edge_settle;
+    fused->mean_error = err_samples ? fused_err / err_samples : 0.0f;
+    edge_only->mean_error = err_samples ? edge_err / err_samples : 0.0f;
+
+    char msg[200];
+    snprintf(msg, sizeof(msg),
+             "%s: fused first %.0f s, settled %.0f s, error %.1f%%; bale-edge first %.0f s, settled %.0f s, error %.1f%%",
+             s->name, fused->first_ms / 1000.0f, fused->settle_ms / 1000.0f, fused->mean_error * 100.0f,
+             edge_only->first_ms / 1000.0f, edge_only->settle_ms / 1000.0f, edge_only->mean_error * 100.0f);
+    TEST_MESSAGE(msg);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// Flakes per bale known from the saved counts: a rate within seconds
+static void test_seeded_session(void) {
+    const Session s = {"seeded", 2500, 20, 12, 40, 12.0f};
+    Result fused, edge;
+    playSession(&s, &fused, &edge);
+    TEST_ASSERT_LESS_THAN(10000, fused.settle_ms);
+    TEST_ASSERT_GREATER_THAN(45000, edge.settle_ms);
+    TEST_ASSERT_LESS_THAN(SETTLE_TOLERANCE, fused.mean_error);
+}
+
+// First boot, no saved counts: a rate after the first bale instead of the third
+static void test_unseeded_session(void) {
+    const Session s = {"unseeded", 2500, 20, 12, 40, 0.0f};
+    Result fused, edge;
+    playSession(&s, &fused, &edge);
+    TEST_ASSERT_LESS_THAN(edge.settle_ms, fused.settle_ms);
+    TEST_ASSERT_LESS_THAN(45000, fused.settle_ms);
+}
+
+// Saved counts from a different crop (8 flakes per bale, now 16). The
+// flake rate starts at double and is corrected as bales finish, so here
+// the fused rate settles later than the bale-edge rate would.
+static void test_wrong_seed(void) {
+    const Session s = {"wrong seed", 1500, 20, 16, 40, 8.0f};
+    Result fused, edge;
+    playSession(&s, &fused, &edge);
+    TEST_ASSERT_LESS_THAN(180000, fused.settle_ms);
+    TEST_ASSERT_LESS_THAN(SETTLE_TOLERANCE, fused.mean_error);
+}
+
+// +-50% flake jitter: the flake rate is noisy, but the fused rate is
+// close sooner and no less accurate overall
+static void test_noisy_session(void) {
+    const Session s = {"noisy", 3000, 50, 10, 60, 10.0f};
+    Result fused, edge;
+    playSession(&s, &fused, &edge);
+    TEST_ASSERT_LESS_THAN(edge.first_ms, fused.first_ms);
+    TEST_ASSERT_LESS_OR_EQUAL(edge.mean_error + 0.01f, fused.mean_error);
+}
+
+// A stop is skipped by the flake cadence
+static void test_stop(void) {
+    RateEstimator re;
+    rateInit(&re, 12.0f);
+    for (uint32_t t = 0; t <= 25000; t += 2500) {
+        rateOnFlake(&re, t);
+    }
+    float before = rateFlakeBalesPerHour(&re);
+    rateOnFlake(&re, 25000 + RATE_MAX_FLAKE_GAP_MS + 1);
+    TEST_ASSERT_EQUAL_FLOAT(before, rateFlakeBalesPerHour(&re));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 120.0f, before);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_seeded_session);
+    RUN_TEST(test_unseeded_session);
+    RUN_TEST(test_wrong_seed);
+    RUN_TEST(test_noisy_session);
+    RUN_TEST(test_stop);
+    return UNITY_END();
+}
@@ -0,0 +1,129 @@
+// Host tests of the bales per hour trend (src/rate_trend.h)
+
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "rate_trend.h"
+
+static RateTrend rt;
+
+void setUp(void) {
+    rateTrendInit(&rt, 1000);
+}
+
+void tearDown(void) {
+}
+
+// Samples in the same column widen its min/max, only the newest column changes
+static void test_column_min_max(void) {
+    TEST_ASSERT_TRUE(rateTrendAdd(&rt, 45.0f, 1000));     // First sample sets the scale
+    TEST_ASSERT_FALSE(rateTrendAdd(&rt, 38.5f, 21000));
+    TEST_ASSERT_FALSE(rateTrendAdd(&rt, 41.0f, 60999));
+    TEST_ASSERT_EQUAL_UINT16(1, rt.count);
+    TEST_ASSERT_EQUAL_UINT16(385, rt.columns[0].min_tenths);
+    TEST_ASSERT_EQUAL_UINT16(450, rt.columns[0].max_tenths);
+    TEST_ASSERT_EQUAL_UINT16(50, rt.scale);
+
+    TEST_ASSERT_FALSE(rateTrendAdd(&rt, 40.0f, 61000));
+    TEST_ASSERT_EQUAL_UINT16(2, rt.count);
+    TEST_ASSERT_EQUAL_UINT16(400, rt.columns[1].min_tenths);
+}
+
+// The scale grows in steps to fit a new high, and a rate is never negative
+static void test_scale(void) {
+    rateTrendAdd(&rt, 9.0f, 1000);
+    TEST_ASSERT_EQUAL_UINT16(RATE_TREND_SCALE_STEP, rt.scale);
+    uint32_t layout = rt.layout;
+    TEST_ASSERT_TRUE(rateTrendAdd(&rt, 95.2f, 2000));
+    TEST_ASSERT_EQUAL_UINT16(100, rt.scale);
+    TEST_ASSERT_NOT_EQUAL(layout, rt.layout);
+    TEST_ASSERT_FALSE(rateTrendAdd(&rt, 20.0f, 3000));
+
+    rateTrendAdd(&rt, -5.0f, 4000);
+    TEST_ASSERT_EQUAL_UINT16(0, rt.columns[0].min_tenths);
+}
+
+// Columns with no sample (a stop) stay empty, also across a merge of two empties
+static void test_gap_stays_empty(void) {
+    rateTrendAdd(&rt, 40.0f, 1000);
+    rateTrendAdd(&rt, 42.0f, 1000 + 10 * RATE_TREND_FIRST_SPAN_MS);
+    TEST_ASSERT_EQUAL_UINT16(11, rt.count);
+    for (int i = 1; i < 10; i++) {
+        TEST_ASSERT_FALSE(rateTrendColumnUsed(&rt.columns[i]));
+    }
+    TEST_ASSERT_TRUE(rateTrendColumnUsed(&rt.columns[10]));
+
+    // Past the last column: pairs merge, the empty pairs stay empty
+    TEST_ASSERT_TRUE(rateTrendAdd(&rt, 41.0f, 1000 + RATE_TREND_COLUMNS * RATE_TREND_FIRST_SPAN_MS));
+    TEST_ASSERT_EQUAL_UINT32(2 * RATE_TREND_FIRST_SPAN_MS, rt.span_ms);
+    TEST_ASSERT_EQUAL_UINT16(RATE_TREND_COLUMNS / 2 + 1, rt.count);
+    TEST_ASSERT_TRUE(rateTrendColumnUsed(&rt.columns[0]));
+    TEST_ASSERT_FALSE(rateTrendColumnUsed(&rt.columns[2]));
+    TEST_ASSERT_TRUE(rateTrendColumnUsed(&rt.columns[5]));
+    for (int i = rt.count; i < RATE_TREND_COLUMNS; i++) {
+        TEST_ASSERT_FALSE(rateTrendColumnUsed(&rt.columns[i]));
+    }
+}
+
+// A short dip survives every merge instead of being averaged away
+static void test_merge_keeps_dip(void) {
+    const uint32_t day = 14UL * 3600000UL;
+    for (uint32_t t = 0; t < day; t += 60000) {
+        bool dip = t >= 5UL * 3600000UL && t < 5UL * 3600000UL + 60000;
+        rateTrendAdd(&rt, dip ? 12.0f : 50.0f, 1000 + t);
+    }
+    uint16_t lowest = UINT16_MAX;
+    int dips = 0;
+    for (int i = 0; i < rt.count; i++) {
+        if (rt.columns[i].min_tenths < lowest) lowest = rt.columns[i].min_tenths;
+        dips += rt.columns[i].min_tenths == 120;
+    }
+    TEST_ASSERT_EQUAL_UINT16(120, lowest);
+    TEST_ASSERT_EQUAL(1, dips);
+}
+
+// The simulated 14 hour day TREND_PROFILING uses: 673 samples, 3 merges
+static void test_simulated_day(void) {
+    const uint32_t day = 14UL * 3600000UL;
+    uint32_t adds = 0, full = 0;
+    clock_t start = clock();
+    for (uint32_t t = 0; t < day; t += 60000UL + (adds * 7919UL) % 30000UL) {
+        float rate = 50.0f - 20.0f * t / day + (float)((adds * 31) % 9) - 4.0f;
+        full += rateTrendAdd(&rt, rate, 1000 + t);
+        adds++;
+    }
+    double ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / adds;
+
+    int merges = 0;
+    for (uint32_t span = RATE_TREND_FIRST_SPAN_MS; span < rt.span_ms; span *= 2) {
+        merges++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(673, adds);
+    TEST_ASSERT_EQUAL(3, merges);
+    TEST_ASSERT_EQUAL_UINT32(8 * RATE_TREND_FIRST_SPAN_MS, rt.span_ms);
+    TEST_ASSERT_LESS_OR_EQUAL(RATE_TREND_COLUMNS, rt.count);
+    TEST_ASSERT_GREATER_THAN(RATE_TREND_COLUMNS / 2, rt.count);
+    TEST_ASSERT_EQUAL_UINT32(merges + 2, full);   // Plus the first scale and one raise
+    for (int i = 0; i < rt.count; i++) {
+        TEST_ASSERT_TRUE(rateTrendColumnUsed(&rt.columns[i]));
+        TEST_ASSERT_LESS_OR_EQUAL(rt.scale * 10, rt.columns[i].max_tenths);
+        TEST_ASSERT_GREATER_OR_EQUAL(250, rt.columns[i].min_tenths);
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%u samples, %d merges, %u columns, %.1f ns/add", (unsigned)adds, merges,
+             (unsigned)rt.count, ns);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_column_min_max);
+    RUN_TEST(test_scale);
+    RUN_TEST(test_gap_stays_empty);
+    RUN_TEST(test_merge_keeps_dip);
+    RUN_TEST(test_simulated_day);
+    return UNITY_END();
+}
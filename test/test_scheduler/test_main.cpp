@@ -0,0 +1,245 @@
+// Host tests of the cooperative job scheduler (src/scheduler.h)
+
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "scheduler.h"
+
+#define BENCH_ROUNDS 200000
+
+static Scheduler sc;
+static uint32_t fake_now;
+static uint32_t notifies;
+static int ran[32];
+static int ran_count;
+
+static uint32_t fakeMillis(void) {
+    return fake_now;
+}
+
+static void countNotify(void *ctx) {
+    (void)ctx;
+    notifies++;
+}
+
+// Records its id and asks to run again after the period in arg
+static uint32_t periodicJob(void *arg) {
+    uint32_t period = (uint32_t)(uintptr_t)arg;
+    if (ran_count < 32) {
+        ran[ran_count++] = (int)period;
+    }
+    return period;
+}
+
+static uint32_t idleJob(void *arg) {
+    if (ran_count < 32) {
+        ran[ran_count++] = (int)(intptr_t)arg;
+    }
+    return SCHED_IDLE;
+}
+
+static int wake_target = -1;
+
+// Wakes another job while it runs, like a job that queues work for a later one
+static uint32_t wakingJob(void *arg) {
+    idleJob(arg);
+    schedWake(&sc, wake_target);
+    return SCHED_IDLE;
+}
+
+void setUp(void) {
+    fake_now = 1000;
+    notifies = 0;
+    ran_count = 0;
+    schedInit(&sc, fakeMillis, countNotify, NULL);
+}
+
+void tearDown(void) {
+}
+
+// Jobs run in deadline order, and the wait is always to the earliest one
+static void test_deadline_order(void) {
+    // Periods that never fall due together, added out of order
+    schedAdd(&sc, "13", periodicJob, (void *)13, 13);
+    schedAdd(&sc, "7", periodicJob, (void *)7, 7);
+    schedAdd(&sc, "11", periodicJob, (void *)11, 11);
+
+    TEST_ASSERT_EQUAL_UINT32(7, schedNextDeadline(&sc));
+    uint32_t end = fake_now + 30;
+    while (fake_now < end) {
+        uint32_t wait = schedRunDue(&sc);
+        TEST_ASSERT_NOT_EQUAL(SCHED_IDLE, wait);
+        TEST_ASSERT_EQUAL_UINT32(wait, schedNextDeadline(&sc));
+        fake_now += wait > 0 ? wait : 1;
+    }
+    // Due at 7, 11, 13, 14, 21, 22, 26 and 28
+    static const int expect[] = {7, 11, 13, 7, 7, 11, 13, 7};
+    TEST_ASSERT_EQUAL_INT(8, ran_count);
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_INT(expect[i], ran[i]);
+    }
+    for (uint8_t i = 0; i < sc.count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, sc.jobs[i].max_late_ms);
+    }
+}
+
+// Deadlines are compared across the millis() wrap
+static void test_clock_wrap(void) {
+    fake_now = 0xFFFFFFFFUL - 4;
+    schedAdd(&sc, "10", periodicJob, (void *)10, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(0, ran_count);
+    fake_now += 10;
+    TEST_ASSERT_EQUAL_UINT32(10, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(1, ran_count);
+    TEST_ASSERT_EQUAL_UINT32(0, sc.jobs[0].max_late_ms);
+}
+
+// An idle job only runs when woken, and repeated wakes before the run notify once
+static void test_wake(void) {
+    int a = schedAdd(&sc, "a", idleJob, (void *)1, SCHED_IDLE);
+    int b = schedAdd(&sc, "b", idleJob, (void *)2, SCHED_IDLE);
+    TEST_ASSERT_EQUAL_UINT32(SCHED_IDLE, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(0, ran_count);
+
+    schedWake(&sc, b);
+    schedWake(&sc, b);
+    schedWake(&sc, b);
+    TEST_ASSERT_EQUAL_UINT32(1, notifies);
+    TEST_ASSERT_EQUAL_UINT32(0, schedNextDeadline(&sc));
+    TEST_ASSERT_EQUAL_UINT32(SCHED_IDLE, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(1, ran_count);
+    TEST_ASSERT_EQUAL_INT(2, ran[0]);
+
+    // Woken again after the run, so it notifies again
+    schedWake(&sc, a);
+    schedWake(&sc, b);
+    TEST_ASSERT_EQUAL_UINT32(3, notifies);
+    schedRunDue(&sc);
+    TEST_ASSERT_EQUAL_INT(3, ran_count);
+    TEST_ASSERT_EQUAL_UINT32(1, sc.jobs[a].runs);
+    TEST_ASSERT_EQUAL_UINT32(2, sc.jobs[b].runs);
+
+    // Out of range ids are ignored
+    schedWake(&sc, -1);
+    schedWake(&sc, SCHED_MAX_JOBS);
+    TEST_ASSERT_EQUAL_UINT32(3, notifies);
+    TEST_ASSERT_FALSE(schedMarkWoken(&sc, 5));
+}
+
+// A wake during a run: a later job runs in the same pass, an earlier job
+// makes schedRunDue() return 0 so the task doesn't sleep on it
+static void test_wake_during_run(void) {
+    int first = schedAdd(&sc, "first", idleJob, (void *)1, SCHED_IDLE);
+    int waker = schedAdd(&sc, "waker", wakingJob, (void *)2, SCHED_IDLE);
+    int last = schedAdd(&sc, "last", idleJob, (void *)3, SCHED_IDLE);
+
+    wake_target = last;
+    schedWake(&sc, waker);
+    TEST_ASSERT_EQUAL_UINT32(SCHED_IDLE, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(2, ran_count);
+    TEST_ASSERT_EQUAL_INT(3, ran[1]);
+
+    wake_target = first;
+    schedWake(&sc, waker);
+    TEST_ASSERT_EQUAL_UINT32(0, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(3, ran_count);
+    TEST_ASSERT_EQUAL_UINT32(SCHED_IDLE, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_INT(4, ran_count);
+    TEST_ASSERT_EQUAL_INT(1, ran[3]);
+}
+
+// Lateness is the time from the deadline to the run; a wake-only run has none
+static void test_lateness(void) {
+    int periodic = schedAdd(&sc, "10", periodicJob, (void *)10, 10);
+    int idle = schedAdd(&sc, "idle", idleJob, (void *)0, SCHED_IDLE);
+
+    fake_now += 17;
+    TEST_ASSERT_EQUAL_UINT32(10, schedRunDue(&sc));
+    TEST_ASSERT_EQUAL_UINT32(7, sc.jobs[periodic].max_late_ms);
+    fake_now += 12;
+    schedRunDue(&sc);
+    TEST_ASSERT_EQUAL_UINT32(7, sc.jobs[periodic].max_late_ms);   // Keeps the worst
+    fake_now += 500;
+    schedWake(&sc, idle);
+    schedRunDue(&sc);
+    TEST_ASSERT_EQUAL_UINT32(490, sc.jobs[periodic].max_late_ms);   // Was due at 10 past
+    TEST_ASSERT_EQUAL_UINT32(0, sc.jobs[idle].max_late_ms);
+}
+
+// The table holds SCHED_MAX_JOBS
+static void test_full(void) {
+    for (int i = 0; i < SCHED_MAX_JOBS; i++) {
+        TEST_ASSERT_EQUAL_INT(i, schedAdd(&sc, "job", idleJob, NULL, SCHED_IDLE));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, schedAdd(&sc, "extra", idleJob, NULL, SCHED_IDLE));
+    TEST_ASSERT_EQUAL_UINT8(SCHED_MAX_JOBS, sc.count);
+}
+
+static uint32_t emptyJob(void *arg) {
+    (void)arg;
+    return SCHED_IDLE;
+}
+
+// Cost of a pass over a full table with one job woken, as a task does per wake
+static void test_overhead(void) {
+    for (int i = 0; i < SCHED_MAX_JOBS - 1; i++) {
+        schedAdd(&sc, "timer", emptyJob, NULL, 1000000);
+    }
+    int woken = schedAdd(&sc, "woken", emptyJob, NULL, SCHED_IDLE);
+
+    clock_t start = clock();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        schedWake(&sc, woken);
+        schedRunDue(&sc);
+    }
+    double ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_ROUNDS;
+    TEST_ASSERT_EQUAL_UINT32(BENCH_ROUNDS, sc.jobs[woken].runs);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%.0f ns per wake and pass over %d jobs on the host", ns, SCHED_MAX_JOBS);
+    TEST_MESSAGE(msg);
+}
+
+static uint32_t steadyMillis(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+// A task loop on the real clock, sleeping for what schedRunDue() returns:
+// the lateness it measures is only the sleep's overshoot
+static void test_real_clock_lateness(void) {
+    schedInit(&sc, steadyMillis, NULL, NULL);
+    int job = schedAdd(&sc, "5", periodicJob, (void *)5, 5);
+    uint32_t start = steadyMillis();
+    while (steadyMillis() - start < 300) {
+        uint32_t wait = schedRunDue(&sc);
+        struct timespec ts = {(time_t)(wait / 1000), (long)(wait % 1000) * 1000000};
+        nanosleep(&ts, NULL);
+    }
+    uint32_t runs = sc.jobs[job].runs;
+    TEST_ASSERT_GREATER_THAN_UINT32(20, runs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(61, runs);
+    TEST_ASSERT_LESS_THAN_UINT32(50, sc.jobs[job].max_late_ms);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%lu runs of a 5 ms job in 300 ms, worst lateness %lu ms", (unsigned long)runs,
+             (unsigned long)sc.jobs[job].max_late_ms);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_deadline_order);
+    RUN_TEST(test_clock_wrap);
+    RUN_TEST(test_wake);
+    RUN_TEST(test_wake_during_run);
+    RUN_TEST(test_lateness);
+    RUN_TEST(test_full);
+    RUN_TEST(test_overhead);
+    RUN_TEST(test_real_clock_lateness);
+    return UNITY_END();
+}
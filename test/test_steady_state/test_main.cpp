@@ -0,0 +1,191 @@
+// Host soak test: the per-event work of the sensor, UI and serial tasks
+// makes no heap allocations after boot (src/alloc_counter.h)
+//
+// The native environment builds with ALLOC_PROFILING, so alloc_counter.cpp
+// replaces operator new and counts LVGL pool allocations, as in the
+// cyd_alloc_check firmware. LVGL itself isn't built on the host; its label
+// updates are the view-model's static buffers.
+
+#include <unity.h>
+#include <stdio.h>
+#include "alloc_counter.h"
+#include "anomaly.h"
+#include "async_log.h"
+#include "bale_history.h"
+#include "console.h"
+#include "edge_ring.h"
+#include "forecast.h"
+#include "rate_estimator.h"
+#include "rate_trend.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include "view_model.h"
+
+#define SOAK_EDGES 200000
+
+static uint32_t clock_ms;
+static EdgeRing edges;
+static BaleForecast forecast;
+static RateEstimator rate;
+static RateTrend trend;
+static AnomalyDetector anomaly;
+static ViewModel view;
+static TelemetryQueue telemetry;
+static HistoryCache history;
+static Scheduler sched;
+static uint32_t bale_count, flake_count, history_count;
+static BaleRecord history_file[64];
+
+static uint32_t nowMs(void) {
+    return clock_ms;
+}
+
+static uint32_t loadHistory(void *ctx, uint32_t first, BaleRecord *out, uint32_t n) {
+    (void)ctx;
+    uint32_t got = 0;
+    for (; got < n && first + got < history_count; got++) {
+        out[got] = history_file[(first + got) % 64];
+    }
+    return got;
+}
+
+// One counted edge, like handleSensorEdge() and the increment functions
+static void countEdge(const SensorEdge *edge) {
+    anomalyOnEdge(&anomaly, (SensorId)edge->sensor, edge->active, edge->time_ms);
+    if (edge->active) {
+        return;
+    }
+    char buf[VIEW_TEXT_MAX];
+    if (edge->sensor == SENSOR_FLAKE) {
+        flake_count++;
+        rateOnFlake(&rate, edge->time_ms);
+        anomalyOnFlake(&anomaly, edge->time_ms);
+        snprintf(buf, sizeof(buf), "%lu", (unsigned long)flake_count);
+        viewSetText(&view, VIEW_FLAKE_COUNT, buf);
+        LOG_INFO("Flake count incremented to: %d", (int)flake_count);
+    } else {
+        bale_count++;
+        rateOnBale(&rate, flake_count);
+        forecastOnBale(&forecast, bale_count, edge->time_ms);
+        anomalyOnBale(&anomaly, flake_count, edge->time_ms);
+        baleRecordMake(&history_file[history_count % 64], edge->time_ms / 1000, -1, flake_count);
+        history_count++;
+        flake_count = 0;
+        snprintf(buf, sizeof(buf), "%lu", (unsigned long)bale_count);
+        viewSetText(&view, VIEW_BALE_COUNT, buf);
+        snprintf(buf, sizeof(buf), "%lu left", (unsigned long)forecast.remaining);
+        viewSetText(&view, VIEW_FORECAST, buf);
+        LOG_INFO("Bale count incremented to: %d, yearly: %d", (int)bale_count, (int)bale_count);
+    }
+    float bph = rateFuse(&rate, forecastBalesPerHour(&forecast), forecast.intervals_seen);
+    rateTrendAdd(&trend, bph, edge->time_ms);
+    snprintf(buf, sizeof(buf), bph < 10.0f ? "%.1f" : "%.0f", bph);
+    viewSetText(&view, VIEW_BALES_PER_HOUR, buf);
+
+    TelemetryEvent ev = {};
+    ev.type = edge->sensor == SENSOR_BALE ? TELEM_BALE : TELEM_FLAKE;
+    ev.bale_count = bale_count;
+    telemetryQueuePush(&telemetry, &ev);
+}
+
+static uint32_t sensorJob(void *arg) {
+    (void)arg;
+    SensorEdge edge;
+    while (edgeRingPop(&edges, &edge)) {
+        countEdge(&edge);
+    }
+    return SCHED_IDLE;
+}
+
+static uint32_t tickJob(void *arg) {
+    (void)arg;
+    forecastTick(&forecast, clock_ms);
+    anomalyTick(&anomaly, clock_ms);
+    return 1000;
+}
+
+// The serial task: log text, telemetry frames and history chunks
+static void drainSerial(void) {
+    LogRecord rec;
+    char line[LOG_LINE_MAX];
+    while (logRingPop(&log_ring, &rec)) {
+        logFormat(&rec, line, sizeof(line));
+    }
+    TelemetryEvent batch[TELEMETRY_BATCH_MAX];
+    uint8_t n = 0;
+    while (n < TELEMETRY_BATCH_MAX && telemetryQueuePop(&telemetry, &batch[n])) {
+        n++;
+    }
+    if (n > 0) {
+        static uint8_t packed[TELEMETRY_PACKED_MAX];
+        telemetryPack(packed, 0, batch, n);
+    }
+    static char chunk[HISTORY_CHUNK_MAX];
+    BaleRecord records[4];
+    uint32_t got = loadHistory(NULL, 0, records, 4);
+    historyChunkEncode(chunk, 0, records, got);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_soak_makes_no_allocations(void) {
+    // Boot
+    clock_ms = 0;
+    edgeRingInit(&edges);
+    forecastInit(&forecast, 500, 0);
+    rateInit(&rate, 12.0f);
+    rateTrendInit(&trend, 0);
+    anomalyInit(&anomaly, 0);
+    viewInit(&view);
+    telemetryQueueInit(&telemetry);
+    historyCacheInit(&history, loadHistory, NULL);
+    logInit(nowMs);
+    schedInit(&sched, nowMs, NULL, NULL);
+    int sensor_job = schedAdd(&sched, "sensors", sensorJob, NULL, SCHED_IDLE);
+    schedAdd(&sched, "tick", tickJob, NULL, 1000);
+    allocMarkSteadyState();
+
+    // A long session: a flake every 2.5 s, a bale every 12 flakes
+    for (uint32_t i = 0; i < SOAK_EDGES; i++) {
+        clock_ms += 1250;
+        uint8_t sensor = (i % 26 == 25) ? SENSOR_BALE : SENSOR_FLAKE;
+        edgeRingPush(&edges, clock_ms, sensor, (i & 1) == 0);
+        schedWake(&sched, sensor_job);
+        schedRunDue(&sched);
+        viewTakeDirty(&view);
+        BaleRecord rec;
+        historyCacheGet(&history, history_count > 0 ? history_count - 1 : 0, &rec);
+        drainSerial();
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%lu bales, %lu allocations after boot", (unsigned long)bale_count,
+             (unsigned long)allocSinceSteadyState());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_GREATER_THAN(1000, bale_count);
+    TEST_ASSERT_EQUAL_UINT32(0, allocSinceSteadyState());
+}
+
+// The hook itself: C++ and LVGL pool allocations are both counted
+static void test_hook_counts_allocations(void) {
+    allocMarkSteadyState();
+    int *p = new int(1);
+    delete p;
+    void *block = allocCountedMalloc(32);
+    block = allocCountedRealloc(block, 64);
+    allocCountedFree(block);
+    TEST_ASSERT_EQUAL_UINT32(3, allocSinceSteadyState());
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_soak_makes_no_allocations);
+    RUN_TEST(test_hook_counts_allocations);
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+// Host tests of the touch filter and the 3-point calibration (src/touch_filter.h)
+
+#include <unity.h>
+#include <math.h>
+#include "touch_filter.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+
+static TouchFilter tf;
+
+void setUp(void) {
+    touchFilterReset(&tf);
+}
+
+void tearDown(void) {
+}
+
+static void assertMaps(const TouchCal *cal, int16_t raw_x, int16_t raw_y, int16_t x, int16_t y) {
+    int16_t got_x, got_y;
+    touchCalApply(cal, raw_x, raw_y, WIDTH, HEIGHT, &got_x, &got_y);
+    TEST_ASSERT_EQUAL_INT16(x, got_x);
+    TEST_ASSERT_EQUAL_INT16(y, got_y);
+}
+
+// The old fixed mapping's corners, solved back into the same matrix
+static void test_solve_default(void) {
+    TouchCal def, cal;
+    touchCalDefault(&def, WIDTH, HEIGHT);
+    const int16_t raw[3][2] = {{200, 240}, {3700, 240}, {200, 3800}};
+    const int16_t screen[3][2] = {{1, 1}, {WIDTH, 1}, {1, HEIGHT}};
+    TEST_ASSERT_TRUE(touchCalSolve(&cal, screen, raw));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, def.a, cal.a);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, cal.b);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, def.c, cal.c);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, cal.d);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, def.e, cal.e);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, def.f, cal.f);
+    assertMaps(&cal, 1945, 2013, 160, 120);
+}
+
+// A panel mounted rotated and skewed: raw y runs along screen x
+static void test_solve_rotated(void) {
+    TouchCal cal;
+    // The three targets the calibration screen shows, and where they were touched
+    const int16_t screen[3][2] = {{20, 20}, {300, 120}, {160, 220}};
+    const int16_t raw[3][2] = {{3500, 400}, {2300, 3600}, {500, 2000}};
+    TEST_ASSERT_TRUE(touchCalSolve(&cal, screen, raw));
+    for (int i = 0; i < 3; i++) {
+        assertMaps(&cal, raw[i][0], raw[i][1], screen[i][0], screen[i][1]);
+    }
+    // Affine, so the centroid of the touches maps to the centroid of the targets
+    assertMaps(&cal, (3500 + 2300 + 500) / 3, (400 + 3600 + 2000) / 3, 160, 120);
+    TEST_ASSERT_TRUE(touchCalValid(&cal));
+}
+
+// Points on a line, or almost on top of each other, leave the matrix as it was
+static void test_solve_degenerate(void) {
+    TouchCal cal;
+    touchCalDefault(&cal, WIDTH, HEIGHT);
+    TouchCal before = cal;
+    const int16_t screen[3][2] = {{20, 20}, {300, 120}, {160, 220}};
+    const int16_t collinear[3][2] = {{500, 500}, {2000, 2000}, {3500, 3500}};
+    TEST_ASSERT_FALSE(touchCalSolve(&cal, screen, collinear));
+    const int16_t same_spot[3][2] = {{2000, 2000}, {2010, 2000}, {2000, 2010}};
+    TEST_ASSERT_FALSE(touchCalSolve(&cal, screen, same_spot));
+    TEST_ASSERT_EQUAL_MEMORY(&before, &cal, sizeof(cal));
+}
+
+// A matrix read back from Preferences must be finite and not flatten the screen
+static void test_valid(void) {
+    TouchCal cal;
+    touchCalDefault(&cal, WIDTH, HEIGHT);
+    TEST_ASSERT_TRUE(touchCalValid(&cal));
+
+    TouchCal bad = cal;
+    bad.c = NAN;
+    TEST_ASSERT_FALSE(touchCalValid(&bad));
+    bad = cal;
+    bad.e = INFINITY;
+    TEST_ASSERT_FALSE(touchCalValid(&bad));
+    bad = cal;
+    bad.a = 0.0f;
+    bad.e = 0.0f;
+    TEST_ASSERT_FALSE(touchCalValid(&bad));   // Every point on one spot
+
+    TouchCal zero = {0, 0, 0, 0, 0, 0};      // Never saved
+    TEST_ASSERT_FALSE(touchCalValid(&zero));
+}
+
+// Touches past the edges land on the edge pixels
+static void test_clamp(void) {
+    TouchCal cal;
+    touchCalDefault(&cal, WIDTH, HEIGHT);
+    assertMaps(&cal, 0, 0, 0, 0);
+    assertMaps(&cal, 4095, 4095, WIDTH - 1, HEIGHT - 1);
+    assertMaps(&cal, 0, 4095, 0, HEIGHT - 1);
+    assertMaps(&cal, -100, 2013, 0, 120);
+}
+
+static void addSample(int16_t raw_x, int16_t raw_y, int16_t *x, int16_t *y) {
+    touchFilterAdd(&tf, raw_x, raw_y, x, y);
+}
+
+// A step: the median holds the first sample, then the IIR closes half the gap each sample
+static void test_filter_step(void) {
+    int16_t x, y;
+    addSample(1000, 3000, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1000, x);   // First sample used as-is
+    TEST_ASSERT_EQUAL_INT16(3000, y);
+    addSample(1000, 3000, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1000, x);
+
+    static const int16_t expect_x[] = {1000, 1500, 1750, 1875, 1938, 1969, 1984, 1992, 1996, 1998};
+    static const int16_t expect_y[] = {3000, 2500, 2250, 2125, 2063, 2031, 2016, 2008, 2004, 2002};
+    for (int i = 0; i < 10; i++) {
+        addSample(2000, 2000, &x, &y);
+        TEST_ASSERT_EQUAL_INT16(expect_x[i], x);
+        TEST_ASSERT_EQUAL_INT16(expect_y[i], y);
+    }
+}
+
+// A single-sample spike never reaches the output
+static void test_filter_spike(void) {
+    int16_t x, y;
+    for (int i = 0; i < 5; i++) {
+        addSample(1500, 1500, &x, &y);
+    }
+    addSample(4000, 100, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1500, x);
+    TEST_ASSERT_EQUAL_INT16(1500, y);
+    addSample(1500, 1500, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1500, x);
+    TEST_ASSERT_EQUAL_INT16(1500, y);
+
+    // Two in a row are a real move and get through
+    addSample(1500, 1500, &x, &y);
+    addSample(3000, 1500, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1500, x);
+    addSample(3000, 1500, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(2250, x);
+}
+
+// After the pen lifts, the next press starts fresh instead of sliding over
+static void test_filter_reset(void) {
+    int16_t x, y;
+    for (int i = 0; i < 5; i++) {
+        addSample(500, 500, &x, &y);
+    }
+    touchFilterReset(&tf);
+    addSample(3500, 3000, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(3500, x);
+    TEST_ASSERT_EQUAL_INT16(3000, y);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_solve_default);
+    RUN_TEST(test_solve_rotated);
+    RUN_TEST(test_solve_degenerate);
+    RUN_TEST(test_valid);
+    RUN_TEST(test_clamp);
+    RUN_TEST(test_filter_step);
+    RUN_TEST(test_filter_spike);
+    RUN_TEST(test_filter_reset);
+    return UNITY_END();
+}
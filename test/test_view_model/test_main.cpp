@@ -0,0 +1,170 @@
+// Host tests of the dirty-bit view-model (src/view_model.h), with a replay
+// of a baling workload comparing label updates before and after it
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "view_model.h"
+
+static ViewModel vm;
+
+void setUp(void) {
+    viewInit(&vm);
+}
+
+void tearDown(void) {
+}
+
+static void test_dirty_only_on_change(void) {
+    TEST_ASSERT_TRUE(viewSetText(&vm, VIEW_BALE_COUNT, "12"));
+    TEST_ASSERT_FALSE(viewSetText(&vm, VIEW_BALE_COUNT, "12"));
+    TEST_ASSERT_TRUE(viewSetText(&vm, VIEW_FLAKE_COUNT, "3"));
+    TEST_ASSERT_EQUAL_HEX32((1UL << VIEW_BALE_COUNT) | (1UL << VIEW_FLAKE_COUNT), viewTakeDirty(&vm));
+    TEST_ASSERT_EQUAL_UINT32(0, viewTakeDirty(&vm));
+    TEST_ASSERT_EQUAL_UINT32(1, vm.unchanged);
+    TEST_ASSERT_EQUAL_STRING("12", viewText(&vm, VIEW_BALE_COUNT));
+}
+
+// A value that goes and comes back within a frame is still one update
+static void test_burst_coalesces(void) {
+    viewSetText(&vm, VIEW_FLAKE_COUNT, "1");
+    viewTakeDirty(&vm);
+    for (int i = 2; i <= 20; i++) {
+        char buf[12];
+        snprintf(buf, sizeof(buf), "%d", i);
+        viewSetText(&vm, VIEW_FLAKE_COUNT, buf);
+    }
+    TEST_ASSERT_EQUAL_HEX32(1UL << VIEW_FLAKE_COUNT, viewTakeDirty(&vm));
+    TEST_ASSERT_EQUAL_STRING("20", viewText(&vm, VIEW_FLAKE_COUNT));
+}
+
+// The longest forecast text main.cpp formats fits without being cut
+static void test_longest_forecast_fits(void) {
+    char buf[VIEW_TEXT_MAX];
+    unsigned long eta_min = 0xFFFFFFFFUL / 60000UL + 1;
+    int n = snprintf(buf, sizeof(buf), "%lu left %lu:%02lu", 4294967295UL, eta_min / 60, eta_min % 60);
+    TEST_ASSERT_LESS_THAN(VIEW_TEXT_MAX, n);
+    viewSetText(&vm, VIEW_FORECAST, buf);
+    TEST_ASSERT_EQUAL_STRING(buf, viewText(&vm, VIEW_FORECAST));
+
+    char longer[VIEW_TEXT_MAX + 8];
+    memset(longer, 'x', sizeof(longer) - 1);
+    longer[sizeof(longer) - 1] = '\0';
+    viewSetText(&vm, VIEW_FORECAST, longer);
+    TEST_ASSERT_EQUAL_size_t(VIEW_TEXT_MAX - 1, strlen(viewText(&vm, VIEW_FORECAST)));
+}
+
+// Counts of the replayed session, formatted like the update*Display() functions
+struct Counts {
+    unsigned bales, year, flakes, prev1, prev2;
+    float rate;
+    unsigned remaining, eta_min;
+};
+
+static void formatAll(const Counts *c, uint32_t fields) {
+    char buf[VIEW_TEXT_MAX];
+    if (fields & (1UL << VIEW_BALE_COUNT)) {
+        snprintf(buf, sizeof(buf), "%u", c->bales);
+        viewSetText(&vm, VIEW_BALE_COUNT, buf);
+    }
+    if (fields & (1UL << VIEW_BALE_COUNT_YEAR)) {
+        snprintf(buf, sizeof(buf), "%u", c->year);
+        viewSetText(&vm, VIEW_BALE_COUNT_YEAR, buf);
+    }
+    if (fields & (1UL << VIEW_FLAKE_COUNT)) {
+        snprintf(buf, sizeof(buf), "%u", c->flakes);
+        viewSetText(&vm, VIEW_FLAKE_COUNT, buf);
+    }
+    if (fields & (1UL << VIEW_FLAKE_PREV1)) {
+        snprintf(buf, sizeof(buf), "%u", c->prev1);
+        viewSetText(&vm, VIEW_FLAKE_PREV1, buf);
+    }
+    if (fields & (1UL << VIEW_FLAKE_PREV2)) {
+        snprintf(buf, sizeof(buf), "%u", c->prev2);
+        viewSetText(&vm, VIEW_FLAKE_PREV2, buf);
+    }
+    if (fields & (1UL << VIEW_BALES_PER_HOUR)) {
+        snprintf(buf, sizeof(buf), c->rate < 10.0f ? "%.1f" : "%.0f", c->rate);
+        viewSetText(&vm, VIEW_BALES_PER_HOUR, buf);
+    }
+    if (fields & (1UL << VIEW_FORECAST)) {
+        snprintf(buf, sizeof(buf), "%u left %u:%02u", c->remaining, c->eta_min / 60, c->eta_min % 60);
+        viewSetText(&vm, VIEW_FORECAST, buf);
+    }
+}
+
+static int popcount(uint32_t v) {
+    int n = 0;
+    for (; v != 0; v &= v - 1) {
+        n++;
+    }
+    return n;
+}
+
+// One hour of baling: a flake every 2 s, a bale every 12 flakes, the
+// forecast tick every 5 s, and once a minute a burst of 9 flakes 10 ms
+// apart (chatter).
+// Before the view-model every event set its labels straight away; now the
+// fields are formatted on each event but applied once per 30 ms frame.
+static void test_replay_label_updates(void) {
+    const uint32_t hour_ms = 3600000UL, frame_ms = 30;
+    const uint32_t flake = 1UL << VIEW_FLAKE_COUNT | 1UL << VIEW_BALES_PER_HOUR;
+    const uint32_t bale = flake | 1UL << VIEW_BALE_COUNT | 1UL << VIEW_BALE_COUNT_YEAR |
+                          1UL << VIEW_FLAKE_PREV1 | 1UL << VIEW_FLAKE_PREV2 | 1UL << VIEW_FORECAST;
+    const uint32_t tick = 1UL << VIEW_FORECAST;
+
+    Counts c = {0, 1000, 0, 12, 12, 0.0f, 300, 0};
+    uint32_t before = 0, after = 0, frames_drawn = 0;
+    uint32_t pending = 0;
+    for (uint32_t t = 0; t < hour_ms; t += 10) {
+        uint32_t events = 0;
+        bool burst = t % 60000 != 0 && t % 60000 < 100;
+        if (t % 2000 == 0 || burst) {
+            c.flakes++;
+            c.rate = c.bales > 1 ? 3600000.0f * (c.bales - 1) / t : 0.0f;
+            events |= flake;
+            before += popcount(flake);
+            if (c.flakes >= 12 && t % 2000 == 0) {
+                c.bales++;
+                c.year++;
+                c.prev2 = c.prev1;
+                c.prev1 = c.flakes;
+                c.flakes = 0;
+                c.remaining--;
+                c.eta_min = c.remaining * 24 / 60;
+                events |= bale;
+                before += popcount(bale);
+            }
+        }
+        if (t % 5000 == 0) {
+            events |= tick;
+            before += popcount(tick);
+        }
+        pending |= events;
+        if (t % frame_ms == 0 && pending != 0) {
+            formatAll(&c, pending);
+            pending = 0;
+            uint32_t dirty = viewTakeDirty(&vm);
+            after += popcount(dirty);
+            frames_drawn += dirty != 0;
+        }
+    }
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "label updates per second: %.2f before, %.2f after (%lu frames redrawn, %lu unchanged skipped)",
+             before / 3600.0, after / 3600.0, (unsigned long)frames_drawn, (unsigned long)vm.unchanged);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_THAN(before * 3 / 4, after);
+    TEST_ASSERT_GREATER_THAN(0, vm.unchanged);
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_dirty_only_on_change);
+    RUN_TEST(test_burst_coalesces);
+    RUN_TEST(test_longest_forecast_fits);
+    RUN_TEST(test_replay_label_updates);
+    return UNITY_END();
+}
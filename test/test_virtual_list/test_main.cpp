@@ -0,0 +1,154 @@
+// Host tests of the history list scrolling (src/virtual_list.h) read through
+// the record cache (src/bale_history.h), the way the history screen uses them
+
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "virtual_list.h"
+#include "bale_history.h"
+
+// The history screen's geometry: 18 px rows in a 182 px viewport
+#define ROW_H 18
+#define VIEW_H 182
+#define DRAG_STEPS 200
+#define DRAG_STEP_PX 7   // About a fast finger drag per frame
+
+static VirtualList vl;
+static HistoryCache hc;
+static uint32_t record_count;
+
+// Made-up bales, a bale every 75 s
+static uint32_t loadRecords(void *ctx, uint32_t first, BaleRecord *out, uint32_t n) {
+    (void)ctx;
+    uint32_t got = 0;
+    for (uint32_t i = first; i < record_count && got < n; i++, got++) {
+        baleRecordMake(&out[got], i * 75, i > 0 ? (int64_t)(i - 1) * 75 : -1, 10 + i % 5);
+    }
+    return got;
+}
+
+void setUp(void) {
+    vlistInit(&vl, ROW_H, VIEW_H);
+    historyCacheInit(&hc, loadRecords, NULL);
+}
+
+void tearDown(void) {
+}
+
+static int bitCount(uint32_t bits) {
+    int n = 0;
+    for (; bits != 0; bits &= bits - 1) {
+        n++;
+    }
+    return n;
+}
+
+// Check every slot against the rows on screen, and read the rows that changed
+// through the cache like the history screen does (newest bale first)
+static void checkSlots(uint32_t changed) {
+    uint32_t first = vl.scroll_y / ROW_H;
+    for (uint32_t r = first; r < first + vl.slots && r < vl.count; r++) {
+        TEST_ASSERT_EQUAL_UINT32(r, vl.slot_row[r % vl.slots]);
+    }
+    for (uint8_t s = 0; s < vl.slots; s++) {
+        uint32_t row = vl.slot_row[s];
+        if (row == VLIST_NO_ROW) {
+            continue;
+        }
+        int32_t y = vlistSlotY(&vl, s);
+        TEST_ASSERT_GREATER_THAN(-ROW_H - 1, y);
+        TEST_ASSERT_LESS_THAN(VIEW_H + ROW_H, y);
+        if (changed & (1UL << s)) {
+            BaleRecord rec;
+            TEST_ASSERT_TRUE(historyCacheGet(&hc, vl.count - 1 - row, &rec));
+            TEST_ASSERT_EQUAL_UINT32((vl.count - 1 - row) * 75, rec.time_s);
+        }
+    }
+}
+
+static void test_slots_cover_viewport(void) {
+    TEST_ASSERT_EQUAL(12, vl.slots);   // 182 / 18 rounded up, plus a partial row at each end
+    TEST_ASSERT_LESS_OR_EQUAL(VLIST_MAX_SLOTS, vl.slots);
+
+    // The first update sets every slot, hiding the ones past the last row
+    TEST_ASSERT_EQUAL(vl.slots, bitCount(vlistUpdate(&vl, 5, 0)));
+    TEST_ASSERT_EQUAL_UINT32(VLIST_NO_ROW, vl.slot_row[5]);
+    TEST_ASSERT_EQUAL(0, vlistMaxScroll(&vl));
+    TEST_ASSERT_EQUAL(0, vlistUpdate(&vl, 5, 100));   // Clamped, nothing moves
+}
+
+// Drag down from the top, then jump to the end and to the middle, on seasons
+// of 10, 1000 and 100000 bales. A step only sets the slots of the rows that
+// scrolled in, and the cache is refilled about once per window of rows.
+static void test_drag_and_jump(void) {
+    static const uint32_t sizes[] = {10, 1000, 100000};
+    for (uint32_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        setUp();
+        record_count = sizes[i];
+
+        uint32_t changed = vlistUpdate(&vl, record_count, 0);
+        TEST_ASSERT_EQUAL(vl.slots, bitCount(changed));
+        checkSlots(changed);
+
+        uint32_t loads_before = hc.loads;
+        uint32_t refills = 0;
+        clock_t start = clock();
+        for (int step = 1; step <= DRAG_STEPS; step++) {
+            uint32_t first_before = vl.scroll_y / ROW_H;
+            changed = vlistUpdate(&vl, record_count, step * DRAG_STEP_PX);
+            uint32_t new_rows = vl.scroll_y / ROW_H - first_before;
+            TEST_ASSERT_EQUAL(new_rows, bitCount(changed));
+            refills += bitCount(changed);
+            checkSlots(changed);
+        }
+        double us_per_step = (double)(clock() - start) / CLOCKS_PER_SEC * 1e6 / DRAG_STEPS;
+        uint32_t drag_loads = hc.loads - loads_before;
+        uint32_t rows_dragged = vl.scroll_y / ROW_H;
+
+        if (record_count > HISTORY_CACHE_RECORDS) {
+            // 1400 px is 77 rows: one refill per row, and a cache load about
+            // every HISTORY_CACHE_RECORDS / 2 rows (the window is centred)
+            TEST_ASSERT_EQUAL_UINT32(DRAG_STEPS * DRAG_STEP_PX / ROW_H, rows_dragged);
+            TEST_ASSERT_EQUAL_UINT32(rows_dragged, refills);
+            TEST_ASSERT_LESS_OR_EQUAL(rows_dragged / (HISTORY_CACHE_RECORDS / 2) + 1, drag_loads);
+        }
+
+        // A jump sets at most every slot and costs one cache load, whatever the size
+        loads_before = hc.loads;
+        changed = vlistUpdate(&vl, record_count, vlistMaxScroll(&vl));
+        checkSlots(changed);
+        changed = vlistUpdate(&vl, record_count, vlistMaxScroll(&vl) / 2);
+        checkSlots(changed);
+        TEST_ASSERT_LESS_OR_EQUAL(2, hc.loads - loads_before);
+
+        char msg[128];
+        snprintf(msg, sizeof(msg), "%lu rows: %u slots, %lu refills over %lu rows, %lu cache loads, %.3f us/step",
+                 (unsigned long)record_count, (unsigned)vl.slots, (unsigned long)refills, (unsigned long)rows_dragged,
+                 (unsigned long)drag_loads, us_per_step);
+        TEST_MESSAGE(msg);
+    }
+}
+
+// The list follows new bales at the top without resetting every slot
+static void test_rows_added(void) {
+    record_count = 40;
+    vlistUpdate(&vl, record_count, 0);
+    uint32_t row5 = vl.slot_row[5];
+    // One new bale, the view kept on the same bales (scrolled one row down)
+    uint32_t changed = vlistUpdate(&vl, record_count + 1, ROW_H);
+    TEST_ASSERT_EQUAL(1, bitCount(changed));
+    TEST_ASSERT_EQUAL_UINT32(row5, vl.slot_row[5]);
+
+    vlistInvalidate(&vl);
+    TEST_ASSERT_EQUAL(vl.slots, bitCount(vlistUpdate(&vl, record_count + 1, ROW_H)));
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_slots_cover_viewport);
+    RUN_TEST(test_drag_and_jump);
+    RUN_TEST(test_rows_added);
+    return UNITY_END();
+}
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+"""Talk to the bale counter's Serial command console.
+
+Sends one console command (see src/console.h) and prints the reply, or
+copies the season history into a CSV file. "sync" is resumable: the cursor
+and the last record are kept in a state file next to the CSV, so the next
+sync asks only for the bales counted since. A chunk that arrives with a bad
+CRC is asked for again, and if the history was cleared on the unit the
+sync starts again from its first bale.
+
+"bench" streams the whole history without saving it and prints the
+throughput against the UART line rate (baud / 10 bytes per second).
+
+Uses only the standard library (termios), so Linux and macOS only.
+
+Run from anywhere:
+    python3 tools/console.py /dev/ttyUSB0 status
+    python3 tools/console.py /dev/ttyUSB0 target 120
+    python3 tools/console.py /dev/ttyUSB0 reset bales
+    python3 tools/console.py /dev/ttyUSB0 sync bales.csv
+    python3 tools/console.py /dev/ttyUSB0 bench
+"""
+
+import argparse
+import csv
+import fcntl
+import json
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import zlib
+
+RECORD = struct.Struct("<IHH")   # BaleRecord: time_s, flakes, interval_s
+REPLY_TIMEOUT = 3.0              # Seconds to wait for the next line of a reply
+MAX_RETRIES = 5                  # Bad chunks retried before a sync gives up
+
+
+class DeviceError(Exception):
+    """The unit answered @err."""
+
+
+class ChunkError(Exception):
+    """A history chunk was lost or arrived damaged."""
+
+
+class Console:
+    def __init__(self, path, baud):
+        self.baud = baud
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        attrs = termios.tcgetattr(self.fd)
+        speed = getattr(termios, "B%d" % baud)
+        attrs[0] = 0                                        # iflag: raw input
+        attrs[1] = 0                                        # oflag: raw output
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                        # lflag: no echo, no line editing
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        # Opening the port raises DTR and RTS; drop both so the ESP32 isn't held in reset
+        try:
+            fcntl.ioctl(self.fd, termios.TIOCMBIC, struct.pack("I", termios.TIOCM_DTR | termios.TIOCM_RTS))
+        except OSError:
+            pass  # No modem lines (a pty or a network bridge)
+        self.buf = b""
+        self.bytes_read = 0
+
+    def close(self):
+        os.close(self.fd)
+
+    def _fill(self, timeout):
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            raise TimeoutError("no reply from the unit")
+        data = os.read(self.fd, 65536)
+        self.bytes_read += len(data)
+        self.buf += data
+
+    def read_line(self, timeout=REPLY_TIMEOUT):
+        while b"\n" not in self.buf:
+            self._fill(timeout)
+        line, self.buf = self.buf.split(b"\n", 1)
+        return line.rstrip(b"\r").decode("ascii", "replace")
+
+    def read_exact(self, n, timeout=REPLY_TIMEOUT):
+        while len(self.buf) < n:
+            self._fill(timeout)
+        data, self.buf = self.buf[:n], self.buf[n:]
+        return data
+
+    def send(self, command):
+        os.write(self.fd, command.encode("ascii") + b"\n")
+
+    def reply_line(self):
+        """The next console line (without its '@'), skipping log output."""
+        while True:
+            line = self.read_line()
+            if line.startswith("@"):
+                return line[1:]
+
+    def command(self, command):
+        """Run a command and return its reply lines, without the final ok."""
+        self.buf = b""
+        self.send(command)
+        lines = []
+        while True:
+            line = self.reply_line()
+            if line == "ok":
+                return lines
+            if line.startswith("err"):
+                raise DeviceError(line[4:])
+            lines.append(line)
+
+    def _stream(self, cursor):
+        """Records from cursor on, as one history request. Raises ChunkError
+        after reading the rest of the stream if any chunk was bad."""
+        self.buf = b""
+        self.send("history %d" % cursor)
+        records = []
+        damaged = None
+        while True:
+            words = self.reply_line().split()
+            if not words:
+                continue
+            if words[0] == "err":
+                raise DeviceError(" ".join(words[1:]))
+            if words[0] == "chunk" and len(words) == 4:
+                first, count, crc = int(words[1]), int(words[2]), int(words[3], 16)
+                data = self.read_exact(count * RECORD.size)
+                if damaged is None and first != cursor + len(records):
+                    damaged = "chunk at %d missing" % (cursor + len(records))
+                if damaged is None and zlib.crc32(data) != crc:
+                    damaged = "chunk at %d failed its CRC" % first
+                if damaged is None:
+                    records.extend(RECORD.iter_unpack(data))
+            elif words[0] == "end" and len(words) == 4:
+                end = [int(w) for w in words[1:]]
+                self.reply_line()  # ok
+                if damaged is None and end[0] != cursor + len(records):
+                    damaged = "stream ended at %d, expected %d" % (cursor + len(records), end[0])
+                if damaged:
+                    raise ChunkError(damaged, records)
+                return records, end
+
+    def history(self, cursor):
+        """Every record from cursor on, retrying from the first bad chunk.
+        Returns the records and the unit's (next cursor, season clock, time)."""
+        records = []
+        for _ in range(MAX_RETRIES + 1):
+            try:
+                more, end = self._stream(cursor + len(records))
+                return records + more, end
+            except ChunkError as e:
+                print("%s, retrying" % e.args[0], file=sys.stderr)
+                records += e.args[1]
+        raise DeviceError("too many bad chunks")
+
+
+def load_state(path):
+    try:
+        with open(path) as f:
+            return json.load(f)
+    except FileNotFoundError:
+        return {"cursor": 0, "last": None}
+
+
+def sync(console, csv_path):
+    state_path = csv_path + ".state"
+    state = load_state(state_path)
+    cursor = state["cursor"]
+    console.command("time %d" % int(time.time()))
+
+    # Ask again for the last record we have: if it changed, the history was cleared
+    records = None
+    if cursor > 0:
+        try:
+            records, end = console.history(cursor - 1)
+            if not records or list(records[0]) != state["last"]:
+                records = None
+            else:
+                records = records[1:]
+        except DeviceError:
+            records = None
+        if records is None:
+            print("The history on the unit was cleared, starting again from its first bale", file=sys.stderr)
+            cursor = 0
+    if records is None:
+        records, end = console.history(0)
+
+    next_cursor, season_s, wall_s = end
+    new_file = not os.path.exists(csv_path)
+    with open(csv_path, "a", newline="") as f:
+        out = csv.writer(f)
+        if new_file:
+            out.writerow(["bale", "season_s", "flakes", "interval_s", "approx_time"])
+        for i, (time_s, flakes, interval_s) in enumerate(records):
+            # Exact for bales since the unit was last switched on, earlier ones
+            # are shifted by the time it was off
+            counted = wall_s - (season_s - time_s)
+            out.writerow([cursor + i + 1, time_s, flakes, interval_s,
+                          time.strftime("%Y-%m-%d %H:%M:%S", time.localtime(counted))])
+
+    if records:
+        state = {"cursor": next_cursor, "last": list(records[-1])}
+    else:
+        state["cursor"] = next_cursor
+    with open(state_path, "w") as f:
+        json.dump(state, f)
+    print("%d new bales, %d in the season" % (len(records), next_cursor))
+
+
+def bench(console):
+    start_bytes = console.bytes_read
+    start = time.monotonic()
+    records, _ = console.history(0)
+    seconds = time.monotonic() - start
+    received = console.bytes_read - start_bytes
+    line_rate = console.baud / 10.0
+    print("%d records, %d bytes in %.2f s" % (len(records), received, seconds))
+    if seconds > 0:
+        print("%.0f records/s, %.0f bytes/s, %.0f%% of the %d baud line rate (%.0f%% of it records)"
+              % (len(records) / seconds, received / seconds, 100 * received / seconds / line_rate, console.baud,
+                 100 * len(records) * RECORD.size / seconds / line_rate))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="Serial port, e.g. /dev/ttyUSB0")
+    parser.add_argument("command", nargs="+", help="console command, or sync <file.csv>, or bench")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    console = Console(args.port, args.baud)
+    try:
+        if args.command[0] == "sync" and len(args.command) == 2:
+            sync(console, args.command[1])
+        elif args.command == ["bench"]:
+            bench(console)
+        else:
+            for line in console.command(" ".join(args.command)):
+                print(line.lstrip())
+    except (DeviceError, TimeoutError) as e:
+        sys.exit("error: %s" % e)
+    finally:
+        console.close()
+
+
+if __name__ == "__main__":
+    main()
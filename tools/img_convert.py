@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+"""Convert the SquareLine PNG assets into LVGL image arrays (src/ui/ui_img_*_png.c).
+
+SquareLine exports every image as LV_IMG_CF_TRUE_COLOR_ALPHA: 3 bytes per
+pixel, alpha-blended on every redraw. This script picks a cheaper format for
+each image in IMAGES:
+
+  indexed    up to 16 colours (colour + alpha): LV_IMG_CF_INDEXED_1/2/4BIT,
+             an ARGB palette plus 1-4 bits per pixel. Keeps transparency.
+  preblend   the image always sits on a known solid background: alpha is
+             blended onto it here and the image is stored opaque as
+             LV_IMG_CF_TRUE_COLOR. 2 bytes per pixel, drawn as a plain copy.
+  alpha      LV_IMG_CF_TRUE_COLOR_ALPHA, as SquareLine exports it.
+
+"auto" picks indexed if it fits, then preblend if a background is given,
+then alpha. 8-bit indexing is not picked by auto: it halves the flash of a
+pre-blended image but LVGL has to decode it line by line on every redraw.
+
+Colours are byte-swapped RGB565 (LV_COLOR_16_SWAP 1), with an RGB332 variant
+for the 8-bit render mode (env:cyd_8bit). Only the Python standard library
+is used (PNG decoding with zlib).
+
+Run from the repository root after exporting the UI from SquareLine Studio:
+    python3 tools/img_convert.py          # regenerate and print the sizes
+    python3 tools/img_convert.py --check  # only print the sizes
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+ASSET_DIR = "SquareLineUIProject/assets"
+OUT_DIR = "src/ui"
+
+# Backgrounds of the dark default theme (ui.c: lv_theme_default_init(..., true, ...))
+SCREEN_BG = 0x15171A
+PANEL_BG = 0x282B30
+
+# (asset, background the image sits on or None, format)
+IMAGES = [
+    ("hay flake_better_60tall.png", SCREEN_BG, "auto"),
+    ("hay.png", SCREEN_BG, "auto"),
+    ("hay_time.png", SCREEN_BG, "auto"),
+    ("balesperhour_102tall.png", SCREEN_BG, "auto"),
+    ("setting_white.png", SCREEN_BG, "auto"),
+    ("close_btn_white.png", PANEL_BG, "auto"),
+]
+
+
+def load_png(path):
+    """Decode an 8-bit RGB/RGBA/grey/palette PNG into rows of (r, g, b, a) tuples."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError("%s: only 8-bit, non-interlaced PNGs are supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour]
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    pos = 0
+    for _ in range(height):
+        filt = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = prev[i]
+            up_left = prev[i - channels] if i >= channels else 0
+            if filt == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif filt == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif filt == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif filt == 4:
+                pa = abs(up - up_left)
+                pb = abs(left - up_left)
+                pc = abs(left + up - 2 * up_left)
+                pred = left if pa <= pb and pa <= pc else (up if pb <= pc else up_left)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+
+        row = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if colour == 6:
+                row.append(tuple(px))
+            elif colour == 2:
+                row.append((px[0], px[1], px[2], 255))
+            elif colour == 4:
+                row.append((px[0], px[0], px[0], px[1]))
+            elif colour == 0:
+                row.append((px[0], px[0], px[0], 255))
+            else:
+                r, g, b = palette[px[0]]
+                row.append((r, g, b, trns[px[0]] if px[0] < len(trns) else 255))
+        rows.append(row)
+    return width, height, rows
+
+
+def rgb565_swapped(r, g, b):
+    c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return [c >> 8, c & 0xFF]
+
+
+def rgb332(r, g, b):
+    return (r & 0xE0) | ((g & 0xE0) >> 3) | (b >> 6)
+
+
+def blend(px, bg):
+    r, g, b, a = px
+    bg_r, bg_g, bg_b = bg >> 16, (bg >> 8) & 0xFF, bg & 0xFF
+    mix = lambda fg, back: (fg * a + back * (255 - a) + 127) // 255
+    return mix(r, bg_r), mix(g, bg_g), mix(b, bg_b)
+
+
+def indexed_palette(rows):
+    """Distinct colours (at RGB565 precision) with alpha, or None if more than 16."""
+    colours = {}
+    for row in rows:
+        for r, g, b, a in row:
+            key = (r & 0xF8, g & 0xFC, b & 0xF8, a) if a else (0, 0, 0, 0)
+            if key not in colours:
+                if len(colours) == 16:
+                    return None
+                colours[key] = len(colours)
+    return colours
+
+
+def convert(rows, width, bg, fmt):
+    """Returns (cf, comment, data16 rows, data8 rows or None if same as data16)."""
+    palette = indexed_palette(rows) if fmt in ("auto", "indexed") else None
+    if fmt == "indexed" and palette is None:
+        raise ValueError("more than 16 colours, cannot index")
+    if fmt == "preblend" and bg is None:
+        raise ValueError("preblend needs a background colour")
+
+    if palette is not None:
+        bits = 1 if len(palette) <= 2 else 2 if len(palette) <= 4 else 4
+        # lv_color32_t palette entries: blue, green, red, alpha
+        pal_row = []
+        for (r, g, b, a) in sorted(palette, key=palette.get):
+            pal_row += [b, g, r, a]
+        pal_row += [0] * (4 * (1 << bits) - len(pal_row))
+        data = [pal_row]
+        per_byte = 8 // bits
+        for row in rows:
+            out = [0] * ((width + per_byte - 1) // per_byte)
+            for x, (r, g, b, a) in enumerate(row):
+                key = (r & 0xF8, g & 0xFC, b & 0xF8, a) if a else (0, 0, 0, 0)
+                shift = 8 - bits * (x % per_byte + 1)
+                out[x // per_byte] |= palette[key] << shift
+            data.append(out)
+        return ("LV_IMG_CF_INDEXED_%dBIT" % bits,
+                "%d-colour palette" % len(palette), data, None)
+
+    if fmt in ("auto", "preblend") and bg is not None:
+        data16, data8 = [], []
+        for row in rows:
+            out16, out8 = [], []
+            for px in row:
+                r, g, b = blend(px, bg)
+                out16 += rgb565_swapped(r, g, b)
+                out8.append(rgb332(r, g, b))
+            data16.append(out16)
+            data8.append(out8)
+        return ("LV_IMG_CF_TRUE_COLOR",
+                "alpha pre-blended onto 0x%06X" % bg, data16, data8)
+
+    data16, data8 = [], []
+    for row in rows:
+        out16, out8 = [], []
+        for r, g, b, a in row:
+            out16 += rgb565_swapped(r, g, b) + [a]
+            out8 += [rgb332(r, g, b), a]
+        data16.append(out16)
+        data8.append(out8)
+    return "LV_IMG_CF_TRUE_COLOR_ALPHA", "colour + alpha", data16, data8
+
+
+def c_array(name, rows):
+    lines = ["const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s[] = {" % name]
+    for row in rows:
+        lines.append("    " + "".join("0x%02X," % v for v in row))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def write_source(path, asset, symbol, width, height, cf, comment, data16, data8):
+    data_name = symbol + "_data"
+    parts = [
+        "// This file was generated by tools/img_convert.py from a SquareLine Studio asset",
+        "// LVGL version: 8.3.6",
+        "// Project name: BaleCounter",
+        "",
+        '#include "ui.h"',
+        "",
+        "// With UI_ASSETS_PARTITION the image is read from the assets partition instead",
+        "// (tools/pack_assets.py), so it is left out of the app",
+        "#ifndef UI_ASSETS_PARTITION",
+        "",
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN",
+        "    #define LV_ATTRIBUTE_MEM_ALIGN",
+        "#endif",
+        "",
+    ]
+    if data8 is None:
+        parts += ["// IMAGE DATA: assets/%s (%s)" % (asset, comment), c_array(data_name, data16)]
+    else:
+        parts += [
+            "// IMAGE DATA: assets/%s (%s, RGB332 for the 8-bit render mode)" % (asset, comment),
+            "#if LV_COLOR_DEPTH == 8",
+            c_array(data_name, data8),
+            "#else",
+            "// IMAGE DATA: assets/%s (%s)" % (asset, comment),
+            c_array(data_name, data16),
+            "#endif",
+        ]
+    parts += [
+        "const lv_img_dsc_t %s = {" % symbol,
+        "    .header.always_zero = 0,",
+        "    .header.w = %d," % width,
+        "    .header.h = %d," % height,
+        "    .data_size = sizeof(%s)," % data_name,
+        "    .header.cf = %s," % cf,
+        "    .data = %s" % data_name,
+        "};",
+        "",
+        "#endif // UI_ASSETS_PARTITION",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(parts) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="print the sizes without writing files")
+    args = parser.parse_args()
+
+    print("%-28s %-28s %9s %9s %9s %9s" % ("image", "format", "alpha 16", "new 16", "alpha 8", "new 8"))
+    totals = [0, 0, 0, 0]
+    for asset, bg, fmt in IMAGES:
+        width, height, rows = load_png(os.path.join(ASSET_DIR, asset))
+        symbol = "ui_img_" + os.path.splitext(asset)[0].replace(" ", "_").lower() + "_png"
+        try:
+            cf, comment, data16, data8 = convert(rows, width, bg, fmt)
+        except ValueError as e:
+            sys.exit("%s: %s" % (asset, e))
+
+        sizes = [width * height * 3, sum(map(len, data16)),
+                 width * height * 2, sum(map(len, data8 if data8 is not None else data16))]
+        totals = [t + s for t, s in zip(totals, sizes)]
+        print("%-28s %-28s %9d %9d %9d %9d" % ((asset, cf[10:]) + tuple(sizes)))
+
+        if not args.check:
+            write_source(os.path.join(OUT_DIR, symbol + ".c"), asset, symbol,
+                         width, height, cf, comment, data16, data8)
+
+    print("%-28s %-28s %9d %9d %9d %9d" % (("total", "") + tuple(totals)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""List the IRAM use of a firmware build, per function.
+
+The sensor and touch interrupts, everything they call and the palette
+expansion loop are marked IRAM_ATTR so they run from internal RAM instead
+of through the flash cache. This reads the built firmware.elf and prints:
+  - every function of this project in IRAM, with its size
+  - the largest library functions in IRAM
+  - the IRAM used in total, against the ESP32's 128 KB
+  - any function marked IRAM_ATTR in src/ that the linker put in flash
+    (or that was inlined away), so a misplaced hot path is noticed
+  - any call from a project function in IRAM to code in flash. Such a call
+    crashes an IRAM interrupt that runs during a flash write, and stalls
+    on the cache anywhere else, so the whole call tree has to be in IRAM.
+
+Run from the repository root after a build (needs PlatformIO's toolchain):
+    pio run -e cyd && python3 tools/iram_report.py
+    python3 tools/iram_report.py cyd_8bit --top 40
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+IRAM_START = 0x40080000   # ESP32 internal instruction RAM (iram0_0_seg)
+IRAM_END = 0x400A0000
+IRAM_BYTES = IRAM_END - IRAM_START
+FLASH_START = 0x400D0000  # Code run through the flash cache (irom0_0_seg)
+FLASH_END = 0x40400000
+
+SOURCES = ["src/*.cpp", "src/*.c"]
+# "void IRAM_ATTR name(" or "static bool IRAM_ATTR name(" in a definition
+IRAM_DEF = re.compile(r"\bIRAM_ATTR\s+(\w+)\s*\(")
+# With -mlongcalls a call is "l32r aN, <literal>" then "callx8 aN"; a short
+# call names its target directly
+LITERAL_LOAD = re.compile(r"\sl32r\s+a\d+,\s*([0-9a-f]+)")
+DIRECT_CALL = re.compile(r"\scall(?:0|4|8|12)\s+([0-9a-f]+)")
+
+
+def tool(name):
+    """A binutils tool from the PATH, or PlatformIO's ESP32 toolchain."""
+    path = shutil.which(name)
+    if path:
+        return path
+    for path in glob.glob(os.path.expanduser("~/.platformio/packages/toolchain-xtensa-esp32*/bin/" + name)):
+        return path
+    sys.exit("%s not found - build once with PlatformIO to install the toolchain" % name)
+
+
+def marked_functions():
+    """Names of the functions defined with IRAM_ATTR in src/, with their file."""
+    names = {}
+    for pattern in SOURCES:
+        for path in sorted(glob.glob(pattern)):
+            with open(path) as f:
+                for name in IRAM_DEF.findall(f.read()):
+                    names[name] = os.path.basename(path)
+    return names
+
+
+def symbols(elf):
+    """(address, size, demangled name) of every function symbol."""
+    out = subprocess.run([tool("xtensa-esp32-elf-nm"), "-C", "-S", "--defined-only", elf],
+                         capture_output=True, text=True, check=True).stdout
+    result = []
+    for line in out.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) == 4 and fields[2] in "tTwW":
+            result.append((int(fields[0], 16), int(fields[1], 16), fields[3]))
+    return result
+
+
+def base_name(symbol):
+    """handleSensorEdge(unsigned char, bool, unsigned int) -> handleSensorEdge"""
+    return symbol.split("(")[0].split("::")[-1]
+
+
+def iram_section_bytes(elf):
+    """Bytes of the IRAM sections (code, vectors) as laid out by the linker."""
+    out = subprocess.run([tool("xtensa-esp32-elf-size"), "-A", elf],
+                         capture_output=True, text=True, check=True).stdout
+    total = 0
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[0].startswith(".iram0"):
+            total += int(fields[1])
+    return total
+
+
+def section_words(elf, section):
+    """The section's contents as {address: 32-bit little-endian word}."""
+    out = subprocess.run([tool("xtensa-esp32-elf-objdump"), "-s", "-j", section, elf],
+                         capture_output=True, text=True, check=True).stdout
+    words = {}
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not re.fullmatch(r"[0-9a-f]{8}", fields[0]):
+            continue
+        address = int(fields[0], 16)
+        for chunk in fields[1:5]:
+            if not re.fullmatch(r"[0-9a-f]{8}", chunk):
+                break
+            words[address] = int.from_bytes(bytes.fromhex(chunk), "little")
+            address += 4
+    return words
+
+
+def flash_calls(elf, functions, by_address):
+    """(caller, callee) for each call from the given IRAM functions into flash.
+
+    A literal that points into flash code is counted as a call: in a
+    function's literal pool that is what it is used for.
+    """
+    literals = section_words(elf, ".iram0.text")
+    found = []
+    for address, size, name in functions:
+        out = subprocess.run([tool("xtensa-esp32-elf-objdump"), "-d", "--no-show-raw-insn",
+                              "--start-address=0x%x" % address, "--stop-address=0x%x" % (address + size), elf],
+                             capture_output=True, text=True, check=True).stdout
+        targets = set()
+        for line in out.splitlines():
+            match = LITERAL_LOAD.search(line)
+            if match:
+                targets.add(literals.get(int(match.group(1), 16), 0))
+            match = DIRECT_CALL.search(line)
+            if match:
+                targets.add(int(match.group(1), 16))
+        for target in sorted(targets):
+            if FLASH_START <= target < FLASH_END:
+                found.append((name, by_address.get(target, "0x%08x" % target)))
+    return found
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("env", nargs="?", default="cyd", help="PlatformIO environment (default cyd)")
+    parser.add_argument("--top", type=int, default=20, help="library functions to list")
+    args = parser.parse_args()
+
+    elf = os.path.join(".pio", "build", args.env, "firmware.elf")
+    if not os.path.exists(elf):
+        sys.exit("%s not found - run pio run -e %s first" % (elf, args.env))
+
+    marked = marked_functions()
+    ours, library = [], []
+    ours_placed = []
+    placed = {}
+    all_symbols = symbols(elf)
+    by_address = {address: name for address, _, name in all_symbols}
+    for address, size, name in all_symbols:
+        base = base_name(name)
+        in_iram = IRAM_START <= address < IRAM_END
+        if base in marked:
+            placed.setdefault(base, in_iram)
+            placed[base] = placed[base] and in_iram
+        if in_iram:
+            (ours if base in marked else library).append((size, name))
+            if base in marked:
+                ours_placed.append((address, size, name))
+
+    print("Project functions in IRAM:")
+    for size, name in sorted(ours, reverse=True):
+        print("  %6d  %-60s %s" % (size, name, marked[base_name(name)]))
+    print("  %6d  total" % sum(size for size, _ in ours))
+
+    print("\nLargest library functions in IRAM:")
+    for size, name in sorted(library, reverse=True)[:args.top]:
+        print("  %6d  %s" % (size, name))
+
+    used = iram_section_bytes(elf)
+    print("\nIRAM: %d of %d bytes used (%.0f%%), %d bytes by this project"
+          % (used, IRAM_BYTES, 100.0 * used / IRAM_BYTES, sum(size for size, _ in ours)))
+
+    problems = 0
+    for name, source in sorted(marked.items()):
+        if name not in placed:
+            print("note: %s (%s) has no symbol - inlined into its callers" % (name, source))
+        elif not placed[name]:
+            print("WARNING: %s (%s) is marked IRAM_ATTR but is in flash" % (name, source))
+            problems += 1
+    for caller, callee in flash_calls(elf, ours_placed, by_address):
+        print("WARNING: %s is in IRAM but calls %s in flash" % (base_name(caller), callee))
+        problems += 1
+    sys.exit(1 if problems else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,444 @@
+#!/usr/bin/env python3
+"""Generate the digit-only font subsets used by env:cyd_digit_fonts (see lv_conf.h).
+
+The 20 px Montserrat font is only used for the counts, the bales per hour
+rate and the slashes between the flake counts, so that build replaces it with
+a subset holding just the characters those labels show.
+
+The glyphs are rasterised here from a TrueType file, with only the Python
+standard library (no lv_font_conv or Node.js), and written in the format
+lv_font_conv uses for LVGL 8: 4 bits per pixel, uncompressed, no kerning
+(the digits have none). Line height and baseline are those of LVGL's own
+lv_font_montserrat_20, so the labels keep their size and position.
+
+LVGL's built-in fonts are made from Montserrat-Medium. --embolden thickens
+the outlines by that many font units, to approximate Medium from the Regular
+weight (Montserrat's stems are 72 units in Regular, about 102 in Medium).
+
+Run from the repository root:
+    python3 tools/make_digit_fonts.py path/to/Montserrat-Medium.ttf
+    python3 tools/make_digit_fonts.py --embolden 30 path/to/Montserrat-Regular.ttf
+"""
+
+import argparse
+import math
+import os
+import re
+import struct
+
+OUT_DIR = "src/fonts"
+
+# Space, '-', '.', '/' and the digits
+DIGIT_RANGES = [(0x20, 0x20), (0x2D, 0x39)]
+
+# (font name, size in px, line height, baseline) - the last two as in lv_font_montserrat_<size>.c
+FONTS = [
+    ("ui_font_digits_20", 20, 22, 4),
+]
+
+SAMPLES = 16   # Sample rows per pixel; coverage along a row is exact
+
+
+class TrueType:
+    """The outlines, advances and character map of a TrueType (glyf) font."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = data = f.read()
+        if data[:4] not in (b"\x00\x01\x00\x00", b"true"):
+            raise SystemExit("%s: not a TrueType font (WOFF and CFF fonts are not read)" % path)
+        count = struct.unpack_from(">H", data, 4)[0]
+        self.tables = {}
+        for i in range(count):
+            tag, _, offset, length = struct.unpack_from(">4sIII", data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.table("head")
+        self.units_per_em = struct.unpack_from(">H", data, head + 18)[0]
+        long_loca = struct.unpack_from(">h", data, head + 50)[0] == 1
+        num_glyphs = struct.unpack_from(">H", data, self.table("maxp") + 4)[0]
+        num_metrics = struct.unpack_from(">H", data, self.table("hhea") + 34)[0]
+
+        hmtx = self.table("hmtx")
+        self.advances = [struct.unpack_from(">H", data, hmtx + 4 * min(i, num_metrics - 1))[0]
+                         for i in range(num_glyphs)]
+        loca = self.table("loca")
+        if long_loca:
+            self.loca = struct.unpack_from(">%dI" % (num_glyphs + 1), data, loca)
+        else:
+            self.loca = [2 * v for v in struct.unpack_from(">%dH" % (num_glyphs + 1), data, loca)]
+        self.cmap = self.read_cmap()
+
+    def table(self, tag):
+        if tag not in self.tables:
+            raise SystemExit("font has no %s table" % tag)
+        return self.tables[tag][0]
+
+    def read_cmap(self):
+        """Unicode BMP character map (format 4)."""
+        data, cmap = self.data, self.table("cmap")
+        count = struct.unpack_from(">H", data, cmap + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", data, cmap + 4 + 8 * i)
+            sub = cmap + offset
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from(">H", data, sub)[0] == 4:
+                break
+        else:
+            raise SystemExit("font has no Unicode format 4 cmap")
+        segs = struct.unpack_from(">H", data, sub + 6)[0] // 2
+        ends = struct.unpack_from(">%dH" % segs, data, sub + 14)
+        starts = struct.unpack_from(">%dH" % segs, data, sub + 16 + 2 * segs)
+        deltas = struct.unpack_from(">%dh" % segs, data, sub + 16 + 4 * segs)
+        range_at = sub + 16 + 6 * segs
+        ranges = struct.unpack_from(">%dH" % segs, data, range_at)
+        mapping = {}
+        for s in range(segs):
+            for c in range(starts[s], ends[s] + 1):
+                if c == 0xFFFF:
+                    continue
+                if ranges[s] == 0:
+                    glyph = (c + deltas[s]) & 0xFFFF
+                else:
+                    at = range_at + 2 * s + ranges[s] + 2 * (c - starts[s])
+                    glyph = struct.unpack_from(">H", data, at)[0]
+                    glyph = (glyph + deltas[s]) & 0xFFFF if glyph else 0
+                mapping[c] = glyph
+        return mapping
+
+    def contours(self, glyph, dx=0, dy=0):
+        """List of contours, each a list of (x, y, on_curve)."""
+        start, end = self.loca[glyph], self.loca[glyph + 1]
+        if start == end:
+            return []
+        data, at = self.data, self.table("glyf") + start
+        num_contours = struct.unpack_from(">h", data, at)[0]
+        at += 10
+        if num_contours < 0:
+            return self.composite(at, dx, dy)
+
+        end_pts = struct.unpack_from(">%dH" % num_contours, data, at)
+        at += 2 * num_contours
+        at += 2 + struct.unpack_from(">H", data, at)[0]   # Skip the instructions
+        num_points = end_pts[-1] + 1 if num_contours else 0
+        flags = []
+        while len(flags) < num_points:
+            flag = data[at]
+            at += 1
+            repeat = 1
+            if flag & 8:
+                repeat += data[at]
+                at += 1
+            flags += [flag] * repeat
+        coords = []
+        for short, same in ((2, 16), (4, 32)):
+            value, values = 0, []
+            for flag in flags:
+                if flag & short:
+                    delta = data[at]
+                    at += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack_from(">h", data, at)[0]
+                    at += 2
+                values.append(value)
+            coords.append(values)
+        points = [(x + dx, y + dy, bool(f & 1)) for x, y, f in zip(coords[0], coords[1], flags)]
+        result, first = [], 0
+        for last in end_pts:
+            result.append(points[first:last + 1])
+            first = last + 1
+        return result
+
+    def composite(self, at, dx, dy):
+        """Components placed at x/y offsets (scaled components are not needed here)."""
+        result = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, at)
+            at += 4
+            if flags & 1:
+                ox, oy = struct.unpack_from(">hh", self.data, at)
+                at += 4
+            else:
+                ox, oy = struct.unpack_from(">bb", self.data, at)
+                at += 2
+            if not flags & 2:
+                raise SystemExit("composite glyphs placed by point numbers are not supported")
+            at += 2 if flags & 8 else 4 if flags & 0x40 else 8 if flags & 0x80 else 0
+            result += self.contours(glyph, dx + ox, dy + oy)
+            if not flags & 0x20:
+                return result
+
+
+def embolden(contours, amount):
+    """Move every point outwards by amount / 2 along the bisector of its edges."""
+    area = 0.0
+    for contour in contours:
+        for i, (x0, y0, _) in enumerate(contour):
+            x1, y1, _ = contour[(i + 1) % len(contour)]
+            area += x0 * y1 - x1 * y0
+    # TrueType outer contours run clockwise (negative area); the outward normal is then (-dy, dx)
+    sign = 1.0 if area < 0 else -1.0
+    half = amount / 2.0
+    result = []
+    for contour in contours:
+        n = len(contour)
+        moved = []
+        for i, (x, y, on) in enumerate(contour):
+            px, py, _ = contour[i - 1]
+            nx, ny, _ = contour[(i + 1) % n]
+            normals = []
+            for ex, ey in ((x - px, y - py), (nx - x, ny - y)):
+                length = math.hypot(ex, ey) or 1.0
+                normals.append((-sign * ey / length, sign * ex / length))
+            (ax, ay), (bx, by) = normals
+            dot = ax * bx + ay * by
+            scale = half / (1.0 + dot) if dot > -0.9 else half
+            moved.append((x + (ax + bx) * scale, y + (ay + by) * scale, on))
+        result.append(moved)
+    return result
+
+
+def flatten(contour, scale):
+    """Quadratic contour (with implied on-curve points) to a closed polyline in pixels."""
+    pts = [(x * scale, y * scale, on) for x, y, on in contour]
+    if not any(on for _, _, on in pts):
+        a, b = pts[0], pts[1]
+        pts.insert(0, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True))
+    while not pts[0][2]:
+        pts.append(pts.pop(0))
+    pts.append(pts[0])
+    line = [pts[0][:2]]
+    i = 1
+    while i < len(pts):
+        x, y, on = pts[i]
+        if on:
+            line.append((x, y))
+            i += 1
+            continue
+        nx, ny, non = pts[i + 1]
+        end = (nx, ny) if non else ((x + nx) / 2, (y + ny) / 2)
+        sx, sy = line[-1]
+        steps = 8
+        for k in range(1, steps + 1):
+            t = k / steps
+            u = 1 - t
+            line.append((u * u * sx + 2 * u * t * x + t * t * end[0], u * u * sy + 2 * u * t * y + t * t * end[1]))
+        i += 2 if non else 1
+    return line
+
+
+def rasterize(lines):
+    """4-bit coverage rows (top row first) and the bitmap's x0 and bottom y in pixels."""
+    edges = []
+    for line in lines:
+        for (x0, y0), (x1, y1) in zip(line, line[1:]):
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+    if not edges:
+        return [], 0, 0
+    xs = [v for e in edges for v in (e[0], e[2])]
+    ys = [v for e in edges for v in (e[1], e[3])]
+    left, right = math.floor(min(xs)), math.ceil(max(xs))
+    bottom, top = math.floor(min(ys)), math.ceil(max(ys))
+    width = right - left
+    cover = [[0.0] * width for _ in range(top - bottom)]
+    for row in range(top - bottom):
+        for k in range(SAMPLES):
+            y = top - row - (k + 0.5) / SAMPLES
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for (x, w), (next_x, _) in zip(crossings, crossings[1:] + [(None, 0)]):
+                winding += w
+                if winding == 0 or next_x is None:
+                    continue
+                a, b = x - left, next_x - left
+                for col in range(max(0, int(a)), min(width, int(math.ceil(b)))):
+                    cover[row][col] += (min(b, col + 1) - max(a, col)) / SAMPLES
+    rows = [[min(15, int(round(c * 15))) for c in r] for r in cover]
+
+    # Trim empty edges, as lv_font_conv does
+    while rows and not any(rows[0]):
+        rows.pop(0)
+    while rows and not any(rows[-1]):
+        rows.pop()
+        bottom += 1
+    if not rows:
+        return [], 0, 0
+    while not any(r[0] for r in rows):
+        rows = [r[1:] for r in rows]
+        left += 1
+    while not any(r[-1] for r in rows):
+        rows = [r[:-1] for r in rows]
+    return rows, left, bottom
+
+
+def pack4(rows):
+    """Pixels 4 bits each, high nibble first, rows not padded, as lv_font_conv writes them."""
+    pixels = [p for r in rows for p in r]
+    if len(pixels) % 2:
+        pixels.append(0)
+    return [(pixels[i] << 4) | pixels[i + 1] for i in range(0, len(pixels), 2)]
+
+
+def codepoints():
+    return [c for start, end in DIGIT_RANGES for c in range(start, end + 1)]
+
+
+def make_font(font, name, size, line_height, base_line, emboldening, source_name):
+    scale = size / font.units_per_em
+    glyphs = []
+    bitmap = []
+    for c in codepoints():
+        glyph = font.cmap.get(c, 0)
+        if glyph == 0:
+            raise SystemExit("%s has no glyph for %r" % (source_name, chr(c)))
+        contours = font.contours(glyph)
+        if emboldening:
+            contours = embolden(contours, emboldening)
+        rows, x0, y0 = rasterize([flatten(contour, scale) for contour in contours])
+        adv_w = int(round(font.advances[glyph] * scale * 16))
+        box_w = len(rows[0]) if rows else 0
+        glyphs.append((c, len(bitmap), adv_w, box_w, len(rows), x0 if rows else 0, y0 if rows else 0))
+        bitmap += pack4(rows)
+
+    guard = name.upper()
+    out = ["/*******************************************************************************",
+           " * Size: %d px" % size,
+           " * Bpp: 4",
+           " * Generated by tools/make_digit_fonts.py from %s%s" % (
+               source_name, " (emboldened by %d units)" % emboldening if emboldening else ""),
+           " * Characters: %s" % "".join(chr(c) for c in codepoints()),
+           " ******************************************************************************/",
+           "",
+           '#include "lvgl.h"',
+           "",
+           "/*Only built for env:cyd_digit_fonts (see lv_conf.h)*/",
+           "#ifdef DIGIT_FONTS",
+           "",
+           "#ifndef %s" % guard,
+           "#define %s 1" % guard,
+           "#endif",
+           "",
+           "#if %s" % guard,
+           "",
+           "/*-----------------",
+           " *    BITMAPS",
+           " *----------------*/",
+           "",
+           "/*Store the image of the glyphs*/",
+           "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {"]
+    for c, index, _, box_w, box_h, _, _ in glyphs:
+        length = (box_w * box_h + 1) // 2
+        if length == 0:
+            continue
+        out.append("    /* U+%04X \"%s\" */" % (c, chr(c)))
+        data = bitmap[index:index + length]
+        for i in range(0, length, 16):
+            out.append("    " + ", ".join("0x%02x" % v for v in data[i:i + 16]) + ",")
+        out.append("")
+    out[-1:] = ["};", "", "",
+                "/*---------------------",
+                " *  GLYPH DESCRIPTION",
+                " *--------------------*/",
+                "",
+                "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {",
+                "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,"]
+    for i, (c, index, adv_w, box_w, box_h, x0, y0) in enumerate(glyphs):
+        out.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}%s" % (
+            index, adv_w, box_w, box_h, x0, y0, "," if i + 1 < len(glyphs) else ""))
+    out += ["};", "",
+            "/*---------------------",
+            " *  CHARACTER MAPPING",
+            " *--------------------*/",
+            "",
+            "/*Collect the unicode lists and glyph_id offsets*/",
+            "static const lv_font_fmt_txt_cmap_t cmaps[] =",
+            "{"]
+    glyph_id = 1
+    for i, (start, end) in enumerate(DIGIT_RANGES):
+        out.append("    {")
+        out.append("        .range_start = %d, .range_length = %d, .glyph_id_start = %d," % (
+            start, end - start + 1, glyph_id))
+        out.append("        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                   ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY")
+        out.append("    }" + ("," if i + 1 < len(DIGIT_RANGES) else ""))
+        glyph_id += end - start + 1
+    out += ["};", "",
+            "/*--------------------",
+            " *  ALL CUSTOM DATA",
+            " *--------------------*/",
+            "",
+            "/*Store all the custom data of the font*/",
+            "static lv_font_fmt_txt_glyph_cache_t cache;",
+            "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+            "    .glyph_bitmap = glyph_bitmap,",
+            "    .glyph_dsc = glyph_dsc,",
+            "    .cmaps = cmaps,",
+            "    .kern_dsc = NULL,",
+            "    .kern_scale = 0,",
+            "    .cmap_num = %d," % len(DIGIT_RANGES),
+            "    .bpp = 4,",
+            "    .kern_classes = 0,",
+            "    .bitmap_format = 0,",
+            "    .cache = &cache",
+            "};",
+            "",
+            "",
+            "/*-----------------",
+            " *  PUBLIC FONT",
+            " *----------------*/",
+            "",
+            "/*Initialize a public general font descriptor*/",
+            "const lv_font_t %s = {" % name,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/",
+            "    .line_height = %d,          /*The maximum line height required by the font*/" % line_height,
+            "    .base_line = %d,             /*Baseline measured from the bottom of the line*/" % base_line,
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "    .underline_position = -1,",
+            "    .underline_thickness = 1,",
+            "    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */",
+            "};",
+            "",
+            "#endif /*#if %s*/" % guard,
+            "",
+            "#endif /*DIGIT_FONTS*/",
+            ""]
+    return "\n".join(out), len(bitmap), len(glyphs)
+
+
+def bitmap_bytes(path):
+    """Size of the glyph bitmap array in a generated font file."""
+    with open(path) as f:
+        source = f.read()
+    match = re.search(r"glyph_bitmap\[\] = \{(.*?)\};", source, re.S)
+    return len(re.findall(r"0x[0-9a-fA-F]{2}", match.group(1))) if match else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("ttf", help="Montserrat TrueType file")
+    parser.add_argument("--embolden", type=int, default=0, metavar="UNITS",
+                        help="thicken the outlines by this many font units")
+    args = parser.parse_args()
+    font = TrueType(args.ttf)
+    os.makedirs(OUT_DIR, exist_ok=True)
+
+    for name, size, line_height, base_line in FONTS:
+        out = os.path.join(OUT_DIR, name + ".c")
+        source, bitmap, count = make_font(font, name, size, line_height, base_line, args.embolden,
+                                          os.path.basename(args.ttf))
+        with open(out, "w") as f:
+            f.write(source)
+        # Each glyph description is 8 bytes (lv_font_fmt_txt_glyph_dsc_t)
+        print("%s: %d px, %d glyphs, %d bytes of glyph bitmaps, %d bytes of glyph descriptions" % (
+            out, size, count, bitmap_bytes(out), 8 * (count + 1)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Pack the UI icons into an image of the "assets" flash partition.
+
+For env:cyd_assets (UI_ASSETS_PARTITION) the icons are left out of the app
+and read from their own partition (src/asset_fs.h). This script converts
+the icons in tools/img_convert.py's IMAGES list, in the same formats, and
+writes the partition image in the layout of src/asset_pack.h. Each icon is
+named like its table source in ui_Main.c ("hay.bin" for ui_img_hay_png).
+
+Changed artwork then only needs this partition written again (about 40 KB)
+instead of a full app upload. --upload writes it with esptool and prints
+how long that took.
+
+Run from the repository root:
+    python3 tools/pack_assets.py                      # write .pio/assets.bin
+    python3 tools/pack_assets.py --depth 8            # for env:cyd_8bit
+    python3 tools/pack_assets.py --upload /dev/ttyUSB0
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import img_convert  # noqa: E402
+
+PARTITIONS = "partitions.csv"
+PARTITION_NAME = "assets"
+OUT_FILE = ".pio/assets.bin"
+
+MAGIC = 0x53414342  # "BCAS"
+NAME_MAX = 28
+HEADER = struct.Struct("<IHBBI")
+ENTRY = struct.Struct("<%dsII" % NAME_MAX)
+
+# lv_img_cf_t values (LVGL 8.3)
+COLOR_FORMATS = {
+    "LV_IMG_CF_TRUE_COLOR": 4,
+    "LV_IMG_CF_TRUE_COLOR_ALPHA": 5,
+    "LV_IMG_CF_INDEXED_1BIT": 7,
+    "LV_IMG_CF_INDEXED_2BIT": 8,
+    "LV_IMG_CF_INDEXED_4BIT": 9,
+}
+
+
+def partition(name):
+    """(offset, size) of a partition in partitions.csv."""
+    with open(PARTITIONS) as f:
+        for line in f:
+            fields = [v.strip() for v in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[3], 0), int(fields[4], 0)
+    sys.exit("%s: no %s partition" % (PARTITIONS, name))
+
+
+def lv_img_header(cf, width, height):
+    """lv_img_header_t: cf:5, always_zero:3, reserved:2, w:11, h:11."""
+    return struct.pack("<I", cf | (width << 10) | (height << 21))
+
+
+def build_pack(depth):
+    """Returns the pack bytes and a list of (name, cf, bytes) per icon."""
+    icons = []
+    for asset, bg, fmt in img_convert.IMAGES:
+        width, height, rows = img_convert.load_png(os.path.join(img_convert.ASSET_DIR, asset))
+        name = os.path.splitext(asset)[0].replace(" ", "_").lower() + ".bin"
+        try:
+            cf, _, data16, data8 = img_convert.convert(rows, width, bg, fmt)
+        except ValueError as e:
+            sys.exit("%s: %s" % (asset, e))
+        data = data8 if depth == 8 and data8 is not None else data16
+        body = lv_img_header(COLOR_FORMATS[cf], width, height) + bytes(v for row in data for v in row)
+        icons.append((name, cf[10:], body))
+
+    data_start = HEADER.size + ENTRY.size * len(icons)
+    directory, blobs = b"", b""
+    for name, _, body in icons:
+        blobs += b"\0" * (-(data_start + len(blobs)) % 4)  # 4-byte aligned pixel data
+        directory += ENTRY.pack(name.encode(), data_start + len(blobs), len(body))
+        blobs += body
+    size = data_start + len(blobs)
+    return HEADER.pack(MAGIC, len(icons), depth, 0, size) + directory + blobs, icons
+
+
+def find_esptool():
+    """esptool on the PATH, or the copy PlatformIO installs."""
+    for name in ("esptool.py", "esptool"):
+        path = shutil.which(name)
+        if path:
+            return [path]
+    for path in glob.glob(os.path.expanduser("~/.platformio/packages/tool-esptoolpy/esptool.py")):
+        return [sys.executable, path]
+    sys.exit("esptool not found - install it or PlatformIO's espressif32 platform")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--depth", type=int, choices=(8, 16), default=16,
+                        help="LV_COLOR_DEPTH of the firmware (8 for env:cyd_8bit)")
+    parser.add_argument("--out", default=OUT_FILE, help="partition image to write")
+    parser.add_argument("--upload", metavar="PORT", help="write the image to the board on PORT")
+    parser.add_argument("--baud", type=int, default=921600)
+    args = parser.parse_args()
+
+    pack, icons = build_pack(args.depth)
+    offset, size = partition(PARTITION_NAME)
+    if len(pack) > size:
+        sys.exit("pack is %d bytes, the %s partition only %d" % (len(pack), PARTITION_NAME, size))
+
+    print("%-28s %-16s %9s" % ("icon", "format", "bytes"))
+    for name, cf, body in icons:
+        print("%-28s %-16s %9d" % (name, cf, len(body)))
+    # The app loses the same pixel data, plus an lv_img_dsc_t per icon
+    print("pack: %d bytes of the %d byte %s partition at 0x%X" % (len(pack), size, PARTITION_NAME, offset))
+    print("app: about %d bytes smaller" % sum(len(body) - 4 + 20 for _, _, body in icons))
+
+    os.makedirs(os.path.dirname(args.out) or ".", exist_ok=True)
+    with open(args.out, "wb") as f:
+        f.write(pack)
+    print("wrote %s" % args.out)
+
+    if args.upload:
+        command = find_esptool() + ["--chip", "esp32", "--port", args.upload, "--baud", str(args.baud),
+                                    "write_flash", "0x%X" % offset, args.out]
+        start = time.time()
+        result = subprocess.call(command)
+        if result != 0:
+            sys.exit(result)
+        print("asset upload took %.1f s" % (time.time() - start))
+
+
+if __name__ == "__main__":
+    main()
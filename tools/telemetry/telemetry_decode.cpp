@@ -0,0 +1,199 @@
+// Convert bale counter telemetry captures to CSV or JSON lines
+//
+// Reads a capture of the Serial port taken with "telemetry on" (see
+// src/telemetry.h), checks every frame and writes one line per event.
+// Bad frames and lost frames are counted, not fatal. --stats prints the
+// counts and the decode speed to stderr. --generate writes a synthetic
+// capture of the given size (with some log text and damaged frames mixed
+// in) to benchmark the decoder on multi-GB files.
+//
+// Build and run from the repository root (Linux):
+//     g++ -O2 -std=c++17 -Isrc -o .pio/telemetry_decode tools/telemetry/*.cpp src/telemetry.cpp
+//     stty -F /dev/ttyUSB0 115200 raw && cat /dev/ttyUSB0 > capture.bin
+//     .pio/telemetry_decode capture.bin > events.csv
+//     .pio/telemetry_decode --json --stats capture.bin > events.jsonl
+//     .pio/telemetry_decode --generate 4096 /tmp/big.bin
+//     .pio/telemetry_decode --stats /tmp/big.bin > /dev/null
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "telemetry.h"
+#include "telemetry_reader.h"
+
+#define READ_BUF_BYTES (4 << 20)
+#define WRITE_BUF_BYTES (4 << 20)
+
+struct Output {
+    char *buf;
+    size_t len;
+    bool json;
+};
+
+static void flushOutput(Output *out) {
+    size_t done = 0;
+    while (done < out->len) {
+        ssize_t n = write(STDOUT_FILENO, out->buf + done, out->len - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("write");
+            exit(1);
+        }
+        done += n;
+    }
+    out->len = 0;
+}
+
+static void onEvent(void *ctx, uint16_t seq, const TelemetryEvent *ev) {
+    Output *out = (Output *)ctx;
+    if (out->len + TELEMETRY_LINE_MAX > WRITE_BUF_BYTES) {
+        flushOutput(out);
+    }
+    char *line = out->buf + out->len;
+    out->len += out->json ? telemetryFormatJson(seq, ev, line) : telemetryFormatCsv(seq, ev, line);
+}
+
+// Feed a whole file (or stdin for "-") to the reader
+static bool decodeFile(const char *path, TelemetryReader *reader, uint8_t *buf) {
+    int fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return false;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    for (;;) {
+        ssize_t n = read(fd, buf, READ_BUF_BYTES);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror(path);
+            break;
+        }
+        if (n == 0) break;
+        telemetryReaderFeed(reader, buf, n);
+    }
+    if (fd != STDIN_FILENO) close(fd);
+    return true;
+}
+
+// Write about mb megabytes of frames like a long season of baling
+static int generate(const char *path, uint64_t mb) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+    static uint8_t packed[TELEMETRY_PACKED_MAX];
+    TelemetryEvent batch[TELEMETRY_BATCH_MAX];
+    TelemetryEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    uint64_t target = mb << 20, written = 0;
+    uint16_t seq = 0;
+    uint32_t frames = 0;
+    while (written < target) {
+        for (int i = 0; i < TELEMETRY_BATCH_MAX; i++) {
+            ev.time_us += 1500000 + (frames * 7919 + i * 104729) % 1000000;
+            if (ev.flake_count >= 12 + (frames + i) % 5) {
+                ev.type = TELEM_BALE;
+                ev.bale_count++;
+                ev.bale_count_year++;
+                ev.bales_in_session++;
+                ev.flake_count = 0;
+                ev.rate_x10 = 400 + ev.bale_count % 200;
+            } else {
+                ev.type = TELEM_FLAKE;
+                ev.flake_count++;
+            }
+            ev.loop_us = 40 + (frames + i) % 60;
+            ev.loop_max_us = 900 + frames % 3000;
+            batch[i] = ev;
+        }
+        size_t n = telemetryPack(packed, seq++, batch, TELEMETRY_BATCH_MAX);
+        frames++;
+        if (frames % 50000 == 0) {
+            packed[n / 2] ^= 0x40;      // A damaged frame
+        }
+        if (frames % 20000 == 0) {
+            seq++;                      // A lost frame
+        }
+        fwrite(packed, 1, n, f);
+        written += n;
+        if (frames % 10000 == 0) {
+            static const char text[] = "[  812.345] I Bale count incremented to: 57, yearly: 1204\n";
+            fwrite(text, 1, sizeof(text) - 1, f);
+            written += sizeof(text) - 1;
+        }
+    }
+    fclose(f);
+    fprintf(stderr, "%llu frames, %llu bytes written to %s\n", (unsigned long long)frames,
+            (unsigned long long)written, path);
+    return 0;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: telemetry_decode [--json] [--stats] [capture ...]\n"
+                    "       telemetry_decode --generate <MB> <capture>\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    bool json = false, stats = false;
+    int first = 1;
+    for (; first < argc && argv[first][0] == '-' && argv[first][1] == '-'; first++) {
+        if (strcmp(argv[first], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[first], "--stats") == 0) {
+            stats = true;
+        } else if (strcmp(argv[first], "--generate") == 0 && argc - first == 3) {
+            return generate(argv[first + 2], strtoull(argv[first + 1], NULL, 10));
+        } else {
+            usage();
+        }
+    }
+
+    Output out = {(char *)malloc(WRITE_BUF_BYTES), 0, json};
+    uint8_t *buf = (uint8_t *)malloc(READ_BUF_BYTES);
+    if (out.buf == NULL || buf == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    TelemetryReader reader;
+    telemetryReaderInit(&reader, onEvent, &out);
+    if (!json) {
+        const char *header = telemetryCsvHeader();
+        memcpy(out.buf, header, strlen(header));
+        out.len = strlen(header);
+    }
+
+    struct timespec start, stop;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    bool ok = true;
+    if (first == argc) {
+        ok = decodeFile("-", &reader, buf);
+    }
+    for (int i = first; i < argc; i++) {
+        ok = decodeFile(argv[i], &reader, buf) && ok;
+    }
+    flushOutput(&out);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    if (stats) {
+        const TelemetryReaderStats *s = &reader.stats;
+        double seconds = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+        fprintf(stderr, "%llu bytes, %llu frames, %llu events, %llu bad frames, %llu lost frames\n",
+                (unsigned long long)s->bytes, (unsigned long long)s->frames, (unsigned long long)s->events,
+                (unsigned long long)s->bad_frames, (unsigned long long)s->lost_frames);
+        if (seconds > 0) {
+            fprintf(stderr, "%.2f s, %.0f MB/s, %.1f M events/s\n", seconds, s->bytes / seconds / 1e6,
+                    s->events / seconds / 1e6);
+        }
+    }
+    free(buf);
+    free(out.buf);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+// Streaming reader for the bale counter's binary telemetry - see telemetry_reader.h
+
+#include "telemetry_reader.h"
+#include <string.h>
+
+void telemetryReaderInit(TelemetryReader *r, TelemetryEventFn on_event, void *ctx) {
+    memset(r, 0, sizeof(*r));
+    r->on_event = on_event;
+    r->ctx = ctx;
+}
+
+// Decode and report one delimited frame
+static void readFrame(TelemetryReader *r, const uint8_t *data, size_t len) {
+    uint8_t frame[TELEMETRY_FRAME_MAX];
+    TelemetryEvent events[TELEMETRY_BATCH_MAX];
+    uint16_t seq;
+    size_t frame_len = cobsDecode(data, len, frame, sizeof(frame));
+    int count = frame_len > 0 ? telemetryParse(frame, frame_len, &seq, events) : -1;
+    if (count < 0) {
+        r->stats.bad_frames++;
+        return;
+    }
+    if (r->have_seq) {
+        r->stats.lost_frames += (uint16_t)(seq - r->last_seq - 1);
+    }
+    r->have_seq = true;
+    r->last_seq = seq;
+    r->stats.frames++;
+    r->stats.events += count;
+    for (int i = 0; i < count; i++) {
+        r->on_event(r->ctx, seq, &events[i]);
+    }
+}
+
+void telemetryReaderFeed(TelemetryReader *r, const uint8_t *data, size_t len) {
+    r->stats.bytes += len;
+    const uint8_t *end = data + len;
+    while (data < end) {
+        const uint8_t *zero = (const uint8_t *)memchr(data, 0, end - data);
+        const uint8_t *stop = zero != NULL ? zero : end;
+        size_t n = stop - data;
+
+        if (zero != NULL && r->pending_len == 0 && !r->overlong) {
+            // A whole frame in the input: decode it where it is
+            if (n > 0) {
+                if (n <= TELEMETRY_READER_MAX) {
+                    readFrame(r, data, n);
+                } else {
+                    r->stats.bad_frames++;
+                }
+            }
+        } else {
+            // Part of a frame: keep it until its delimiter arrives
+            if (!r->overlong && r->pending_len + n <= TELEMETRY_READER_MAX) {
+                memcpy(r->pending + r->pending_len, data, n);
+                r->pending_len += n;
+            } else if (!r->overlong && n > 0) {
+                r->overlong = true;
+            }
+            if (zero != NULL) {
+                if (r->overlong) {
+                    r->stats.bad_frames++;
+                } else if (r->pending_len > 0) {
+                    readFrame(r, r->pending, r->pending_len);
+                }
+                r->pending_len = 0;
+                r->overlong = false;
+            }
+        }
+        data = zero != NULL ? zero + 1 : end;
+    }
+}
+
+const char *telemetryTypeName(uint8_t type) {
+    switch (type) {
+    case TELEM_STATUS: return "status";
+    case TELEM_BALE: return "bale";
+    case TELEM_FLAKE: return "flake";
+    case TELEM_RESET: return "reset";
+    default: return "unknown";
+    }
+}
+
+const char *telemetryCsvHeader(void) {
+    return "seq,type,time_us,bale_count,bale_count_year,flake_count,bales_in_session,rate,"
+           "loop_us,loop_max_us,alerts\n";
+}
+
+// Append text without its terminating zero
+static char *putText(char *p, const char *text) {
+    size_t n = strlen(text);
+    memcpy(p, text, n);
+    return p + n;
+}
+
+static char *putU64(char *p, uint64_t v) {
+    char digits[20];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    while (n > 0) {
+        *p++ = digits[--n];
+    }
+    return p;
+}
+
+// A tenths value as "48.2"
+static char *putTenths(char *p, uint32_t tenths) {
+    p = putU64(p, tenths / 10);
+    *p++ = '.';
+    *p++ = (char)('0' + tenths % 10);
+    return p;
+}
+
+size_t telemetryFormatCsv(uint16_t seq, const TelemetryEvent *ev, char *buf) {
+    char *p = buf;
+    p = putU64(p, seq);
+    *p++ = ',';
+    p = putText(p, telemetryTypeName(ev->type));
+    *p++ = ',';
+    p = putU64(p, ev->time_us);
+    *p++ = ',';
+    p = putU64(p, ev->bale_count);
+    *p++ = ',';
+    p = putU64(p, ev->bale_count_year);
+    *p++ = ',';
+    p = putU64(p, ev->flake_count);
+    *p++ = ',';
+    p = putU64(p, ev->bales_in_session);
+    *p++ = ',';
+    p = putTenths(p, ev->rate_x10);
+    *p++ = ',';
+    p = putU64(p, ev->loop_us);
+    *p++ = ',';
+    p = putU64(p, ev->loop_max_us);
+    *p++ = ',';
+    p = putU64(p, ev->alerts);
+    *p++ = '\n';
+    return p - buf;
+}
+
+size_t telemetryFormatJson(uint16_t seq, const TelemetryEvent *ev, char *buf) {
+    char *p = buf;
+    p = putText(p, "{\"seq\":");
+    p = putU64(p, seq);
+    p = putText(p, ",\"type\":\"");
+    p = putText(p, telemetryTypeName(ev->type));
+    p = putText(p, "\",\"time_us\":");
+    p = putU64(p, ev->time_us);
+    p = putText(p, ",\"bale_count\":");
+    p = putU64(p, ev->bale_count);
+    p = putText(p, ",\"bale_count_year\":");
+    p = putU64(p, ev->bale_count_year);
+    p = putText(p, ",\"flake_count\":");
+    p = putU64(p, ev->flake_count);
+    p = putText(p, ",\"bales_in_session\":");
+    p = putU64(p, ev->bales_in_session);
+    p = putText(p, ",\"rate\":");
+    p = putTenths(p, ev->rate_x10);
+    p = putText(p, ",\"loop_us\":");
+    p = putU64(p, ev->loop_us);
+    p = putText(p, ",\"loop_max_us\":");
+    p = putU64(p, ev->loop_max_us);
+    p = putText(p, ",\"alerts\":");
+    p = putU64(p, ev->alerts);
+    p = putText(p, "}\n");
+    return p - buf;
+}
@@ -0,0 +1,61 @@
+// Streaming reader for the bale counter's binary telemetry (see src/telemetry.h)
+//
+// Feed it the bytes from the Serial port or a capture file in pieces of any
+// size. It splits them at the zero delimiters, COBS decodes and checks each
+// frame, and calls back once per event. Anything that isn't a valid frame
+// (log text, a frame cut by starting mid-stream, a bad CRC) is counted and
+// skipped, and gaps in the frame sequence number are counted as lost frames.
+// Also formats events as CSV or JSON lines, without printf, for converting
+// captures of many GB.
+// Host only (Linux); build with the CLI in telemetry_decode.cpp.
+
+#ifndef BALECOUNTER_TELEMETRY_READER_H
+#define BALECOUNTER_TELEMETRY_READER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "telemetry.h"
+
+// Longest run of bytes between delimiters kept as a possible frame
+#define TELEMETRY_READER_MAX (TELEMETRY_FRAME_MAX + TELEMETRY_FRAME_MAX / 254 + 1)
+// Longest line written by telemetryFormatCsv() or telemetryFormatJson()
+#define TELEMETRY_LINE_MAX 256
+
+typedef void (*TelemetryEventFn)(void *ctx, uint16_t seq, const TelemetryEvent *ev);
+
+struct TelemetryReaderStats {
+    uint64_t bytes;          // Bytes fed
+    uint64_t frames;         // Valid frames
+    uint64_t events;
+    uint64_t bad_frames;     // Delimited data that wasn't a valid frame
+    uint64_t lost_frames;    // Missing sequence numbers between valid frames
+};
+
+struct TelemetryReader {
+    uint8_t pending[TELEMETRY_READER_MAX];   // Bytes since the last delimiter
+    size_t pending_len;
+    bool overlong;                           // Too long for a frame, skip to the next delimiter
+    bool have_seq;
+    uint16_t last_seq;
+    TelemetryEventFn on_event;
+    void *ctx;
+    TelemetryReaderStats stats;
+};
+
+void telemetryReaderInit(TelemetryReader *r, TelemetryEventFn on_event, void *ctx);
+
+// Process the next len bytes of the stream
+void telemetryReaderFeed(TelemetryReader *r, const uint8_t *data, size_t len);
+
+// Name of an event type ("bale"), or "unknown"
+const char *telemetryTypeName(uint8_t type);
+
+// Column names for telemetryFormatCsv(), with a newline
+const char *telemetryCsvHeader(void);
+
+// Format an event as one line ending in a newline. buf needs
+// TELEMETRY_LINE_MAX bytes. Returns the length.
+size_t telemetryFormatCsv(uint16_t seq, const TelemetryEvent *ev, char *buf);
+size_t telemetryFormatJson(uint16_t seq, const TelemetryEvent *ev, char *buf);
+
+#endif // BALECOUNTER_TELEMETRY_READER_H
@@ -0,0 +1,496 @@
+#!/usr/bin/env python3
+"""Generate the main screen as const tables from the SquareLine project.
+
+SquareLine exports a screen as one long function of LVGL calls, one block
+per object. This script reads SquareLineUIProject/BaleCounter.spj instead
+and writes:
+
+  src/ui/ui_Main.c/.h     the ui_* handles, uiCYD_* aliases and event
+                          functions, and a table row per object that
+                          ui_build() (src/ui/ui_builder.c) creates at run time
+  src/ui/ui_styles.c/.h   one static style per distinct set of style
+                          properties, shared by every object that uses it
+
+The subtrees in LAZY are written as separate tables that are built when
+they are opened and deleted when they are closed. SquareLine's "modify
+flag HIDDEN" actions on them are replaced by calls to the handlers given
+here, which open and close them.
+
+Only the widgets, properties and event actions this project uses are
+supported; anything else stops the script, so a new SquareLine feature is
+not silently dropped.
+
+Run from the repository root after changing the UI in SquareLine Studio
+(instead of exporting the UI files):
+    python3 tools/ui_gen.py
+"""
+
+import json
+import re
+import sys
+
+PROJECT = "SquareLineUIProject/BaleCounter.spj"
+UI_DIR = "src/ui/"
+SCREEN_C = UI_DIR + "ui_Main.c"
+SCREEN_H = UI_DIR + "ui_Main.h"
+STYLES_C = UI_DIR + "ui_styles.c"
+STYLES_H = UI_DIR + "ui_styles.h"
+
+FILE_LISTS = ["src/ui/CMakeLists.txt", "src/ui/filelist.txt"]
+EXTRA_SOURCES = ["ui_styles.c", "ui_builder.c"]
+
+# Subtree root -> (function prefix, handler called for each HIDDEN action on it)
+LAZY = {
+    "SettingsPopupPanel": ("SettingsPopup", {
+        "TOGGLE": "handleSettingsBtnClick",
+        "ADD": "handleSettingsCloseBtnClick",
+    }),
+}
+
+TYPES = {
+    "SCREEN": "UI_TYPE_SCREEN",
+    "PANEL": "UI_TYPE_PANEL",
+    "CONTAINER": "UI_TYPE_CONTAINER",
+    "LABEL": "UI_TYPE_LABEL",
+    "IMAGE": "UI_TYPE_IMG",
+    "IMGBUTTON": "UI_TYPE_IMGBTN",
+    "BUTTON": "UI_TYPE_BTN",
+    "TABVIEW": "UI_TYPE_TABVIEW",
+    "TABPAGE": "UI_TYPE_TABPAGE",
+}
+
+# Flag properties and the value SquareLine leaves out of its export
+FLAGS = {
+    "Clickable": ("LV_OBJ_FLAG_CLICKABLE", lambda kind: kind not in ("LABEL", "IMAGE")),
+    "Scrollable": ("LV_OBJ_FLAG_SCROLLABLE", lambda kind: True),
+    "Adv_hittest": ("LV_OBJ_FLAG_ADV_HITTEST", lambda kind: False),
+    "Hidden": ("LV_OBJ_FLAG_HIDDEN", lambda kind: False),
+}
+
+# Properties that are fine at these values and not supported at any other
+DEFAULTS = {
+    "Layout_type": "No_layout",
+    "Scrollbar_mode": "AUTO",
+    "Scroll_direction": "ALL",
+    "Scroll_snap_x": "NONE",
+    "Scroll_snap_y": "NONE",
+    "Long_mode": "WRAP",
+    "Recolor": "False",
+    "Temporary": "False",
+}
+
+# Colour style properties -> (colour, opacity) style setters
+COLOURS = {
+    "Text_Color": ("text_color", "text_opa"),
+    "Bg_Color": ("bg_color", "bg_opa"),
+    "Border_Color": ("border_color", "border_opa"),
+    "Image_reColor": ("img_recolor", "img_recolor_opa"),
+}
+
+# Size/position unit flags
+UNIT_PX = 0x11
+UNIT_CONTENT = (0x02, 0x20)
+
+
+def fail(node, message):
+    sys.exit("%s: %s: %s" % (PROJECT, node.get("name", "?"), message))
+
+
+def colour(rgba):
+    return "lv_color_hex(0x%02X%02X%02X)" % tuple(rgba[:3])
+
+
+def style_props(node, prop):
+    """The lv_style_set_* (name, value) pairs of a style property."""
+    out = []
+    for item in prop.get("childs", []):
+        key, value = item["strtype"].split("/", 1)[1], item.get("strval", item.get("intarray"))
+        if key == "Text_Font":
+            out.append(("text_font", "&lv_font_%s" % value))
+        elif key == "Text_Align":
+            out.append(("text_align", "LV_TEXT_ALIGN_%s" % value))
+        elif key in COLOURS:
+            name, opa = COLOURS[key]
+            out.append((name, colour(value)))
+            out.append((opa, str(value[3])))
+        else:
+            fail(node, "style property %s is not supported" % key)
+    return out
+
+
+def parse_object(raw, parent, guids):
+    props = raw["properties"]
+    kind = raw["saved_objtypeKey"]
+    if kind not in TYPES:
+        sys.exit("%s: widget %s is not supported" % (PROJECT, kind))
+    node = {"kind": kind, "parent": parent, "children": [], "flags_add": [], "flags_clear": [],
+            "x": 0, "y": 0, "w": 0, "h": 0, "align": None, "text": None, "src": None,
+            "src_pressed": None, "alias": None, "styles": [], "events": [],
+            "tab_dir": None, "tab_size": None}
+
+    for prop in props:
+        key = prop["strtype"].split("/", 1)[1]
+        value = prop.get("strval")
+        if key == "Name":
+            node["name"] = value
+            for child in prop.get("childs", []):
+                if child["strtype"] == "_codename/Codename" and child.get("strval"):
+                    node["alias"] = child["strval"]
+        elif key in ("Position", "Size"):
+            units = prop.get("flags", UNIT_PX)
+            a, b = prop["intarray"]
+            if key == "Size":
+                if units & ~(UNIT_PX | UNIT_CONTENT[0] | UNIT_CONTENT[1]):
+                    fail(node, "size units 0x%X are not supported" % units)
+                node["w"] = "LV_SIZE_CONTENT" if units & UNIT_CONTENT[0] else a
+                node["h"] = "LV_SIZE_CONTENT" if units & UNIT_CONTENT[1] else b
+            else:
+                if units != UNIT_PX:
+                    fail(node, "position units 0x%X are not supported" % units)
+                node["x"], node["y"] = a, b
+        elif key == "Align":
+            # TOP_LEFT is where LVGL puts an object without an alignment
+            node["align"] = "LV_ALIGN_" + value if value != "TOP_LEFT" else None
+        elif key in FLAGS and kind != "TABPAGE":
+            flag, default = FLAGS[key]
+            on = value == "True"
+            if on != default(kind):
+                node["flags_add" if on else "flags_clear"].append(flag)
+        elif key in DEFAULTS:
+            if value != DEFAULTS[key]:
+                fail(node, "%s = %s is not supported" % (key, value))
+        elif key == "Text" or key == "Title":
+            node["text"] = value
+        elif key == "Asset" or key == "Image_released":
+            node["src"] = asset_symbol(value)
+        elif key == "Image_pressed":
+            node["src_pressed"] = asset_symbol(value)
+        elif key in ("Image_disabled", "Image_checked_released", "Image_checked_pressed",
+                     "Image_checked_disabled"):
+            if asset_symbol(value):
+                fail(node, "%s is not supported" % key)
+        elif key == "Pivot":
+            if prop["intarray"] != [0, 0]:
+                fail(node, "image pivot is not supported")
+        elif key == "Rotation":
+            if prop.get("integer", 0) != 0:
+                fail(node, "image rotation is not supported")
+        elif key == "Scale":
+            if prop.get("integer", 256) != 256:
+                fail(node, "image scale is not supported")
+        elif key == "Tab_position":
+            node["tab_dir"] = "LV_DIR_" + value
+        elif key == "Tab_size":
+            node["tab_size"] = prop["integer"]
+        elif key.startswith("Style_"):
+            tab_btns = "get_tab_btns" in value
+            part = prop["part"].strip().replace("lv.PART.", "LV_PART_")
+            for state in prop.get("childs", []):
+                selector = "%s | LV_STATE_%s" % (part, state["strval"])
+                node["styles"].append((tuple(sorted(style_props(node, state))), selector, tab_btns))
+        elif key == "EventHandler":
+            node["events"].append(prop)
+        elif key == "Checked" and value == "True":
+            fail(node, "checked state is not supported")
+
+    guids[raw["guid"]] = node
+    for child in raw.get("children", []):
+        node["children"].append(parse_object(child, node, guids))
+    return node
+
+
+def asset_symbol(path):
+    if not path or path == "-":
+        return None
+    name = path.split("/")[-1].rsplit(".", 1)[0]
+    return "ui_img_%s_png" % name.replace(" ", "_").lower()
+
+
+def image_source(symbol):
+    """Table image source: the compiled-in array, or its file in the assets
+    partition with UI_ASSETS_PARTITION (same name as tools/pack_assets.py)."""
+    return 'UI_IMG(%s, "%s.bin")' % (symbol, symbol[len("ui_img_"):-len("_png")])
+
+
+def event_actions(node, prop, guids):
+    """C statements run by one SquareLine event handler."""
+    if prop.get("disabled"):
+        return []
+    lines = []
+    for action in prop.get("childs", []):
+        if action["strtype"] != "_event/action":
+            continue
+        args = {c["strtype"].split("/", 1)[1]: c.get("strval") for c in action.get("childs", [])}
+        if action["strval"] == "CALL FUNCTION":
+            if args.get("Function_name"):
+                lines.append("%s(e);" % args["Function_name"])
+        elif action["strval"] == "MODIFY FLAG":
+            target = guids[args["Object"]]
+            if target["name"] in LAZY and args["Flag"] == "HIDDEN":
+                lines.append("%s(e);" % LAZY[target["name"]][1][args["Action"]])
+            else:
+                lines.append("_ui_flag_modify(ui_%s, LV_OBJ_FLAG_%s, _UI_MODIFY_FLAG_%s);"
+                             % (target["name"], args["Flag"], args["Action"]))
+        else:
+            fail(node, "event action %s is not supported" % action["strval"])
+    return [(prop["strval"], lines)] if lines else []
+
+
+def walk(node):
+    yield node
+    for child in node["children"]:
+        yield from walk(child)
+
+
+def table_rows(node, lazy_roots):
+    """Objects of a table in creation order, without the lazy subtrees below it."""
+    rows = [node]
+    for child in node["children"]:
+        if child["name"] in LAZY:
+            lazy_roots.append(child)
+        else:
+            rows += table_rows(child, lazy_roots)
+    return rows
+
+
+def obj_row(node):
+    fields = [".obj = &ui_%s" % node["name"]]
+    if node["alias"]:
+        fields.append(".alias = &uiCYD_%s" % node["alias"])
+    if node["parent"]:
+        fields.append(".parent = &ui_%s" % node["parent"]["name"])
+    fields.append(".type = %s" % TYPES[node["kind"]])
+    if node["text"] is not None:
+        # SquareLine stores the text as a C string body (escapes already in place)
+        fields.append('.text = "%s"' % node["text"].replace('"', '\\"'))
+    if node["src"]:
+        fields.append(".src = %s" % image_source(node["src"]))
+    if node["src_pressed"]:
+        fields.append(".src_pressed = %s" % image_source(node["src_pressed"]))
+    if node["w"] or node["h"]:
+        fields.append(".w = %s, .h = %s" % (node["w"], node["h"]))
+    if node["x"] or node["y"]:
+        fields.append(".x = %d, .y = %d" % (node["x"], node["y"]))
+    if node["align"]:
+        fields.append(".align = %s" % node["align"])
+    if node["tab_dir"]:
+        fields.append(".tab_dir = %s, .tab_size = %d" % (node["tab_dir"], node["tab_size"]))
+    if node["flags_add"]:
+        fields.append(".flags_add = %s" % " | ".join(node["flags_add"]))
+    if node["flags_clear"]:
+        fields.append(".flags_clear = %s" % " | ".join(node["flags_clear"]))
+    if node["event_name"]:
+        fields.append(".event_cb = %s" % node["event_name"])
+    return "    { %s }," % ", ".join(fields)
+
+
+def write_tables(out, prefix, rows, style_of):
+    out.append("static const ui_obj_desc_t %s_objs[] = {" % prefix)
+    out += [obj_row(node) for node in rows]
+    out.append("};")
+    out.append("")
+    styles = [(node, s) for node in rows for s in node["styles"]]
+    if styles:
+        out.append("static const ui_style_desc_t %s_styles[] = {" % prefix)
+        for node, (props, selector, tab_btns) in styles:
+            out.append("    { &ui_%s, &%s, %s%s }," % (node["name"], style_of[props], selector,
+                                                    ", true" if tab_btns else ""))
+        out.append("};")
+        out.append("")
+    return len(styles)
+
+
+def add_to_file_lists():
+    """List the extra sources in SquareLine's CMake and file lists after ui_Main.c."""
+    for path in FILE_LISTS:
+        with open(path) as f:
+            text = f.read()
+        for source in reversed(EXTRA_SOURCES):
+            if source not in text:
+                indent = "    " if "SET(" in text else ""
+                text = re.sub(r"ui_Main\.c(\s)", r"ui_Main.c\1" + indent + source + r"\1", text, count=1)
+        with open(path, "w") as f:
+            f.write(text)
+
+
+def main():
+    with open(PROJECT) as f:
+        project = json.load(f)
+    guids = {}
+    screens = [parse_object(raw, None, guids) for raw in project["root"]["children"]]
+    if len(screens) != 1 or screens[0]["name"] != "Main":
+        sys.exit("%s: only the single Main screen is supported" % PROJECT)
+    screen = screens[0]
+    nodes = list(walk(screen))
+
+    # Event functions, named like SquareLine's
+    for node in nodes:
+        handlers = []
+        for prop in node["events"]:
+            handlers += event_actions(node, prop, guids)
+        node["handlers"] = handlers
+        node["event_name"] = "ui_event_%s" % node["name"] if handlers else None
+
+    # The lazy roots are created hidden by SquareLine and shown by the actions above
+    for node in nodes:
+        if node["name"] in LAZY and "LV_OBJ_FLAG_HIDDEN" in node["flags_add"]:
+            node["flags_add"].remove("LV_OBJ_FLAG_HIDDEN")
+
+    # One shared style per distinct property set, in order of first use
+    styles = []
+    style_of = {}
+    for node in nodes:
+        for props, _, _ in node["styles"]:
+            if props not in style_of:
+                styles.append(props)
+                style_of[props] = "ui_style_%d" % len(styles)
+
+    lazy_roots = []
+    main_rows = table_rows(screen, lazy_roots)
+    lazy_tables = []
+    for root in lazy_roots:
+        lazy_tables.append((root, table_rows(root, lazy_roots)))
+
+    header = [
+        "// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj",
+        "// LVGL version: 8.3.6",
+        "// Project name: BaleCounter",
+        "",
+        "#ifndef UI_MAIN_H",
+        "#define UI_MAIN_H",
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "// SCREEN: ui_Main",
+        "extern void ui_Main_screen_init(void);",
+        "extern void ui_Main_screen_destroy(void);",
+    ]
+    for node in nodes:
+        if node["name"] in LAZY:
+            prefix = LAZY[node["name"]][0]
+            header += ["// Created on open and deleted on close (NULL while closed)",
+                       "extern void ui_%s_create(void);" % prefix,
+                       "extern void ui_%s_destroy(void);" % prefix]
+        if node["event_name"]:
+            header.append("extern void %s(lv_event_t * e);" % node["event_name"])
+        header.append("extern lv_obj_t * ui_%s;" % node["name"])
+    header.append("// CUSTOM VARIABLES")
+    header += ["extern lv_obj_t * uiCYD_%s;" % node["alias"] for node in nodes if node["alias"]]
+    header += ["", "#ifdef __cplusplus", '} /*extern "C"*/', "#endif", "", "#endif", ""]
+
+    source = [
+        "// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj",
+        "// LVGL version: 8.3.6",
+        "// Project name: BaleCounter",
+        "",
+        '#include "ui.h"',
+        '#include "ui_builder.h"',
+        '#include "ui_styles.h"',
+        "",
+    ]
+    source += ["lv_obj_t * uiCYD_%s;" % node["alias"] for node in nodes if node["alias"]]
+    source += ["lv_obj_t * ui_%s = NULL;" % node["name"] for node in nodes]
+    source.append("// event funtions")
+    for node in nodes:
+        if not node["event_name"]:
+            continue
+        source += ["void %s(lv_event_t * e)" % node["event_name"], "{",
+                   "    lv_event_code_t event_code = lv_event_get_code(e);", ""]
+        for code, lines in node["handlers"]:
+            source.append("    if(event_code == LV_EVENT_%s) {" % code)
+            source += ["        " + line for line in lines]
+            source.append("    }")
+        source += ["}", ""]
+
+    source += ["// build tables", ""]
+    style_rows = write_tables(source, "ui_Main", main_rows, style_of)
+    for root, rows in lazy_tables:
+        style_rows += write_tables(source, "ui_" + LAZY[root["name"]][0], rows, style_of)
+
+    def build_call(prefix, rows):
+        has_styles = any(node["styles"] for node in rows)
+        return ("    ui_build(%s_objs, UI_TABLE_SIZE(%s_objs), %s);"
+                % (prefix, prefix, "%s_styles, UI_TABLE_SIZE(%s_styles)" % (prefix, prefix)
+                   if has_styles else "NULL, 0"))
+
+    source += ["// build funtions", "", "void ui_Main_screen_init(void)", "{",
+               "    ui_styles_init();", build_call("ui_Main", main_rows), "}", ""]
+    for root, rows in lazy_tables:
+        prefix = "ui_" + LAZY[root["name"]][0]
+        source += [
+            "void %s_create(void)" % prefix, "{",
+            "    if(ui_%s) return;" % root["name"],
+            build_call(prefix, rows), "}", "",
+            "void %s_destroy(void)" % prefix, "{",
+            "    // Deleted after the current event, which may come from a button inside it",
+            "    if(ui_%s) lv_obj_del_async(ui_%s);" % (root["name"], root["name"]),
+            "    ui_build_clear(%s_objs, UI_TABLE_SIZE(%s_objs));" % (prefix, prefix), "}", "",
+        ]
+    source += ["void ui_Main_screen_destroy(void)", "{", "    if(ui_Main) lv_obj_del(ui_Main);",
+               "    ui_build_clear(ui_Main_objs, UI_TABLE_SIZE(ui_Main_objs));"]
+    source += ["    ui_build_clear(ui_%s_objs, UI_TABLE_SIZE(ui_%s_objs));"
+               % (LAZY[root["name"]][0], LAZY[root["name"]][0]) for root, _ in lazy_tables]
+    source += ["}", ""]
+
+    styles_h = [
+        "// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj",
+        "// Static styles shared by every object with the same style properties",
+        "",
+        "#ifndef _UI_STYLES_H",
+        "#define _UI_STYLES_H",
+        "",
+        '#include "lvgl.h"',
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+    ]
+    styles_h += ["extern lv_style_t ui_style_%d;" % (i + 1) for i in range(len(styles))]
+    styles_h += [
+        "",
+        "// Set up the styles (called by ui_Main_screen_init before any object uses them)",
+        "void ui_styles_init(void);",
+        "",
+        "#ifdef __cplusplus",
+        '} /*extern "C"*/',
+        "#endif",
+        "",
+        "#endif",
+        "",
+    ]
+
+    styles_c = [
+        "// This file was generated by tools/ui_gen.py from SquareLineUIProject/BaleCounter.spj",
+        "",
+        '#include "ui_styles.h"',
+        "",
+    ]
+    styles_c += ["lv_style_t ui_style_%d;" % (i + 1) for i in range(len(styles))]
+    styles_c += [
+        "",
+        "void ui_styles_init(void)",
+        "{",
+        "    static bool initialized = false;",
+        "    if(initialized) return;",
+        "    initialized = true;",
+    ]
+    for i, props in enumerate(styles):
+        name = "ui_style_%d" % (i + 1)
+        styles_c += ["", "    lv_style_init(&%s);" % name]
+        styles_c += ["    lv_style_set_%s(&%s, %s);" % (prop, name, value) for prop, value in props]
+    styles_c += ["}", ""]
+
+    for path, lines in ((SCREEN_H, header), (SCREEN_C, source), (STYLES_H, styles_h), (STYLES_C, styles_c)):
+        with open(path, "w") as f:
+            f.write("\n".join(lines))
+    add_to_file_lists()
+
+    print("%d objects in %d tables, %d style rows, %d shared styles"
+          % (len(nodes), 1 + len(lazy_tables), style_rows, len(styles)))
+
+
+if __name__ == "__main__":
+    main()